@@ -0,0 +1,109 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <print>
+
+#include <prometheus/macro.hpp>
+
+namespace benchmark
+{
+	using clock_type = std::chrono::steady_clock;
+
+	struct suite_type
+	{
+		std::string_view name;
+		std::function<void()> function;
+	};
+
+	[[nodiscard]] inline auto suites() noexcept -> std::vector<suite_type>&
+	{
+		PROMETHEUS_COMPILER_NO_DESTROY static std::vector<suite_type> s{};
+		return s;
+	}
+
+	/**
+	 * @brief Register a benchmark suite, the suite is run by `main` (optionally filtered by the command line arguments).
+	 *
+	 * PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{"string.string_pool", [] -> void { ... }};
+	 */
+	struct suite
+	{
+		template<typename Function>
+		suite(const std::string_view name, Function function)
+		{
+			suites().emplace_back(name, std::move(function));
+		}
+	};
+
+	/**
+	 * @brief Prevent the compiler from optimizing away the computation of `value`.
+	 */
+	template<typename T>
+	auto do_not_optimize(T&& value) noexcept -> void
+	{
+#if defined(PROMETHEUS_COMPILER_MSVC)
+		static_cast<void>(*static_cast<const volatile char*>(static_cast<const void*>(std::addressof(value))));
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	/**
+	 * @brief Run `function` `repeat` times (`setup` is called, untimed, before every run),
+	 * and report the fastest run as items per second.
+	 * @param name the name of the benchmark
+	 * @param items the number of items processed by one call of `function`
+	 * @param repeat the number of runs
+	 * @param setup `auto setup() -> State`
+	 * @param function `auto function(State& state) -> void`
+	 */
+	template<typename Setup, typename Function>
+	auto run(const std::string_view name, const std::size_t items, const std::size_t repeat, Setup setup, Function function) -> void
+	{
+		auto best = clock_type::duration::max();
+
+		for (std::size_t i = 0; i < repeat; ++i)
+		{
+			auto state = std::invoke(setup);
+
+			const auto begin = clock_type::now();
+			std::invoke(function, state);
+			const auto end = clock_type::now();
+
+			do_not_optimize(state);
+			best = std::ranges::min(best, end - begin);
+		}
+
+		const auto seconds = std::chrono::duration<double>{best}.count();
+		std::println(
+			"{:<48} {:>12.3f} ms {:>16.0f} items/s",
+			name,
+			seconds * 1000,
+			static_cast<double>(items) / seconds
+		);
+	}
+
+	template<typename Function>
+	auto run(const std::string_view name, const std::size_t items, const std::size_t repeat, Function function) -> void
+	{
+		benchmark::run(
+			name,
+			items,
+			repeat,
+			[]() noexcept -> int { return 0; },
+			[&function](int&) -> void { std::invoke(function); }
+		);
+	}
+}
@@ -0,0 +1,148 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <format>
+
+// container::EnumSet
+#include <prometheus/container/enum_set.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	enum class Permission : std::uint8_t
+	{
+		READ = 0b0000'0001,
+		WRITE = 0b0000'0010,
+		EXECUTE = 0b0000'0100,
+		DELETE = 0b0000'1000,
+		SHARE = 0b0001'0000,
+		ADMIN = 0b0010'0000,
+
+		PROMETHEUS_MAGIC_ENUM_FLAG [[maybe_unused]] = 0b1111'1111,
+	};
+
+	// 0 ~ 199
+	enum class Capability : std::uint8_t
+	{
+		FIRST = 0,
+		SECOND = 1,
+		MIDDLE = 100,
+		LAST = 199,
+	};
+
+	constexpr std::size_t entity_count = 1'000'000;
+
+	template<typename EnumType>
+	[[nodiscard]] auto make_sets(const std::uint64_t seed) -> std::vector<container::EnumSet<EnumType>>
+	{
+		constexpr auto all = container::EnumSet<EnumType>::all();
+		const std::vector<EnumType> values{all.begin(), all.end()};
+
+		std::vector<container::EnumSet<EnumType>> sets(entity_count);
+
+		std::uint64_t state = seed;
+		for (auto& set: sets)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				if ((state >> (33 + i)) & 1)
+				{
+					set.insert(values[i]);
+				}
+			}
+		}
+
+		return sets;
+	}
+
+	template<typename EnumType>
+	auto run_all(const std::string_view enum_name, const EnumType first, const EnumType second) -> void
+	{
+		using set_type = container::EnumSet<EnumType>;
+
+		const auto sets = make_sets<EnumType>(42);
+		const auto grants = make_sets<EnumType>(1337);
+
+		benchmark::run(
+			std::format("insert each member {} x {}", entity_count, enum_name),
+			entity_count,
+			5,
+			[&sets] -> std::vector<set_type> { return sets; },
+			[&grants](std::vector<set_type>& destination) -> void
+			{
+				for (std::size_t i = 0; i < destination.size(); ++i)
+				{
+					for (const auto value: grants[i])
+					{
+						destination[i].insert(value);
+					}
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("unite {} x {}", entity_count, enum_name),
+			entity_count,
+			5,
+			[&sets] -> std::vector<set_type> { return sets; },
+			[&grants](std::vector<set_type>& destination) -> void
+			{
+				set_type::unite(destination, grants);
+			}
+		);
+
+		benchmark::run(
+			std::format("intersect {} x {}", entity_count, enum_name),
+			entity_count,
+			5,
+			[&sets] -> std::vector<set_type> { return sets; },
+			[&grants](std::vector<set_type>& destination) -> void
+			{
+				set_type::intersect(destination, grants);
+			}
+		);
+
+		benchmark::run(
+			std::format("contains each member {} x {}", entity_count, enum_name),
+			entity_count,
+			5,
+			[&sets, first, second] -> void
+			{
+				std::size_t count = 0;
+				for (const auto& set: sets)
+				{
+					count += set.contains(first) and set.contains(second) ? 1 : 0;
+				}
+				benchmark::do_not_optimize(count);
+			}
+		);
+
+		benchmark::run(
+			std::format("count_superset {} x {}", entity_count, enum_name),
+			entity_count,
+			5,
+			[&sets, first, second] -> void
+			{
+				benchmark::do_not_optimize(set_type::count_superset(sets, {first, second}));
+			}
+		);
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"container.enum_set",
+			[] -> void
+			{
+				run_all<Permission>("Permission", Permission::READ, Permission::WRITE);
+				run_all<Capability>("Capability", Capability::FIRST, Capability::LAST);
+			}
+	};
+}
@@ -0,0 +1,125 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <format>
+
+// container::FlatHashMap
+#include <prometheus/container/container.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	constexpr std::size_t key_count = 1'000'000;
+
+	[[nodiscard]] auto make_integers(const std::uint64_t seed) -> std::vector<std::uint64_t>
+	{
+		std::vector<std::uint64_t> keys{};
+		keys.reserve(key_count);
+
+		std::uint64_t state = seed;
+		for (std::size_t i = 0; i < key_count; ++i)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+			keys.push_back(state >> 11);
+		}
+
+		return keys;
+	}
+
+	// 8~32 characters
+	[[nodiscard]] auto make_strings(const std::uint64_t seed) -> std::vector<std::string>
+	{
+		std::vector<std::string> keys{};
+		keys.reserve(key_count);
+
+		std::uint64_t state = seed;
+		for (std::size_t i = 0; i < key_count; ++i)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+			keys.push_back(std::format("key_{:0{}}", state >> 20, 4 + (state >> 8) % 25));
+		}
+
+		return keys;
+	}
+
+	template<typename Map, typename Key>
+	auto run_all(const std::string_view map_name, const std::string_view key_name, const std::vector<Key>& keys, const std::vector<Key>& missing_keys) -> void
+	{
+		benchmark::run(
+			std::format("{} insert {} {}", map_name, key_count, key_name),
+			key_count,
+			5,
+			[] -> Map { return Map{}; },
+			[&keys](Map& map) -> void
+			{
+				for (const auto& key: keys)
+				{
+					map.try_emplace(key, 0);
+				}
+			}
+		);
+
+		Map map{};
+		for (const auto& key: keys)
+		{
+			map.try_emplace(key, 0);
+		}
+
+		benchmark::run(
+			std::format("{} find (hit) {} {}", map_name, key_count, key_name),
+			key_count,
+			5,
+			[&map, &keys] -> void
+			{
+				for (const auto& key: keys)
+				{
+					benchmark::do_not_optimize(map.find(key));
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("{} find (miss) {} {}", map_name, key_count, key_name),
+			key_count,
+			5,
+			[&map, &missing_keys] -> void
+			{
+				for (const auto& key: missing_keys)
+				{
+					benchmark::do_not_optimize(map.find(key));
+				}
+			}
+		);
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"container.flat_hash_map",
+			[] -> void
+			{
+				{
+					const auto keys = make_integers(42);
+					const auto missing_keys = make_integers(1337);
+
+					run_all<std::unordered_map<std::uint64_t, std::uint64_t>>("std::unordered_map", "integers", keys, missing_keys);
+					run_all<container::FlatHashMap<std::uint64_t, std::uint64_t>>("FlatHashMap", "integers", keys, missing_keys);
+				}
+
+				{
+					const auto keys = make_strings(42);
+					const auto missing_keys = make_strings(1337);
+
+					run_all<std::unordered_map<std::string, std::uint64_t>>("std::unordered_map", "strings", keys, missing_keys);
+					run_all<container::FlatHashMap<std::string, std::uint64_t>>("FlatHashMap", "strings", keys, missing_keys);
+				}
+			}
+	};
+}
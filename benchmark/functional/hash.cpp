@@ -0,0 +1,117 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <string>
+#include <string_view>
+#include <format>
+
+// functional::hash
+#include <prometheus/functional/hash.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	constexpr std::size_t byte_count = 64 * 1024 * 1024;
+
+	// the byte-wise FNV-1a (the previous implementation of `hash<std::string>`)
+	[[nodiscard]] auto fnv1a(const std::string_view string) noexcept -> functional::hash_result_type
+	{
+		std::uint64_t result = 14695981039346656037ull;
+		for (const auto c: string)
+		{
+			result ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+			result *= 1099511628211ull;
+		}
+		return result;
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"functional.hash",
+			[] -> void
+			{
+				std::string text{};
+				text.reserve(byte_count);
+				for (std::size_t i = 0; text.size() < byte_count; ++i)
+				{
+					text.push_back(static_cast<char>('a' + i * 7 % 26));
+				}
+
+				for (const std::size_t size: {8, 16, 32, 64, 256, 1024, 64 * 1024})
+				{
+					const auto count = byte_count / size;
+
+					benchmark::run(
+						std::format("fnv1a {} x {} bytes", count, size),
+						byte_count,
+						5,
+						[&text, size, count] -> void
+						{
+							for (std::size_t i = 0; i < count; ++i)
+							{
+								benchmark::do_not_optimize(fnv1a(std::string_view{text}.substr(i * size, size)));
+							}
+						}
+					);
+
+					benchmark::run(
+						std::format("hash_64 {} x {} bytes", count, size),
+						byte_count,
+						5,
+						[&text, size, count] -> void
+						{
+							for (std::size_t i = 0; i < count; ++i)
+							{
+								benchmark::do_not_optimize(functional::hash_64(std::string_view{text}.substr(i * size, size)));
+							}
+						}
+					);
+
+					benchmark::run(
+						std::format("hash_128 {} x {} bytes", count, size),
+						byte_count,
+						5,
+						[&text, size, count] -> void
+						{
+							for (std::size_t i = 0; i < count; ++i)
+							{
+								benchmark::do_not_optimize(functional::hash_128(std::string_view{text}.substr(i * size, size)));
+							}
+						}
+					);
+				}
+
+				for (const std::size_t chunk: {64, 1024, 64 * 1024})
+				{
+					benchmark::run(
+						std::format("Hasher {} bytes in {} bytes chunks", byte_count, chunk),
+						byte_count,
+						5,
+						[&text, chunk] -> void
+						{
+							functional::Hasher hasher{};
+							for (std::size_t i = 0; i < byte_count; i += chunk)
+							{
+								hasher.update(std::string_view{text}.substr(i, chunk));
+							}
+							benchmark::do_not_optimize(hasher.finalize());
+						}
+					);
+				}
+
+				benchmark::run(
+					std::format("hash_64 {} bytes", byte_count),
+					byte_count,
+					5,
+					[&text] -> void
+					{
+						benchmark::do_not_optimize(functional::hash_64(text));
+					}
+				);
+			}
+	};
+}
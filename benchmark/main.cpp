@@ -0,0 +1,28 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <span>
+
+#include "benchmark.hpp"
+
+// Usage: PrometheusCoreBenchmark [suite-name...]
+// Run all suites if no suite name is given.
+auto main(const int argc, char* argv[]) -> int
+{
+	const std::span arguments{argv + 1, static_cast<std::size_t>(argc - 1)};
+
+	for (const auto& [name, function]: benchmark::suites())
+	{
+		if (not arguments.empty() and std::ranges::none_of(arguments, [name](const std::string_view argument) noexcept -> bool { return argument == name; }))
+		{
+			continue;
+		}
+
+		std::println("[suite] {}", name);
+		std::invoke(function);
+	}
+
+	return 0;
+}
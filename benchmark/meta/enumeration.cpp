@@ -0,0 +1,181 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <string_view>
+#include <vector>
+#include <format>
+#include <algorithm>
+#include <ranges>
+
+// meta::enumeration
+#include <prometheus/meta/enumeration.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+// E0 ~ E7
+#define ENUMERATION_VALUES_8(prefix) prefix##0, prefix##1, prefix##2, prefix##3, prefix##4, prefix##5, prefix##6, prefix##7
+// E00 ~ E77
+#define ENUMERATION_VALUES_64(prefix)                                                                                   \
+	ENUMERATION_VALUES_8(prefix##0), ENUMERATION_VALUES_8(prefix##1), ENUMERATION_VALUES_8(prefix##2),                  \
+	ENUMERATION_VALUES_8(prefix##3), ENUMERATION_VALUES_8(prefix##4), ENUMERATION_VALUES_8(prefix##5),                  \
+	ENUMERATION_VALUES_8(prefix##6), ENUMERATION_VALUES_8(prefix##7)
+// E000 ~ E777
+#define ENUMERATION_VALUES_512(prefix)                                                                                  \
+	ENUMERATION_VALUES_64(prefix##0), ENUMERATION_VALUES_64(prefix##1), ENUMERATION_VALUES_64(prefix##2),               \
+	ENUMERATION_VALUES_64(prefix##3), ENUMERATION_VALUES_64(prefix##4), ENUMERATION_VALUES_64(prefix##5),               \
+	ENUMERATION_VALUES_64(prefix##6), ENUMERATION_VALUES_64(prefix##7)
+
+namespace
+{
+	enum class Enum8 : std::uint16_t
+	{
+		ENUMERATION_VALUES_8(E)
+	};
+
+	enum class Enum64 : std::uint16_t
+	{
+		ENUMERATION_VALUES_64(E)
+	};
+
+	enum class Enum512 : std::uint16_t
+	{
+		ENUMERATION_VALUES_512(E)
+	};
+}
+
+template<>
+struct meta::user_defined::enum_range<Enum512>
+{
+	constexpr static auto min = 0;
+	constexpr static auto max = 511;
+};
+
+namespace
+{
+	constexpr std::size_t lookup_count = 1'000'000;
+
+	// the previous implementation of `value_of`
+	template<typename EnumType>
+	[[nodiscard]] auto linear_value_of(const std::string_view name) noexcept -> EnumType
+	{
+		constexpr auto list = meta::names_of<EnumType>();
+
+		if (const auto it = std::ranges::find(list | std::views::values, name);
+			it != std::ranges::end(list | std::views::values))
+		{
+			return it.base()->first;
+		}
+		return static_cast<EnumType>(0);
+	}
+
+	// the previous implementation of `name_of`
+	template<typename EnumType>
+	[[nodiscard]] auto linear_name_of(const EnumType value) noexcept -> std::string_view
+	{
+		constexpr auto list = meta::names_of<EnumType>();
+
+		if (const auto it = std::ranges::find(list | std::views::keys, value);
+			it != std::ranges::end(list | std::views::keys))
+		{
+			return it.base()->second;
+		}
+		return meta::enum_name_not_found;
+	}
+
+	template<typename EnumType>
+	auto run_all(const std::string_view enum_name) -> void
+	{
+		constexpr auto list = meta::names_of<EnumType>();
+
+		// every name in a scattered order, and some misses
+		std::vector<std::string_view> names{};
+		names.reserve(lookup_count);
+		std::uint64_t state = 42;
+		for (std::size_t i = 0; i < lookup_count; ++i)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+			if (const auto index = (state >> 33) % (list.size() + list.size() / 8);
+				index < list.size())
+			{
+				names.push_back(list[index].second);
+			}
+			else
+			{
+				names.emplace_back("NotAnEnumerator");
+			}
+		}
+
+		benchmark::run(
+			std::format("linear value_of {} x {}", lookup_count, enum_name),
+			lookup_count,
+			5,
+			[&names] -> void
+			{
+				for (const auto name: names)
+				{
+					benchmark::do_not_optimize(linear_value_of<EnumType>(name));
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("value_of {} x {}", lookup_count, enum_name),
+			lookup_count,
+			5,
+			[&names] -> void
+			{
+				for (const auto name: names)
+				{
+					benchmark::do_not_optimize(meta::value_of<EnumType>(name));
+				}
+			}
+		);
+
+		std::vector<EnumType> values{};
+		values.reserve(lookup_count);
+		for (const auto name: names)
+		{
+			values.push_back(meta::value_of<EnumType>(name));
+		}
+
+		benchmark::run(
+			std::format("linear name_of {} x {}", lookup_count, enum_name),
+			lookup_count,
+			5,
+			[&values] -> void
+			{
+				for (const auto value: values)
+				{
+					benchmark::do_not_optimize(linear_name_of(value));
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("name_of {} x {}", lookup_count, enum_name),
+			lookup_count,
+			5,
+			[&values] -> void
+			{
+				for (const auto value: values)
+				{
+					benchmark::do_not_optimize(meta::name_of(value));
+				}
+			}
+		);
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"meta.enumeration",
+			[] -> void
+			{
+				run_all<Enum8>("Enum8");
+				run_all<Enum64>("Enum64");
+				run_all<Enum512>("Enum512");
+			}
+	};
+}
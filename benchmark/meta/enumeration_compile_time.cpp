@@ -0,0 +1,95 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// Compile time of the enumeration reflection, nothing here runs.
+// This file is compiled twice (see benchmark/CMakeLists.txt, target PrometheusCoreBenchmarkCompileTime):
+// PROMETHEUS_BENCHMARK_ENUMERATION_LINEAR defined => every candidate value is checked by its own instantiation (the previous implementation)
+// otherwise => meta::enumeration (one instantiation per 64 candidate values)
+
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+// meta::enumeration
+#include <prometheus/meta/enumeration.hpp>
+
+using namespace prometheus;
+
+// E0 ~ E7
+#define ENUMERATION_VALUES_8(prefix) prefix##0, prefix##1, prefix##2, prefix##3, prefix##4, prefix##5, prefix##6, prefix##7
+// F0 ~ F7
+#define ENUMERATION_FLAGS_8(prefix) \
+	prefix##0 = 1 << 0, prefix##1 = 1 << 3, prefix##2 = 1 << 6, prefix##3 = 1 << 9, prefix##4 = 1 << 12, prefix##5 = 1 << 15, prefix##6 = 1 << 18, prefix##7 = 1 << 21
+
+#define DECLARE_ENUMERATION(index)                                                  \
+	namespace                                                                       \
+	{                                                                               \
+		enum class Enum##index : std::uint8_t                                       \
+		{                                                                           \
+			ENUMERATION_VALUES_8(E)                                                 \
+		};                                                                          \
+                                                                                    \
+		enum class Wide##index : std::uint16_t                                      \
+		{                                                                           \
+			ENUMERATION_VALUES_8(E),                                                \
+			Last = 1023                                                             \
+		};                                                                          \
+                                                                                    \
+		enum class Flag##index : std::uint32_t                                      \
+		{                                                                           \
+			ENUMERATION_FLAGS_8(F)                                                  \
+		};                                                                          \
+	}                                                                               \
+                                                                                    \
+	template<>                                                                      \
+	struct meta::user_defined::enum_range<Wide##index>                              \
+	{                                                                               \
+		constexpr static auto min = 0;                                              \
+		constexpr static auto max = 1023;                                           \
+	};                                                                              \
+                                                                                    \
+	template<>                                                                      \
+	struct meta::user_defined::enum_is_flag<Flag##index> : std::true_type {};       \
+                                                                                    \
+	static_assert(collect_size<Enum##index, enumeration_detail::enum_candidates<Enum##index>>() == 8); \
+	static_assert(collect_size<Wide##index, enumeration_detail::enum_candidates<Wide##index>>() == 9); \
+	static_assert(collect_size<Flag##index, enumeration_detail::flag_candidates<Flag##index, enumeration_detail::FlagBehavior::ALLOW_COMBINATION>>() == 8)
+
+namespace
+{
+	namespace enumeration_detail = meta::enumeration_detail;
+
+	template<typename EnumType, typename Candidates>
+	[[nodiscard]] constexpr auto collect_size() noexcept -> std::size_t
+	{
+#if defined(PROMETHEUS_BENCHMARK_ENUMERATION_LINEAR)
+		return []<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> std::size_t
+		{
+			std::size_t size = 0;
+			((size += enumeration_detail::is_valid_enum<EnumType, Candidates::at(Index)>() ? 1 : 0), ...);
+			return size;
+		}(std::make_index_sequence<Candidates::size>{});
+#else
+		return enumeration_detail::probe_values<EnumType, Candidates>().size();
+#endif
+	}
+}
+
+DECLARE_ENUMERATION(0);
+DECLARE_ENUMERATION(1);
+DECLARE_ENUMERATION(2);
+DECLARE_ENUMERATION(3);
+DECLARE_ENUMERATION(4);
+DECLARE_ENUMERATION(5);
+DECLARE_ENUMERATION(6);
+DECLARE_ENUMERATION(7);
+DECLARE_ENUMERATION(8);
+DECLARE_ENUMERATION(9);
+DECLARE_ENUMERATION(10);
+DECLARE_ENUMERATION(11);
+DECLARE_ENUMERATION(12);
+DECLARE_ENUMERATION(13);
+DECLARE_ENUMERATION(14);
+DECLARE_ENUMERATION(15);
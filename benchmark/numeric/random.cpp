@@ -0,0 +1,83 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <format>
+
+// numeric::random
+#include <prometheus/numeric/random.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	// the buffer stays in the cache (otherwise it is the bandwidth of the memory which is measured)
+	constexpr std::size_t buffer_size = 1 << 13;
+	constexpr std::size_t rounds = 1024;
+	constexpr std::size_t value_count = buffer_size * rounds;
+
+	template<typename Engine, typename T>
+	auto run_all(const std::string_view engine_name, const std::string_view type_name, const T from, const T to) -> void
+	{
+		using random_type = numeric::Random<numeric::RandomStateCategory::PRIVATE, Engine>;
+
+		std::vector<T> values(buffer_size);
+
+		benchmark::run(
+			std::format("get {} x {} [{}, {}] ({})", value_count, type_name, from, to, engine_name),
+			value_count,
+			5,
+			[&values, from, to] -> void
+			{
+				random_type random{Engine{42}};
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					for (auto& value: values)
+					{
+						value = random.template get<T>(from, to);
+					}
+					benchmark::do_not_optimize(values.data());
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("fill {} x {} [{}, {}] ({})", value_count, type_name, from, to, engine_name),
+			value_count,
+			5,
+			[&values, from, to] -> void
+			{
+				random_type random{Engine{42}};
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					random.template fill<T>(values, from, to);
+					benchmark::do_not_optimize(values.data());
+				}
+			}
+		);
+	}
+
+	template<typename Engine>
+	auto run_all(const std::string_view engine_name) -> void
+	{
+		run_all<Engine, int>(engine_name, "int", 0, 999);
+		run_all<Engine, std::uint64_t>(engine_name, "uint64", 0, (std::uint64_t{1} << 63) + 1);
+		run_all<Engine, float>(engine_name, "float", -1, 1);
+		run_all<Engine, double>(engine_name, "double", 0, 1);
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"numeric.random",
+			[] -> void
+			{
+				run_all<numeric::random_engine_xrsr_128_star_star>("xoroshiro128**");
+				run_all<numeric::random_engine_x8<numeric::random_engine_xsr_256_plus_plus>>("xoshiro256++ x8");
+			}
+	};
+}
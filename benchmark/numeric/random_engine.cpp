@@ -0,0 +1,143 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <format>
+
+// numeric::random_engine
+#include <prometheus/numeric/random_engine.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	// the buffer stays in the cache (otherwise it is the bandwidth of the memory which is measured)
+	constexpr std::size_t buffer_size = 1 << 13;
+	constexpr std::size_t rounds = 2048;
+	constexpr std::size_t value_count = buffer_size * rounds;
+
+	template<typename Engine>
+	auto run_all(const std::string_view engine_name) -> void
+	{
+		using result_type = Engine::result_type;
+
+		std::vector<result_type> values(buffer_size);
+
+		benchmark::run(
+			std::format("next {} x {}", value_count, engine_name),
+			value_count,
+			5,
+			[&values] -> void
+			{
+				Engine engine{42};
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					for (auto& value: values)
+					{
+						value = engine.next();
+					}
+					benchmark::do_not_optimize(values.data());
+				}
+			}
+		);
+
+		const auto run_lanes = [&values, engine_name]<std::size_t Lanes>() -> void
+		{
+			benchmark::run(
+				std::format("generate {} x {} (x{})", value_count, engine_name, Lanes),
+				value_count,
+				5,
+				[&values] -> void
+				{
+					numeric::RandomEngineLanes<Engine, Lanes> engine{42};
+					for (std::size_t round = 0; round < rounds; ++round)
+					{
+						engine.generate(values);
+						benchmark::do_not_optimize(values.data());
+					}
+				}
+			);
+		};
+
+		run_lanes.template operator()<4>();
+		run_lanes.template operator()<8>();
+		run_lanes.template operator()<16>();
+	}
+
+	auto run_philox() -> void
+	{
+		using engine_type = numeric::random_engine_philox_4x32;
+
+		std::vector<engine_type::result_type> values(buffer_size);
+
+		benchmark::run(
+			std::format("next {} x philox4x32", value_count),
+			value_count,
+			5,
+			[&values] -> void
+			{
+				engine_type engine{42};
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					for (auto& value: values)
+					{
+						value = engine.next();
+					}
+					benchmark::do_not_optimize(values.data());
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("at {} x philox4x32", value_count),
+			value_count,
+			5,
+			[&values] -> void
+			{
+				const engine_type engine{42};
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					for (std::size_t i = 0; i < values.size(); ++i)
+					{
+						values[i] = engine.at(round * values.size() + i);
+					}
+					benchmark::do_not_optimize(values.data());
+				}
+			}
+		);
+
+		benchmark::run(
+			std::format("generate {} x philox4x32", value_count),
+			value_count,
+			5,
+			[&values] -> void
+			{
+				engine_type engine{42};
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					engine.generate(values);
+					benchmark::do_not_optimize(values.data());
+				}
+			}
+		);
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"numeric.random_engine",
+			[] -> void
+			{
+				run_all<numeric::random_engine_xsr_128_plus_plus>("xoshiro128++");
+				run_all<numeric::random_engine_xrsr_128_plus>("xoroshiro128+");
+				run_all<numeric::random_engine_xsr_256_plus_plus>("xoshiro256++");
+				run_all<numeric::random_engine_xsr_256_star_star>("xoshiro256**");
+				run_all<numeric::random_engine_xsr_512_plus_plus>("xoshiro512++");
+				run_philox();
+			}
+	};
+}
@@ -0,0 +1,319 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <format>
+#include <charconv>
+#include <bit>
+
+// string::charconv
+#include <prometheus/string/string.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	constexpr std::size_t character_count = 16 * 1024 * 1024;
+	constexpr std::size_t short_string_count = 1'000'000;
+	constexpr std::size_t field_count = 1'000'000;
+	constexpr std::size_t floating_point_count = 1'000'000;
+
+	// ASCII words of 1~11 characters
+	[[nodiscard]] auto make_text() -> std::string
+	{
+		std::string text{};
+		text.reserve(character_count);
+
+		for (std::size_t i = 0; text.size() < character_count; ++i)
+		{
+			text.append(1 + i % 11, static_cast<char>((i % 2 == 0 ? 'a' : 'A') + i % 26));
+			text.push_back(' ');
+		}
+
+		text.resize(character_count);
+		return text;
+	}
+
+	// `field_count` integers (0~10 digits, some negative) separated by `,`
+	[[nodiscard]] auto make_csv() -> std::string
+	{
+		std::string csv{};
+
+		std::uint64_t state = 42;
+		for (std::size_t i = 0; i < field_count; ++i)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+
+			const auto value = static_cast<std::int64_t>(state >> 33) >> (state % 31);
+			csv.append(std::to_string(i % 4 == 0 ? -value : value));
+			csv.push_back(',');
+		}
+		csv.pop_back();
+
+		return csv;
+	}
+
+	// half of them have a few digits (e.g. `12.345`), the others need 15~17 digits
+	[[nodiscard]] auto make_doubles() -> std::vector<double>
+	{
+		std::vector<double> values{};
+		values.reserve(floating_point_count);
+
+		std::uint64_t state = 42;
+		for (std::size_t i = 0; i < floating_point_count; ++i)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+
+			if (i % 2 == 0)
+			{
+				values.push_back(static_cast<double>(state >> 44) / 1000);
+			}
+			else
+			{
+				values.push_back(std::bit_cast<double>((state >> 12) | 0x4000'0000'0000'0000) * static_cast<double>(1 + i % 1000));
+			}
+		}
+
+		return values;
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"string.charconv",
+			[] -> void
+			{
+				const auto text = make_text();
+				const std::string upper(character_count, 'A');
+
+				benchmark::run(
+					std::format("is_upper {} characters (scalar)", character_count),
+					character_count,
+					5,
+					[&upper] -> void
+					{
+						benchmark::do_not_optimize(std::ranges::all_of(upper, [](const char c) noexcept -> bool { return string::is_upper(c); }));
+					}
+				);
+
+				benchmark::run(
+					std::format("is_upper {} characters", character_count),
+					character_count,
+					5,
+					[&upper] -> void
+					{
+						benchmark::do_not_optimize(string::is_upper(std::string_view{upper}));
+					}
+				);
+
+				benchmark::run(
+					std::format("to_upper {} characters (scalar)", character_count),
+					character_count,
+					5,
+					[&text] -> std::string { return text; },
+					[](std::string& s) -> void
+					{
+						for (auto& c: s)
+						{
+							c = string::to_upper(c);
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("to_upper {} characters", character_count),
+					character_count,
+					5,
+					[&text] -> std::string { return text; },
+					[](std::string& s) -> void
+					{
+						string::to_upper(s);
+					}
+				);
+
+				benchmark::run(
+					std::format("to_upper {} short strings (allocating)", short_string_count),
+					short_string_count,
+					5,
+					[&text] -> void
+					{
+						for (std::size_t i = 0; i < short_string_count; ++i)
+						{
+							benchmark::do_not_optimize(string::to_upper(std::string_view{text}.substr(i, 24)));
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("to_upper {} short strings (reused buffer)", short_string_count),
+					short_string_count,
+					5,
+					[&text] -> void
+					{
+						std::string buffer{};
+						for (std::size_t i = 0; i < short_string_count; ++i)
+						{
+							buffer.clear();
+							string::to_upper(std::string_view{text}.substr(i, 24), buffer);
+							benchmark::do_not_optimize(buffer);
+						}
+					}
+				);
+
+				const auto csv = make_csv();
+
+				benchmark::run(
+					std::format("from_string {} integers (one by one)", field_count),
+					field_count,
+					5,
+					[] -> std::vector<std::int64_t> { return std::vector<std::int64_t>(field_count); },
+					[&csv](std::vector<std::int64_t>& values) -> void
+					{
+						std::string_view rest{csv};
+						for (auto& value: values)
+						{
+							const auto field = rest.substr(0, rest.find(','));
+							value = string::from_string<std::int64_t>(field).value_or(0);
+							rest.remove_prefix(std::ranges::min(field.size() + 1, rest.size()));
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("from_string {} integers (batch)", field_count),
+					field_count,
+					5,
+					[] -> std::pair<std::vector<std::int64_t>, std::vector<std::uint64_t>>
+					{
+						return {std::vector<std::int64_t>(field_count), std::vector<std::uint64_t>((field_count + 63) / 64)};
+					},
+					[&csv](std::pair<std::vector<std::int64_t>, std::vector<std::uint64_t>>& state) -> void
+					{
+						auto& [values, errors] = state;
+						benchmark::do_not_optimize(string::from_string<std::int64_t>(csv, ',', std::span{values}, std::span{errors}));
+					}
+				);
+
+				const auto doubles = make_doubles();
+
+				benchmark::run(
+					std::format("to_chars {} doubles (std::to_chars)", floating_point_count),
+					floating_point_count,
+					5,
+					[&doubles] -> void
+					{
+						char buffer[64];
+						for (const auto value: doubles)
+						{
+							benchmark::do_not_optimize(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("to_chars {} doubles", floating_point_count),
+					floating_point_count,
+					5,
+					[&doubles] -> void
+					{
+						char buffer[64];
+						for (const auto value: doubles)
+						{
+							benchmark::do_not_optimize(string::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("to_chars {} floats (std::to_chars)", floating_point_count),
+					floating_point_count,
+					5,
+					[&doubles] -> void
+					{
+						char buffer[64];
+						for (const auto value: doubles)
+						{
+							benchmark::do_not_optimize(std::to_chars(buffer, buffer + sizeof(buffer), static_cast<float>(value)).ptr);
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("to_chars {} floats", floating_point_count),
+					floating_point_count,
+					5,
+					[&doubles] -> void
+					{
+						char buffer[64];
+						for (const auto value: doubles)
+						{
+							benchmark::do_not_optimize(string::to_chars(buffer, buffer + sizeof(buffer), static_cast<float>(value)).ptr);
+						}
+					}
+				);
+
+				std::string doubles_text{};
+				std::vector<std::string_view> double_fields{};
+				{
+					std::vector<std::size_t> offsets{};
+					for (const auto value: doubles)
+					{
+						char buffer[64];
+						const auto last = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+
+						offsets.push_back(doubles_text.size());
+						doubles_text.append(buffer, last);
+					}
+					offsets.push_back(doubles_text.size());
+
+					for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+					{
+						double_fields.emplace_back(doubles_text.data() + offsets[i], offsets[i + 1] - offsets[i]);
+					}
+				}
+
+				benchmark::run(
+					std::format("from_string {} doubles (std::from_chars)", floating_point_count),
+					floating_point_count,
+					5,
+					[&double_fields] -> void
+					{
+						for (const auto field: double_fields)
+						{
+							double value;
+							std::from_chars(field.data(), field.data() + field.size(), value);
+							benchmark::do_not_optimize(value);
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("from_string {} doubles", floating_point_count),
+					floating_point_count,
+					5,
+					[&double_fields] -> void
+					{
+						for (const auto field: double_fields)
+						{
+							benchmark::do_not_optimize(string::from_string<double>(field));
+						}
+					}
+				);
+
+				benchmark::run(
+					std::format("to_title {} characters", character_count),
+					character_count,
+					5,
+					[&text] -> std::string { return text; },
+					[](std::string& s) -> void
+					{
+						string::to_title(s);
+					}
+				);
+			}
+	};
+}
@@ -0,0 +1,95 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <vector>
+#include <utility>
+#include <format>
+
+// string::string_pool
+#include <prometheus/string/string.hpp>
+
+#include "../benchmark.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	constexpr std::size_t string_count = 1'000'000;
+
+	// 4~19 characters
+	[[nodiscard]] auto make_short_strings() -> std::vector<std::string>
+	{
+		std::vector<std::string> strings{};
+		strings.reserve(string_count);
+
+		for (std::size_t i = 0; i < string_count; ++i)
+		{
+			strings.emplace_back(4 + (i * 7) % 16, static_cast<char>('a' + i % 26));
+		}
+
+		return strings;
+	}
+
+	// A pool with `block_count` partially filled blocks of different available space (0~31 characters).
+	[[nodiscard]] auto make_pool(const std::size_t block_count) -> string::StringPool<>
+	{
+		constexpr std::size_t block_size = 64;
+
+		string::StringPool<> pool{block_size};
+
+		for (std::size_t i = 0; i < block_count; ++i)
+		{
+			// +1 => null terminator
+			const auto length = block_size - 1 - (i * 13) % 32;
+			std::ignore = pool.add(std::string(length, 'x'));
+		}
+
+		pool.reset_block_initial_size(string::StringPool<>::default_block_initial_size);
+		return pool;
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY benchmark::suite _{
+			"string.string_pool",
+			[] -> void
+			{
+				const auto strings = make_short_strings();
+
+				for (const auto block_count: {std::size_t{10}, std::size_t{1'000}, std::size_t{100'000}})
+				{
+					benchmark::run(
+						std::format("add {} short strings ({} blocks)", string_count, block_count),
+						string_count,
+						5,
+						[block_count] -> string::StringPool<> { return make_pool(block_count); },
+						[&strings](string::StringPool<>& pool) -> void
+						{
+							for (const auto& string: strings)
+							{
+								benchmark::do_not_optimize(pool.add(string));
+							}
+						}
+					);
+				}
+
+				benchmark::run(
+					std::format("add_range {} short strings", string_count),
+					string_count,
+					5,
+					[] -> std::pair<string::StringPool<>, std::vector<std::string_view>>
+					{
+						std::vector<std::string_view> views{};
+						views.reserve(string_count);
+
+						return {string::StringPool<>{}, std::move(views)};
+					},
+					[&strings](std::pair<string::StringPool<>, std::vector<std::string_view>>& state) -> void
+					{
+						auto& [pool, views] = state;
+						pool.add_range(strings, std::back_inserter(views));
+					}
+				);
+			}
+	};
+}
@@ -0,0 +1,9 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <prometheus/container/flat_hash_map.hpp>
+#include <prometheus/container/enum_set.hpp>
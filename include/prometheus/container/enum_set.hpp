@@ -0,0 +1,499 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <span>
+#include <bit>
+#include <algorithm>
+#include <ranges>
+#include <limits>
+#include <iterator>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/meta/enumeration.hpp>
+#include <prometheus/platform/os.hpp>
+
+namespace prometheus::container
+{
+	namespace enum_set_detail
+	{
+		// non-flag: MyEnum::E => bit (E - min_value_of<MyEnum>()), the bits cover [min_value_of<MyEnum>(), max_value_of<MyEnum>()]
+		// flag: MyFlag::F => bit (countr_zero(F) - min), the bits cover the lowest to the highest bit of all named values (min is the lowest)
+		template<typename EnumType>
+		struct layout
+		{
+			using value_type = EnumType;
+			using underlying_type = std::underlying_type_t<value_type>;
+			using unsigned_type = std::make_unsigned_t<underlying_type>;
+
+			constexpr static auto is_flag = meta::is_flag<value_type>();
+
+			// all bits of all named values (flag only)
+			constexpr static auto flag_bits = []() noexcept -> unsigned_type
+			{
+				unsigned_type bits = 0;
+				for (const auto value: meta::names_of<value_type>() | std::views::keys)
+				{
+					bits |= static_cast<unsigned_type>(value);
+				}
+				return bits;
+			}();
+
+			constexpr static auto min = []() noexcept -> unsigned_type
+			{
+				if constexpr (is_flag)
+				{
+					return flag_bits == 0 ? 0 : static_cast<unsigned_type>(std::countr_zero(flag_bits));
+				}
+				else
+				{
+					return static_cast<unsigned_type>(meta::min_value_of<value_type>());
+				}
+			}();
+
+			constexpr static std::size_t bit_count = []() noexcept -> std::size_t
+			{
+				if constexpr (is_flag)
+				{
+					return static_cast<std::size_t>(std::bit_width(flag_bits)) - min;
+				}
+				else
+				{
+					// note: computed in the unsigned type, a signed range does not overflow
+					return static_cast<std::size_t>(static_cast<unsigned_type>(static_cast<unsigned_type>(meta::max_value_of<value_type>()) - min)) + 1;
+				}
+			}();
+
+			// the smallest word that holds all bits, a set of 8 enumerators is 1 byte
+			using word_type = std::conditional_t<
+				(bit_count <= 8),
+				std::uint8_t,
+				std::conditional_t<
+					(bit_count <= 16),
+					std::uint16_t,
+					std::conditional_t<(bit_count <= 32), std::uint32_t, std::uint64_t>
+				>
+			>;
+
+			constexpr static std::size_t word_bits = std::numeric_limits<word_type>::digits;
+			constexpr static std::size_t word_count = std::ranges::max((bit_count + word_bits - 1) / word_bits, std::size_t{1});
+
+			using words_type = std::array<word_type, word_count>;
+
+			[[nodiscard]] constexpr static auto value_of(const std::size_t index) noexcept -> value_type
+			{
+				if constexpr (is_flag)
+				{
+					return static_cast<value_type>(static_cast<unsigned_type>(unsigned_type{1} << (min + index)));
+				}
+				else
+				{
+					return static_cast<value_type>(static_cast<unsigned_type>(min + index));
+				}
+			}
+
+			// bits of `value` in the words (a flag value may have several bits), nothing is set if `value` is out of range
+			constexpr static auto set_bits(words_type& words, const value_type value) noexcept -> bool
+			{
+				if constexpr (is_flag)
+				{
+					const auto bits = static_cast<unsigned_type>(value);
+					if ((bits & flag_bits) != bits)
+					{
+						return false;
+					}
+
+					words[0] |= static_cast<word_type>(bits >> min);
+					return true;
+				}
+				else
+				{
+					const auto index = static_cast<std::size_t>(static_cast<unsigned_type>(static_cast<unsigned_type>(value) - min));
+					if (index >= bit_count)
+					{
+						return false;
+					}
+
+					words[index / word_bits] |= static_cast<word_type>(word_type{1} << (index % word_bits));
+					return true;
+				}
+			}
+
+			// all named values
+			constexpr static words_type valid = []() noexcept -> words_type
+			{
+				words_type words{};
+				for (const auto value: meta::names_of<value_type>() | std::views::keys)
+				{
+					set_bits(words, value);
+				}
+				return words;
+			}();
+		};
+	}
+
+	/**
+	 * @brief A set of the values of @c EnumType, one bit per value.
+	 * @note Non-flag enumerations use the bits [min_value_of, max_value_of], flag enumerations use the bits of their named values,
+	 * the bits of a flag combination are the bits of each of its flags (@c insert(MyFlag::F1 | MyFlag::F2) inserts @c F1 and @c F2).
+	 * @note The set is a fixed array of words, an array of sets is one contiguous block that @c unite / @c intersect process at once.
+	 */
+	template<typename EnumType>
+		requires std::is_enum_v<EnumType>
+	class EnumSet
+	{
+		using layout_type = enum_set_detail::layout<EnumType>;
+
+	public:
+		using value_type = EnumType;
+		using size_type = std::size_t;
+		using word_type = layout_type::word_type;
+
+		constexpr static size_type bit_count = layout_type::bit_count;
+		constexpr static size_type word_count = layout_type::word_count;
+		constexpr static size_type word_bits = layout_type::word_bits;
+
+		class iterator
+		{
+			friend EnumSet;
+
+		public:
+			using iterator_concept = std::forward_iterator_tag;
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = EnumType;
+			using difference_type = std::ptrdiff_t;
+			using reference = value_type;
+			using pointer = void;
+
+		private:
+			const word_type* words_;
+			size_type index_;
+			// the bits of words_[index_] not visited yet
+			word_type bits_;
+
+			constexpr iterator(const word_type* words, const size_type index, const word_type bits) noexcept
+				: words_{words},
+				  index_{index},
+				  bits_{bits}
+			{
+				this->skip_empty();
+			}
+
+			constexpr auto skip_empty() noexcept -> void
+			{
+				while (bits_ == 0 and index_ + 1 < word_count)
+				{
+					++index_;
+					bits_ = words_[index_];
+				}
+
+				if (bits_ == 0)
+				{
+					index_ = word_count;
+				}
+			}
+
+		public:
+			constexpr iterator() noexcept
+				: words_{nullptr},
+				  index_{word_count},
+				  bits_{0} {}
+
+			[[nodiscard]] constexpr auto operator*() const noexcept -> reference
+			{
+				return layout_type::value_of(index_ * word_bits + static_cast<size_type>(std::countr_zero(bits_)));
+			}
+
+			constexpr auto operator++() noexcept -> iterator&
+			{
+				bits_ = static_cast<word_type>(bits_ & (bits_ - 1));
+				this->skip_empty();
+
+				return *this;
+			}
+
+			constexpr auto operator++(int) noexcept -> iterator
+			{
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+			[[nodiscard]] constexpr auto operator==(const iterator& other) const noexcept -> bool
+			{
+				return index_ == other.index_ and bits_ == other.bits_;
+			}
+		};
+
+		using const_iterator = iterator;
+
+	private:
+		layout_type::words_type words_;
+
+	public:
+		constexpr EnumSet() noexcept
+			: words_{} {}
+
+		// the values out of the range of the set are ignored
+		constexpr EnumSet(const std::initializer_list<value_type> values) noexcept
+			: words_{}
+		{
+			for (const auto value: values)
+			{
+				std::ignore = this->insert(value);
+			}
+		}
+
+		/**
+		 * @brief The set of all named values of @c EnumType.
+		 */
+		[[nodiscard]] constexpr static auto all() noexcept -> EnumSet
+		{
+			EnumSet result{};
+			result.words_ = layout_type::valid;
+			return result;
+		}
+
+		[[nodiscard]] constexpr auto operator==(const EnumSet& other) const noexcept -> bool = default;
+
+		// =============================================================================
+		// ELEMENT
+
+		/**
+		 * @return false if @c value is out of the range of the set (e.g. a flag with an unnamed bit), nothing is inserted.
+		 */
+		constexpr auto insert(const value_type value) noexcept -> bool
+		{
+			return layout_type::set_bits(words_, value);
+		}
+
+		// a value out of the range of the set is ignored
+		constexpr auto erase(const value_type value) noexcept -> void
+		{
+			typename layout_type::words_type bits{};
+			if (layout_type::set_bits(bits, value))
+			{
+				for (size_type i = 0; i < word_count; ++i)
+				{
+					words_[i] = static_cast<word_type>(words_[i] & ~bits[i]);
+				}
+			}
+		}
+
+		// flag: contains(MyFlag::F1 | MyFlag::F2) => contains(MyFlag::F1) and contains(MyFlag::F2)
+		[[nodiscard]] constexpr auto contains(const value_type value) const noexcept -> bool
+		{
+			typename layout_type::words_type bits{};
+			if (not layout_type::set_bits(bits, value))
+			{
+				return false;
+			}
+
+			for (size_type i = 0; i < word_count; ++i)
+			{
+				if ((words_[i] & bits[i]) != bits[i])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		constexpr auto clear() noexcept -> void
+		{
+			words_ = {};
+		}
+
+		[[nodiscard]] constexpr auto size() const noexcept -> size_type
+		{
+			size_type result = 0;
+			for (const auto word: words_)
+			{
+				result += static_cast<size_type>(std::popcount(word));
+			}
+			return result;
+		}
+
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool
+		{
+			return std::ranges::all_of(
+				words_,
+				[](const word_type word) noexcept -> bool
+				{
+					return word == 0;
+				}
+			);
+		}
+
+		[[nodiscard]] constexpr auto begin() const noexcept -> iterator
+		{
+			return {words_.data(), 0, words_[0]};
+		}
+
+		[[nodiscard]] constexpr auto end() const noexcept -> iterator
+		{
+			return {words_.data(), word_count, 0};
+		}
+
+		// =============================================================================
+		// SET
+
+		constexpr auto operator|=(const EnumSet& other) noexcept -> EnumSet&
+		{
+			for (size_type i = 0; i < word_count; ++i)
+			{
+				words_[i] |= other.words_[i];
+			}
+			return *this;
+		}
+
+		constexpr auto operator&=(const EnumSet& other) noexcept -> EnumSet&
+		{
+			for (size_type i = 0; i < word_count; ++i)
+			{
+				words_[i] &= other.words_[i];
+			}
+			return *this;
+		}
+
+		constexpr auto operator^=(const EnumSet& other) noexcept -> EnumSet&
+		{
+			for (size_type i = 0; i < word_count; ++i)
+			{
+				words_[i] ^= other.words_[i];
+			}
+			return *this;
+		}
+
+		// difference
+		constexpr auto operator-=(const EnumSet& other) noexcept -> EnumSet&
+		{
+			for (size_type i = 0; i < word_count; ++i)
+			{
+				words_[i] = static_cast<word_type>(words_[i] & ~other.words_[i]);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] friend constexpr auto operator|(EnumSet lhs, const EnumSet& rhs) noexcept -> EnumSet
+		{
+			return lhs |= rhs;
+		}
+
+		[[nodiscard]] friend constexpr auto operator&(EnumSet lhs, const EnumSet& rhs) noexcept -> EnumSet
+		{
+			return lhs &= rhs;
+		}
+
+		[[nodiscard]] friend constexpr auto operator^(EnumSet lhs, const EnumSet& rhs) noexcept -> EnumSet
+		{
+			return lhs ^= rhs;
+		}
+
+		[[nodiscard]] friend constexpr auto operator-(EnumSet lhs, const EnumSet& rhs) noexcept -> EnumSet
+		{
+			return lhs -= rhs;
+		}
+
+		// all() - *this
+		[[nodiscard]] constexpr auto operator~() const noexcept -> EnumSet
+		{
+			return all() -= *this;
+		}
+
+		// =============================================================================
+		// BULK
+		//
+		// The loops have no branch and a fixed number of words per set, the compiler vectorizes them.
+
+		/**
+		 * @brief destination[i] |= source[i]
+		 * @note Only the first `min(destination.size(), source.size())` sets are processed.
+		 */
+		constexpr static auto unite(const std::span<EnumSet> destination, const std::span<const EnumSet> source) noexcept -> void
+		{
+			const auto size = std::ranges::min(destination.size(), source.size());
+
+			for (size_type i = 0; i < size; ++i)
+			{
+				for (size_type w = 0; w < word_count; ++w)
+				{
+					destination[i].words_[w] |= source[i].words_[w];
+				}
+			}
+		}
+
+		/**
+		 * @brief destination[i] |= source
+		 */
+		constexpr static auto unite(const std::span<EnumSet> destination, const EnumSet& source) noexcept -> void
+		{
+			for (auto& set: destination)
+			{
+				for (size_type w = 0; w < word_count; ++w)
+				{
+					set.words_[w] |= source.words_[w];
+				}
+			}
+		}
+
+		/**
+		 * @brief destination[i] &= source[i]
+		 * @note Only the first `min(destination.size(), source.size())` sets are processed.
+		 */
+		constexpr static auto intersect(const std::span<EnumSet> destination, const std::span<const EnumSet> source) noexcept -> void
+		{
+			const auto size = std::ranges::min(destination.size(), source.size());
+
+			for (size_type i = 0; i < size; ++i)
+			{
+				for (size_type w = 0; w < word_count; ++w)
+				{
+					destination[i].words_[w] &= source[i].words_[w];
+				}
+			}
+		}
+
+		/**
+		 * @brief destination[i] &= source
+		 */
+		constexpr static auto intersect(const std::span<EnumSet> destination, const EnumSet& source) noexcept -> void
+		{
+			for (auto& set: destination)
+			{
+				for (size_type w = 0; w < word_count; ++w)
+				{
+					set.words_[w] &= source.words_[w];
+				}
+			}
+		}
+
+		/**
+		 * @brief The number of sets in @c sets that contain all values of @c subset.
+		 */
+		[[nodiscard]] constexpr static auto count_superset(const std::span<const EnumSet> sets, const EnumSet& subset) noexcept -> size_type
+		{
+			size_type result = 0;
+			for (const auto& set: sets)
+			{
+				word_type missing = 0;
+				for (size_type w = 0; w < word_count; ++w)
+				{
+					missing |= static_cast<word_type>(subset.words_[w] & ~set.words_[w]);
+				}
+				result += missing == 0 ? 1 : 0;
+			}
+			return result;
+		}
+	};
+}
@@ -0,0 +1,1266 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/functional/hash.hpp>
+#include <prometheus/platform/os.hpp>
+
+#if defined(PROMETHEUS_ARCH_X64) || (defined(PROMETHEUS_ARCH_X86) && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+
+#ifdef PROMETHEUS_PLATFORM_WINDOWS
+
+#include <intrin.h>
+
+#else
+
+#include <emmintrin.h>
+
+#endif
+
+#define PROMETHEUS_CONTAINER_FLAT_HASH_SSE2
+
+#endif
+
+namespace prometheus::container
+{
+	namespace flat_hash_detail
+	{
+		// Swiss table:
+		// Every slot has a control byte, the slots are divided into groups of 16 slots,
+		// and the control bytes of a group are matched at once (SSE2, or a plain loop which the compiler can vectorize).
+		//
+		// control byte:
+		// 0b1000'0000 => empty
+		// 0b1111'1110 => deleted (tombstone)
+		// 0b1111'1111 => sentinel (after the last slot, stops the iteration)
+		// 0b0xxx'xxxx => full, the lowest 7 bits of the hash
+		using ctrl_type = std::int8_t;
+
+		constexpr ctrl_type ctrl_empty = -128;
+		constexpr ctrl_type ctrl_deleted = -2;
+		constexpr ctrl_type ctrl_sentinel = -1;
+
+		constexpr std::size_t group_width = 16;
+
+		// one bit per slot of the group
+		using mask_type = std::uint32_t;
+
+		[[nodiscard]] constexpr auto match_scalar(const ctrl_type* group, const auto predicate) noexcept -> mask_type
+		{
+			mask_type mask = 0;
+			for (std::size_t i = 0; i < group_width; ++i)
+			{
+				mask |= static_cast<mask_type>(predicate(group[i])) << i;
+			}
+			return mask;
+		}
+
+		// the slots whose control byte is `h2`
+		[[nodiscard]] constexpr auto match(const ctrl_type* group, const ctrl_type h2) noexcept -> mask_type
+		{
+#if defined(PROMETHEUS_CONTAINER_FLAT_HASH_SSE2)
+			PROMETHEUS_SEMANTIC_IF_NOT_CONSTANT_EVALUATED
+			{
+				const auto ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+				return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))));
+			}
+#endif
+
+			return flat_hash_detail::match_scalar(group, [h2](const ctrl_type c) noexcept -> bool { return c == h2; });
+		}
+
+		[[nodiscard]] constexpr auto match_empty(const ctrl_type* group) noexcept -> mask_type
+		{
+			return flat_hash_detail::match(group, ctrl_empty);
+		}
+
+		[[nodiscard]] constexpr auto match_empty_or_deleted(const ctrl_type* group) noexcept -> mask_type
+		{
+#if defined(PROMETHEUS_CONTAINER_FLAT_HASH_SSE2)
+			PROMETHEUS_SEMANTIC_IF_NOT_CONSTANT_EVALUATED
+			{
+				// the sentinel is never part of a group
+				const auto ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+				return static_cast<mask_type>(_mm_movemask_epi8(ctrl));
+			}
+#endif
+
+			return flat_hash_detail::match_scalar(group, [](const ctrl_type c) noexcept -> bool { return c < 0; });
+		}
+
+		template<typename Hash>
+		concept avalanching_hash_t = requires { typename Hash::is_avalanching; };
+
+		template<typename Hash, typename KeyEqual>
+		concept transparent_t = requires
+		{
+			typename Hash::is_transparent;
+			typename KeyEqual::is_transparent;
+		};
+
+		template<typename Key, typename Value>
+		struct map_policy
+		{
+			using key_type = Key;
+			using value_type = std::pair<const Key, Value>;
+
+			constexpr static bool is_set = false;
+
+			[[nodiscard]] constexpr static auto key_of(const value_type& value) noexcept -> const key_type&
+			{
+				return value.first;
+			}
+
+			template<typename Allocator>
+			constexpr static bool is_nothrow_transfer_v = noexcept(
+				std::allocator_traits<Allocator>::construct(
+					std::declval<Allocator&>(),
+					std::declval<value_type*>(),
+					std::declval<const key_type&>(),
+					std::declval<Value&&>()
+				)
+			);
+
+			// Move the value from `from` to `to` and destroy `from`.
+			// The key of `pair<const Key, Value>` cannot be moved from, it is copied (the mapped value is moved).
+			template<typename Allocator>
+			constexpr static auto transfer(Allocator& allocator, value_type* to, value_type* from) noexcept(is_nothrow_transfer_v<Allocator>) -> void
+			{
+				using allocator_traits_type = std::allocator_traits<Allocator>;
+
+				allocator_traits_type::construct(allocator, to, std::as_const(from->first), std::move(from->second));
+				allocator_traits_type::destroy(allocator, from);
+			}
+		};
+
+		template<typename Key>
+		struct set_policy
+		{
+			using key_type = Key;
+			using value_type = Key;
+
+			constexpr static bool is_set = true;
+
+			[[nodiscard]] constexpr static auto key_of(const value_type& value) noexcept -> const key_type&
+			{
+				return value;
+			}
+
+			template<typename Allocator>
+			constexpr static bool is_nothrow_transfer_v = noexcept(
+				std::allocator_traits<Allocator>::construct(
+					std::declval<Allocator&>(),
+					std::declval<value_type*>(),
+					std::declval<key_type&&>()
+				)
+			);
+
+			// Move the value from `from` to `to` and destroy `from`.
+			template<typename Allocator>
+			constexpr static auto transfer(Allocator& allocator, value_type* to, value_type* from) noexcept(is_nothrow_transfer_v<Allocator>) -> void
+			{
+				using allocator_traits_type = std::allocator_traits<Allocator>;
+
+				allocator_traits_type::construct(allocator, to, std::move(*from));
+				allocator_traits_type::destroy(allocator, from);
+			}
+		};
+
+		template<typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+		class Table
+		{
+		public:
+			using key_type = Policy::key_type;
+			using value_type = Policy::value_type;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			using hasher = Hash;
+			using key_equal = KeyEqual;
+
+			using allocator_type = Allocator;
+			using allocator_traits_type = std::allocator_traits<allocator_type>;
+
+			static_assert(std::is_same_v<typename allocator_traits_type::value_type, value_type>);
+
+			using reference = value_type&;
+			using const_reference = const value_type&;
+
+			// the maximum load factor is 7/8
+			constexpr static size_type max_load_numerator = 7;
+			constexpr static size_type max_load_denominator = 8;
+
+		private:
+			template<typename T>
+			class basic_iterator
+			{
+				friend Table;
+
+			public:
+				using iterator_concept = std::forward_iterator_tag;
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = std::remove_const_t<T>;
+				using difference_type = std::ptrdiff_t;
+				using reference = T&;
+				using pointer = T*;
+
+			private:
+				const ctrl_type* ctrl_;
+				T* slot_;
+
+				constexpr basic_iterator(const ctrl_type* ctrl, T* slot) noexcept
+					: ctrl_{ctrl},
+					  slot_{slot} {}
+
+				constexpr auto skip_empty_or_deleted() noexcept -> void
+				{
+					while (*ctrl_ < ctrl_sentinel)
+					{
+						++ctrl_;
+						++slot_;
+					}
+				}
+
+			public:
+				constexpr basic_iterator() noexcept
+					: ctrl_{nullptr},
+					  slot_{nullptr} {}
+
+				// iterator => const_iterator
+				template<typename U>
+					requires(std::is_same_v<const U, T> and not std::is_same_v<U, T>)
+				constexpr explicit(false) basic_iterator(const basic_iterator<U>& other) noexcept
+					: ctrl_{other.ctrl_},
+					  slot_{other.slot_} {}
+
+				[[nodiscard]] constexpr auto operator*() const noexcept -> reference
+				{
+					return *slot_;
+				}
+
+				[[nodiscard]] constexpr auto operator->() const noexcept -> pointer
+				{
+					return slot_;
+				}
+
+				constexpr auto operator++() noexcept -> basic_iterator&
+				{
+					++ctrl_;
+					++slot_;
+					this->skip_empty_or_deleted();
+
+					return *this;
+				}
+
+				constexpr auto operator++(int) noexcept -> basic_iterator
+				{
+					auto copy = *this;
+					++*this;
+					return copy;
+				}
+
+				[[nodiscard]] constexpr auto operator==(const basic_iterator& other) const noexcept -> bool
+				{
+					return ctrl_ == other.ctrl_;
+				}
+
+				template<typename>
+				friend class basic_iterator;
+			};
+
+		public:
+			// the key of the set cannot be modified
+			using iterator = basic_iterator<std::conditional_t<Policy::is_set, const value_type, value_type>>;
+			using const_iterator = basic_iterator<const value_type>;
+
+			// Heterogeneous lookup requires a transparent hash and key equal (otherwise the `key_type` overloads are used, the key is converted as usual),
+			// an iterator is never a key (e.g. `erase(map.begin())` must not be `erase(const K&)`).
+			template<typename K>
+			constexpr static bool is_lookup_key_v =
+					transparent_t<hasher, key_equal> and
+					not std::is_convertible_v<const K&, iterator> and
+					not std::is_convertible_v<const K&, const_iterator>;
+
+		private:
+			using ctrl_allocator_type = allocator_traits_type::template rebind_alloc<ctrl_type>;
+			using ctrl_allocator_traits_type = std::allocator_traits<ctrl_allocator_type>;
+
+			using slot_pointer = allocator_traits_type::pointer;
+			using ctrl_pointer = ctrl_allocator_traits_type::pointer;
+
+			// capacity_ + 1 (sentinel)
+			ctrl_pointer ctrl_;
+			slot_pointer slots_;
+			// 0 or a multiple of `group_width` (power of 2)
+			size_type capacity_;
+			size_type size_;
+			// the number of empty slots that can be filled before a rehash
+			size_type growth_left_;
+
+			PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS hasher hasher_;
+			PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS key_equal key_equal_;
+			PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS allocator_type allocator_;
+
+			[[nodiscard]] constexpr auto ctrl() const noexcept -> ctrl_type*
+			{
+				return std::to_address(ctrl_);
+			}
+
+			[[nodiscard]] constexpr auto slots() const noexcept -> value_type*
+			{
+				return std::to_address(slots_);
+			}
+
+			[[nodiscard]] constexpr static auto growth_of(const size_type capacity) noexcept -> size_type
+			{
+				return capacity / max_load_denominator * max_load_numerator;
+			}
+
+			[[nodiscard]] constexpr static auto capacity_of(const size_type count) noexcept -> size_type
+			{
+				if (count == 0)
+				{
+					return 0;
+				}
+
+				return std::bit_ceil(std::ranges::max(group_width, (count * max_load_denominator + max_load_numerator - 1) / max_load_numerator));
+			}
+
+			template<typename K>
+			[[nodiscard]] constexpr auto hash_of(const K& key) const noexcept -> functional::hash_result_type
+			{
+				const auto hash = static_cast<functional::hash_result_type>(hasher_(key));
+
+				if constexpr (avalanching_hash_t<hasher>)
+				{
+					return hash;
+				}
+				else
+				{
+					// e.g. std::hash<int> is the identity function, spread the entropy into the bits we use
+					return functional::hash_detail::mix(hash, 0x9e37'79b9'7f4a'7c15);
+				}
+			}
+
+			[[nodiscard]] constexpr static auto h1_of(const functional::hash_result_type hash) noexcept -> size_type
+			{
+				return static_cast<size_type>(hash >> 7);
+			}
+
+			[[nodiscard]] constexpr static auto h2_of(const functional::hash_result_type hash) noexcept -> ctrl_type
+			{
+				return static_cast<ctrl_type>(hash & 0x7f);
+			}
+
+			// The groups are visited in triangular order (+1, +2, +3...), which visits all groups since the number of groups is a power of 2.
+			// Returns the index of the slot holding the key, or `capacity_` if the key is not found.
+			template<typename K>
+			[[nodiscard]] constexpr auto find_index(const K& key, const functional::hash_result_type hash) const noexcept -> size_type
+			{
+				if (capacity_ == 0)
+				{
+					return capacity_;
+				}
+
+				const auto h2 = Table::h2_of(hash);
+				const auto group_mask = capacity_ / group_width - 1;
+
+				const auto* ctrl = this->ctrl();
+				const auto* slots = this->slots();
+
+				auto group = Table::h1_of(hash) & group_mask;
+				for (size_type step = 1;; ++step)
+				{
+					const auto* group_ctrl = ctrl + group * group_width;
+
+					for (auto mask = flat_hash_detail::match(group_ctrl, h2); mask != 0; mask &= mask - 1)
+					{
+						if (const auto index = group * group_width + static_cast<size_type>(std::countr_zero(mask));
+							key_equal_(Policy::key_of(slots[index]), key))
+						{
+							return index;
+						}
+					}
+
+					// the key would have been inserted into this group
+					if (flat_hash_detail::match_empty(group_ctrl) != 0)
+					{
+						return capacity_;
+					}
+
+					group = (group + step) & group_mask;
+				}
+			}
+
+			// The index of the first empty (or deleted) slot in the probe sequence.
+			[[nodiscard]] constexpr static auto find_non_full(const ctrl_type* ctrl, const size_type capacity, const functional::hash_result_type hash) noexcept -> size_type
+			{
+				PROMETHEUS_PLATFORM_ASSUME(capacity != 0);
+
+				const auto group_mask = capacity / group_width - 1;
+
+				auto group = Table::h1_of(hash) & group_mask;
+				for (size_type step = 1;; ++step)
+				{
+					if (const auto mask = flat_hash_detail::match_empty_or_deleted(ctrl + group * group_width);
+						mask != 0)
+					{
+						return group * group_width + static_cast<size_type>(std::countr_zero(mask));
+					}
+
+					group = (group + step) & group_mask;
+				}
+			}
+
+			struct arrays_type
+			{
+				ctrl_pointer ctrl;
+				slot_pointer slots;
+			};
+
+			// The table is unchanged if the allocation fails.
+			[[nodiscard]] constexpr auto allocate(const size_type capacity) -> arrays_type
+			{
+				PROMETHEUS_PLATFORM_ASSUME(std::has_single_bit(capacity) and capacity >= group_width);
+
+				ctrl_allocator_type ctrl_allocator{allocator_};
+
+				const auto slots = allocator_traits_type::allocate(allocator_, capacity);
+
+				// release the slots if the control bytes cannot be allocated
+				struct slots_guard
+				{
+					allocator_type& allocator;
+					slot_pointer slots;
+					size_type capacity;
+
+					constexpr ~slots_guard() noexcept
+					{
+						if (slots != nullptr)
+						{
+							allocator_traits_type::deallocate(allocator, slots, capacity);
+						}
+					}
+				};
+				slots_guard guard{.allocator = allocator_, .slots = slots, .capacity = capacity};
+
+				const auto ctrl = ctrl_allocator_traits_type::allocate(ctrl_allocator, capacity + 1);
+				guard.slots = nullptr;
+
+				std::ranges::fill_n(std::to_address(ctrl), static_cast<difference_type>(capacity), ctrl_empty);
+				std::to_address(ctrl)[capacity] = ctrl_sentinel;
+
+				return {.ctrl = ctrl, .slots = slots};
+			}
+
+			// release the memory only, the values must have been destroyed
+			constexpr auto deallocate(const arrays_type arrays, const size_type capacity) noexcept -> void
+			{
+				ctrl_allocator_type ctrl_allocator{allocator_};
+
+				ctrl_allocator_traits_type::deallocate(ctrl_allocator, arrays.ctrl, capacity + 1);
+				allocator_traits_type::deallocate(allocator_, arrays.slots, capacity);
+			}
+
+			// destroy all values and release the memory
+			constexpr auto release() noexcept -> void
+			{
+				if (capacity_ == 0)
+				{
+					return;
+				}
+
+				this->destroy_all();
+				this->deallocate({.ctrl = ctrl_, .slots = slots_}, capacity_);
+
+				ctrl_ = nullptr;
+				slots_ = nullptr;
+				capacity_ = 0;
+				size_ = 0;
+				growth_left_ = 0;
+			}
+
+			constexpr auto destroy_all() noexcept -> void
+			{
+				if constexpr (not std::is_trivially_destructible_v<value_type>)
+				{
+					const auto* ctrl = this->ctrl();
+					auto* slots = this->slots();
+
+					for (size_type i = 0; i < capacity_; ++i)
+					{
+						if (ctrl[i] >= 0)
+						{
+							allocator_traits_type::destroy(allocator_, slots + i);
+						}
+					}
+				}
+			}
+
+			constexpr auto steal(Table& other) noexcept -> void
+			{
+				ctrl_ = std::exchange(other.ctrl_, nullptr);
+				slots_ = std::exchange(other.slots_, nullptr);
+				capacity_ = std::exchange(other.capacity_, 0);
+				size_ = std::exchange(other.size_, 0);
+				growth_left_ = std::exchange(other.growth_left_, 0);
+			}
+
+			// `this` is empty (no memory)
+			constexpr auto copy(const Table& other) -> void
+			{
+				if (other.size_ == 0)
+				{
+					return;
+				}
+
+				const auto arrays = this->allocate(other.capacity_);
+				ctrl_ = arrays.ctrl;
+				slots_ = arrays.slots;
+				capacity_ = other.capacity_;
+
+				// Keep the same layout (including the tombstones, otherwise a probe sequence which passes through a full group would stop early), no need to rehash.
+				// The slots not yet copied are marked as deleted, so the table stays valid if a copy throws.
+				const auto* other_ctrl = other.ctrl();
+				const auto* other_slots = other.slots();
+
+				auto* ctrl = this->ctrl();
+				auto* slots = this->slots();
+
+				std::ranges::transform(
+					other_ctrl,
+					other_ctrl + capacity_,
+					ctrl,
+					[](const ctrl_type c) noexcept -> ctrl_type
+					{
+						return c >= 0 ? ctrl_deleted : c;
+					}
+				);
+				growth_left_ = other.growth_left_;
+
+				for (size_type i = 0; i < capacity_; ++i)
+				{
+					if (other_ctrl[i] >= 0)
+					{
+						allocator_traits_type::construct(allocator_, slots + i, other_slots[i]);
+						ctrl[i] = other_ctrl[i];
+						size_ += 1;
+					}
+				}
+			}
+
+			// The new arrays are committed only after all values are transferred,
+			// if a value cannot be transferred without throwing, the values are copied and the table is unchanged if a copy throws.
+			constexpr auto rehash_to(const size_type capacity) -> void
+			{
+				const auto arrays = this->allocate(capacity);
+
+				auto* ctrl = this->ctrl();
+				auto* slots = this->slots();
+
+				auto* new_ctrl = std::to_address(arrays.ctrl);
+				auto* new_slots = std::to_address(arrays.slots);
+
+				if constexpr (Policy::template is_nothrow_transfer_v<allocator_type>)
+				{
+					for (size_type i = 0; i < capacity_; ++i)
+					{
+						if (ctrl[i] < 0)
+						{
+							continue;
+						}
+
+						const auto hash = this->hash_of(Policy::key_of(slots[i]));
+						const auto index = Table::find_non_full(new_ctrl, capacity, hash);
+
+						Policy::transfer(allocator_, new_slots + index, slots + i);
+						new_ctrl[index] = Table::h2_of(hash);
+					}
+				}
+				else
+				{
+					// destroy the copied values and release the new arrays if a copy throws
+					struct arrays_guard
+					{
+						Table& table;
+						arrays_type arrays;
+						size_type capacity;
+
+						constexpr ~arrays_guard() noexcept
+						{
+							if (arrays.ctrl == nullptr)
+							{
+								return;
+							}
+
+							const auto* ctrl = std::to_address(arrays.ctrl);
+							auto* slots = std::to_address(arrays.slots);
+							for (size_type i = 0; i < capacity; ++i)
+							{
+								if (ctrl[i] >= 0)
+								{
+									allocator_traits_type::destroy(table.allocator_, slots + i);
+								}
+							}
+
+							table.deallocate(arrays, capacity);
+						}
+					};
+					arrays_guard guard{.table = *this, .arrays = arrays, .capacity = capacity};
+
+					for (size_type i = 0; i < capacity_; ++i)
+					{
+						if (ctrl[i] < 0)
+						{
+							continue;
+						}
+
+						const auto hash = this->hash_of(Policy::key_of(slots[i]));
+						const auto index = Table::find_non_full(new_ctrl, capacity, hash);
+
+						allocator_traits_type::construct(allocator_, new_slots + index, std::as_const(slots[i]));
+						new_ctrl[index] = Table::h2_of(hash);
+					}
+
+					guard.arrays.ctrl = nullptr;
+					this->destroy_all();
+				}
+
+				if (capacity_ != 0)
+				{
+					this->deallocate({.ctrl = ctrl_, .slots = slots_}, capacity_);
+				}
+
+				ctrl_ = arrays.ctrl;
+				slots_ = arrays.slots;
+				capacity_ = capacity;
+				growth_left_ = Table::growth_of(capacity_) - size_;
+			}
+
+			constexpr auto grow() -> void
+			{
+				if (capacity_ == 0)
+				{
+					this->rehash_to(group_width);
+				}
+				else if (size_ * 2 <= Table::growth_of(capacity_))
+				{
+					// mostly tombstones, clean them up
+					this->rehash_to(capacity_);
+				}
+				else
+				{
+					this->rehash_to(capacity_ * 2);
+				}
+			}
+
+			// the index of the slot where a value (whose key is not present) should be constructed
+			[[nodiscard]] constexpr auto prepare_insert(const functional::hash_result_type hash) -> size_type
+			{
+				if (growth_left_ == 0)
+				{
+					this->grow();
+				}
+
+				return Table::find_non_full(this->ctrl(), capacity_, hash);
+			}
+
+			// the value was constructed in `slots_[index]`
+			constexpr auto finish_insert(const size_type index, const functional::hash_result_type hash) noexcept -> void
+			{
+				auto& ctrl = this->ctrl()[index];
+
+				if (ctrl == ctrl_empty)
+				{
+					growth_left_ -= 1;
+				}
+
+				ctrl = Table::h2_of(hash);
+				size_ += 1;
+			}
+
+			constexpr auto erase_index(const size_type index) noexcept -> void
+			{
+				allocator_traits_type::destroy(allocator_, this->slots() + index);
+				size_ -= 1;
+
+				// A probe sequence passes through a group only if the group is full (no empty slots) at that time,
+				// and a group never gets an empty slot again except by a rehash,
+				// so if the group still has an empty slot, no probe sequence passes through it.
+				auto* ctrl = this->ctrl();
+				if (flat_hash_detail::match_empty(ctrl + index / group_width * group_width) != 0)
+				{
+					ctrl[index] = ctrl_empty;
+					growth_left_ += 1;
+				}
+				else
+				{
+					ctrl[index] = ctrl_deleted;
+				}
+			}
+
+			[[nodiscard]] constexpr auto iterator_at(const size_type index) noexcept -> iterator
+			{
+				return {this->ctrl() + index, this->slots() + index};
+			}
+
+			[[nodiscard]] constexpr auto iterator_at(const size_type index) const noexcept -> const_iterator
+			{
+				return {this->ctrl() + index, this->slots() + index};
+			}
+
+			template<typename K>
+			constexpr auto do_erase(const K& key) noexcept -> size_type
+			{
+				if (const auto index = this->find_index(key, this->hash_of(key));
+					index != capacity_)
+				{
+					this->erase_index(index);
+					return 1;
+				}
+
+				return 0;
+			}
+
+		protected:
+			// Insert a value constructed by `args` if the key is not present.
+			template<typename K, typename... Args>
+			constexpr auto do_emplace(const K& key, Args&&... args) -> std::pair<iterator, bool>
+			{
+				const auto hash = this->hash_of(key);
+
+				if (const auto index = this->find_index(key, hash);
+					index != capacity_)
+				{
+					return {this->iterator_at(index), false};
+				}
+
+				const auto index = this->prepare_insert(hash);
+				allocator_traits_type::construct(allocator_, this->slots() + index, std::forward<Args>(args)...);
+				this->finish_insert(index, hash);
+
+				return {this->iterator_at(index), true};
+			}
+
+		public:
+			constexpr explicit Table(
+				const size_type bucket_count = 0,
+				const hasher& hash = hasher{},
+				const key_equal& equal = key_equal{},
+				const allocator_type& allocator = allocator_type{}
+			)
+				: ctrl_{nullptr},
+				  slots_{nullptr},
+				  capacity_{0},
+				  size_{0},
+				  growth_left_{0},
+				  hasher_{hash},
+				  key_equal_{equal},
+				  allocator_{allocator}
+			{
+				if (bucket_count != 0)
+				{
+					this->rehash_to(Table::capacity_of(bucket_count));
+				}
+			}
+
+			constexpr explicit Table(const allocator_type& allocator)
+				: Table{0, hasher{}, key_equal{}, allocator} {}
+
+			constexpr Table(const Table& other)
+				: Table{other, allocator_traits_type::select_on_container_copy_construction(other.allocator_)} {}
+
+			constexpr Table(const Table& other, const allocator_type& allocator)
+				: Table{0, other.hasher_, other.key_equal_, allocator}
+			{
+				this->copy(other);
+			}
+
+			constexpr Table(Table&& other) noexcept
+				: ctrl_{nullptr},
+				  slots_{nullptr},
+				  capacity_{0},
+				  size_{0},
+				  growth_left_{0},
+				  hasher_{std::move(other.hasher_)},
+				  key_equal_{std::move(other.key_equal_)},
+				  allocator_{std::move(other.allocator_)}
+			{
+				this->steal(other);
+			}
+
+			constexpr auto operator=(const Table& other) -> Table&
+			{
+				if (this == &other)
+				{
+					return *this;
+				}
+
+				this->release();
+
+				if constexpr (allocator_traits_type::propagate_on_container_copy_assignment::value)
+				{
+					allocator_ = other.allocator_;
+				}
+				hasher_ = other.hasher_;
+				key_equal_ = other.key_equal_;
+
+				this->copy(other);
+				return *this;
+			}
+
+			// If the allocators are not equal, the memory of the other table cannot be released by our allocator
+			constexpr auto operator=(Table&& other) noexcept -> Table& //
+				requires(
+					allocator_traits_type::propagate_on_container_move_assignment::value or
+					allocator_traits_type::is_always_equal::value
+				)
+			{
+				if (this == &other)
+				{
+					return *this;
+				}
+
+				this->release();
+
+				if constexpr (allocator_traits_type::propagate_on_container_move_assignment::value)
+				{
+					allocator_ = std::move(other.allocator_);
+				}
+				hasher_ = std::move(other.hasher_);
+				key_equal_ = std::move(other.key_equal_);
+
+				this->steal(other);
+				return *this;
+			}
+
+			constexpr ~Table() noexcept
+			{
+				this->release();
+			}
+
+			[[nodiscard]] constexpr auto begin() noexcept -> iterator
+			{
+				if (size_ == 0)
+				{
+					return this->end();
+				}
+
+				auto it = this->iterator_at(0);
+				it.skip_empty_or_deleted();
+				return it;
+			}
+
+			[[nodiscard]] constexpr auto begin() const noexcept -> const_iterator
+			{
+				return const_cast<Table&>(*this).begin();
+			}
+
+			[[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator
+			{
+				return this->begin();
+			}
+
+			[[nodiscard]] constexpr auto end() noexcept -> iterator
+			{
+				return this->iterator_at(capacity_);
+			}
+
+			[[nodiscard]] constexpr auto end() const noexcept -> const_iterator
+			{
+				return this->iterator_at(capacity_);
+			}
+
+			[[nodiscard]] constexpr auto cend() const noexcept -> const_iterator
+			{
+				return this->end();
+			}
+
+			[[nodiscard]] constexpr auto empty() const noexcept -> bool
+			{
+				return size_ == 0;
+			}
+
+			[[nodiscard]] constexpr auto size() const noexcept -> size_type
+			{
+				return size_;
+			}
+
+			/**
+			 * @brief The number of slots (not all of them can be used before a rehash, see @c max_load_numerator / @c max_load_denominator).
+			 */
+			[[nodiscard]] constexpr auto capacity() const noexcept -> size_type
+			{
+				return capacity_;
+			}
+
+			[[nodiscard]] constexpr auto load_factor() const noexcept -> float
+			{
+				if (capacity_ == 0)
+				{
+					return 0;
+				}
+
+				return static_cast<float>(size_) / static_cast<float>(capacity_);
+			}
+
+			/**
+			 * @brief Destroy all values, the memory is kept.
+			 */
+			constexpr auto clear() noexcept -> void
+			{
+				if (capacity_ == 0)
+				{
+					return;
+				}
+
+				this->destroy_all();
+
+				std::ranges::fill_n(this->ctrl(), static_cast<difference_type>(capacity_), ctrl_empty);
+				size_ = 0;
+				growth_left_ = Table::growth_of(capacity_);
+			}
+
+			/**
+			 * @brief Make room for at least @c count values without rehashing.
+			 */
+			constexpr auto reserve(const size_type count) -> void
+			{
+				if (count > size_ + growth_left_)
+				{
+					this->rehash_to(Table::capacity_of(count));
+				}
+			}
+
+			[[nodiscard]] constexpr auto find(const key_type& key) noexcept -> iterator
+			{
+				return this->iterator_at(this->find_index(key, this->hash_of(key)));
+			}
+
+			[[nodiscard]] constexpr auto find(const key_type& key) const noexcept -> const_iterator
+			{
+				return this->iterator_at(this->find_index(key, this->hash_of(key)));
+			}
+
+			template<typename K>
+				requires is_lookup_key_v<K>
+			[[nodiscard]] constexpr auto find(const K& key) noexcept -> iterator
+			{
+				return this->iterator_at(this->find_index(key, this->hash_of(key)));
+			}
+
+			template<typename K>
+				requires is_lookup_key_v<K>
+			[[nodiscard]] constexpr auto find(const K& key) const noexcept -> const_iterator
+			{
+				return this->iterator_at(this->find_index(key, this->hash_of(key)));
+			}
+
+			[[nodiscard]] constexpr auto contains(const key_type& key) const noexcept -> bool
+			{
+				return this->find_index(key, this->hash_of(key)) != capacity_;
+			}
+
+			template<typename K>
+				requires is_lookup_key_v<K>
+			[[nodiscard]] constexpr auto contains(const K& key) const noexcept -> bool
+			{
+				return this->find_index(key, this->hash_of(key)) != capacity_;
+			}
+
+			[[nodiscard]] constexpr auto count(const key_type& key) const noexcept -> size_type
+			{
+				return this->contains(key) ? 1 : 0;
+			}
+
+			template<typename K>
+				requires is_lookup_key_v<K>
+			[[nodiscard]] constexpr auto count(const K& key) const noexcept -> size_type
+			{
+				return this->contains(key) ? 1 : 0;
+			}
+
+			constexpr auto erase(const key_type& key) noexcept -> size_type
+			{
+				return this->do_erase(key);
+			}
+
+			template<typename K>
+				requires is_lookup_key_v<K>
+			constexpr auto erase(const K& key) noexcept -> size_type
+			{
+				return this->do_erase(key);
+			}
+
+			/**
+			 * @note Other iterators remain valid (erasing never rehashes).
+			 */
+			constexpr auto erase(const const_iterator position) noexcept -> iterator
+			{
+				const auto index = static_cast<size_type>(position.ctrl_ - this->ctrl());
+				PROMETHEUS_PLATFORM_ASSUME(index < capacity_ and this->ctrl()[index] >= 0);
+
+				this->erase_index(index);
+
+				auto it = this->iterator_at(index);
+				++it;
+				return it;
+			}
+
+			constexpr auto swap(Table& other) noexcept -> void
+			{
+				using std::swap;
+				swap(ctrl_, other.ctrl_);
+				swap(slots_, other.slots_);
+				swap(capacity_, other.capacity_);
+				swap(size_, other.size_);
+				swap(growth_left_, other.growth_left_);
+				swap(hasher_, other.hasher_);
+				swap(key_equal_, other.key_equal_);
+				if constexpr (allocator_traits_type::propagate_on_container_swap::value)
+				{
+					swap(allocator_, other.allocator_);
+				}
+			}
+
+			friend constexpr auto swap(Table& lhs, Table& rhs) noexcept -> void
+			{
+				lhs.swap(rhs);
+			}
+
+			[[nodiscard]] constexpr auto hash_function() const noexcept -> hasher
+			{
+				return hasher_;
+			}
+
+			[[nodiscard]] constexpr auto key_eq() const noexcept -> key_equal
+			{
+				return key_equal_;
+			}
+
+			[[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type
+			{
+				return allocator_;
+			}
+		};
+	}
+
+	/**
+	 * @brief An open-addressing hash map (Swiss table), the values are stored in a single flat array (no node per value).
+	 * @note Unlike @c std::unordered_map, inserting may invalidate all iterators and references (erasing does not).
+	 * @note The default hash is @c functional::hash and the default key equal is @c std::equal_to<>,
+	 * so the heterogeneous lookup (e.g. std::string_view for std::string keys) works out of the box.
+	 */
+	template<
+		typename Key,
+		typename Value,
+		typename Hash = std::remove_cvref_t<decltype(functional::hash<Key>)>,
+		typename KeyEqual = std::equal_to<>,
+		typename Allocator = std::allocator<std::pair<const Key, Value>>
+	>
+	class FlatHashMap : public flat_hash_detail::Table<flat_hash_detail::map_policy<Key, Value>, Hash, KeyEqual, Allocator>
+	{
+		using table_type = flat_hash_detail::Table<flat_hash_detail::map_policy<Key, Value>, Hash, KeyEqual, Allocator>;
+
+		template<typename K, typename V>
+		constexpr auto do_insert_or_assign(K&& key, V&& value) -> std::pair<typename table_type::iterator, bool>
+		{
+			auto result = this->try_emplace(std::forward<K>(key), std::forward<V>(value));
+			if (not result.second)
+			{
+				result.first->second = std::forward<V>(value);
+			}
+			return result;
+		}
+
+	public:
+		using mapped_type = Value;
+
+		using typename table_type::key_type;
+		using typename table_type::value_type;
+		using typename table_type::size_type;
+		using typename table_type::hasher;
+		using typename table_type::key_equal;
+		using typename table_type::iterator;
+		using typename table_type::const_iterator;
+
+		using table_type::table_type;
+
+		template<typename... Args>
+		constexpr auto try_emplace(const key_type& key, Args&&... args) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(
+				key,
+				std::piecewise_construct,
+				std::forward_as_tuple(key),
+				std::forward_as_tuple(std::forward<Args>(args)...)
+			);
+		}
+
+		template<typename... Args>
+		constexpr auto try_emplace(key_type&& key, Args&&... args) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(
+				key,
+				std::piecewise_construct,
+				std::forward_as_tuple(std::move(key)),
+				std::forward_as_tuple(std::forward<Args>(args)...)
+			);
+		}
+
+		template<typename K, typename... Args>
+			requires flat_hash_detail::transparent_t<hasher, key_equal>
+		constexpr auto try_emplace(K&& key, Args&&... args) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(
+				key,
+				std::piecewise_construct,
+				std::forward_as_tuple(std::forward<K>(key)),
+				std::forward_as_tuple(std::forward<Args>(args)...)
+			);
+		}
+
+		template<typename K, typename V>
+			requires std::is_same_v<std::remove_cvref_t<K>, key_type>
+		constexpr auto emplace(K&& key, V&& value) -> std::pair<iterator, bool>
+		{
+			return this->try_emplace(std::forward<K>(key), std::forward<V>(value));
+		}
+
+		template<typename... Args>
+		constexpr auto emplace(Args&&... args) -> std::pair<iterator, bool>
+		{
+			value_type value(std::forward<Args>(args)...);
+			return this->do_emplace(value.first, std::move(value));
+		}
+
+		constexpr auto insert(const value_type& value) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(value.first, value);
+		}
+
+		constexpr auto insert(value_type&& value) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(value.first, std::move(value));
+		}
+
+		template<typename V>
+		constexpr auto insert_or_assign(const key_type& key, V&& value) -> std::pair<iterator, bool>
+		{
+			return this->do_insert_or_assign(key, std::forward<V>(value));
+		}
+
+		template<typename V>
+		constexpr auto insert_or_assign(key_type&& key, V&& value) -> std::pair<iterator, bool>
+		{
+			return this->do_insert_or_assign(std::move(key), std::forward<V>(value));
+		}
+
+		template<typename K, typename V>
+			requires flat_hash_detail::transparent_t<hasher, key_equal>
+		constexpr auto insert_or_assign(K&& key, V&& value) -> std::pair<iterator, bool>
+		{
+			return this->do_insert_or_assign(std::forward<K>(key), std::forward<V>(value));
+		}
+
+		[[nodiscard]] constexpr auto operator[](const key_type& key) -> mapped_type&
+		{
+			return this->try_emplace(key).first->second;
+		}
+
+		[[nodiscard]] constexpr auto operator[](key_type&& key) -> mapped_type&
+		{
+			return this->try_emplace(std::move(key)).first->second;
+		}
+
+		template<typename K>
+			requires flat_hash_detail::transparent_t<hasher, key_equal>
+		[[nodiscard]] constexpr auto operator[](K&& key) -> mapped_type&
+		{
+			return this->try_emplace(std::forward<K>(key)).first->second;
+		}
+	};
+
+	/**
+	 * @brief An open-addressing hash set (Swiss table), see @c FlatHashMap.
+	 */
+	template<
+		typename Key,
+		typename Hash = std::remove_cvref_t<decltype(functional::hash<Key>)>,
+		typename KeyEqual = std::equal_to<>,
+		typename Allocator = std::allocator<Key>
+	>
+	class FlatHashSet : public flat_hash_detail::Table<flat_hash_detail::set_policy<Key>, Hash, KeyEqual, Allocator>
+	{
+		using table_type = flat_hash_detail::Table<flat_hash_detail::set_policy<Key>, Hash, KeyEqual, Allocator>;
+
+	public:
+		using typename table_type::key_type;
+		using typename table_type::value_type;
+		using typename table_type::size_type;
+		using typename table_type::hasher;
+		using typename table_type::key_equal;
+		using typename table_type::iterator;
+		using typename table_type::const_iterator;
+
+		using table_type::table_type;
+
+		constexpr auto insert(const value_type& key) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(key, key);
+		}
+
+		constexpr auto insert(value_type&& key) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(key, std::move(key));
+		}
+
+		template<typename K>
+			requires flat_hash_detail::transparent_t<hasher, key_equal>
+		constexpr auto insert(K&& key) -> std::pair<iterator, bool>
+		{
+			return this->do_emplace(key, std::forward<K>(key));
+		}
+
+		template<typename... Args>
+		constexpr auto emplace(Args&&... args) -> std::pair<iterator, bool>
+		{
+			value_type value(std::forward<Args>(args)...);
+			return this->do_emplace(value, std::move(value));
+		}
+	};
+
+	namespace pmr
+	{
+		template<
+			typename Key,
+			typename Value,
+			typename Hash = std::remove_cvref_t<decltype(functional::hash<Key>)>,
+			typename KeyEqual = std::equal_to<>
+		>
+		using FlatHashMap = container::FlatHashMap<Key, Value, Hash, KeyEqual, std::pmr::polymorphic_allocator<std::pair<const Key, Value>>>;
+
+		template<
+			typename Key,
+			typename Hash = std::remove_cvref_t<decltype(functional::hash<Key>)>,
+			typename KeyEqual = std::equal_to<>
+		>
+		using FlatHashSet = container::FlatHashSet<Key, Hash, KeyEqual, std::pmr::polymorphic_allocator<Key>>;
+	}
+}
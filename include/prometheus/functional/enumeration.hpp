@@ -7,6 +7,8 @@
 
 #include <type_traits>
 #include <utility>
+#include <algorithm>
+#include <format>
 
 // meta::is_flag
 #include <prometheus/meta/enumeration.hpp>
@@ -530,3 +532,50 @@ namespace prometheus::functional
 // {
 // 	using type = prometheus::functional::EnumWrapper<EnumType>::underlying_type;
 // };
+
+// flag => name_of(single_bit_0)|name_of(single_bit_1)|..., nothing is allocated
+template<typename EnumType>
+	requires(std::is_enum_v<EnumType> and prometheus::meta::is_flag<EnumType>())
+struct std::formatter<EnumType> // NOLINT(cert-dcl58-cpp)
+{
+	template<typename ParseContext>
+	constexpr auto parse(ParseContext& context) const noexcept -> auto
+	{
+		(void)this;
+		return context.begin();
+	}
+
+	template<typename FormatContext>
+	auto format(const EnumType& value, FormatContext& context) const noexcept -> auto
+	{
+		(void)this;
+		return prometheus::meta::full_name_to(context.out(), value);
+	}
+};
+
+template<typename EnumType>
+struct std::formatter<prometheus::functional::EnumWrapper<EnumType>> // NOLINT(cert-dcl58-cpp)
+{
+	template<typename ParseContext>
+	constexpr auto parse(ParseContext& context) const noexcept -> auto
+	{
+		(void)this;
+		return context.begin();
+	}
+
+	template<typename FormatContext>
+	auto format(const prometheus::functional::EnumWrapper<EnumType>& wrapper, FormatContext& context) const noexcept -> auto
+	{
+		(void)this;
+
+		const auto value = wrapper.operator EnumType();
+		if constexpr (prometheus::meta::is_flag<EnumType>())
+		{
+			return prometheus::meta::full_name_to(context.out(), value);
+		}
+		else
+		{
+			return std::ranges::copy(prometheus::meta::name_of(value), context.out()).out;
+		}
+	}
+};
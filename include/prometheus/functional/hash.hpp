@@ -5,15 +5,524 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <span>
+#include <cstddef>
+#include <bit>
 #include <algorithm>
 #include <type_traits>
 #include <ranges>
 #include <string>
+#include <string_view>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/meta/member.hpp>
+#include <prometheus/platform/os.hpp>
 
 namespace prometheus::functional
 {
 	using hash_result_type = std::uint64_t;
 
+	struct hash_128_result_type
+	{
+		std::uint64_t low;
+		std::uint64_t high;
+
+		[[nodiscard]] constexpr auto operator==(const hash_128_result_type&) const noexcept -> bool = default;
+	};
+
+	namespace hash_detail
+	{
+		// The short (<= 16 bytes) and medium (<= 256 bytes) inputs are mixed by 64x64=>128 multiplications (wyhash/rapidhash),
+		// the long inputs are accumulated 64 bytes (8 independent lanes) at a time (xxh3), which is vectorized (SSE4.2/AVX2, selected at runtime).
+		// All paths produce the same result, no matter whether it is evaluated at compile time or which kernel is selected at runtime.
+
+		struct multiply_result_type
+		{
+			std::uint64_t low;
+			std::uint64_t high;
+		};
+
+		[[nodiscard]] constexpr auto multiply(const std::uint64_t a, const std::uint64_t b) noexcept -> multiply_result_type
+		{
+#if defined(__SIZEOF_INT128__)
+			__extension__ using uint128_t = unsigned __int128;
+
+			const auto result = static_cast<uint128_t>(a) * b;
+			return {.low = static_cast<std::uint64_t>(result), .high = static_cast<std::uint64_t>(result >> 64)};
+#else
+			const auto a_low = a & 0xffff'ffff;
+			const auto a_high = a >> 32;
+			const auto b_low = b & 0xffff'ffff;
+			const auto b_high = b >> 32;
+
+			const auto ll = a_low * b_low;
+			const auto lh = a_low * b_high;
+			const auto hl = a_high * b_low;
+			const auto hh = a_high * b_high;
+
+			const auto middle = (ll >> 32) + (lh & 0xffff'ffff) + (hl & 0xffff'ffff);
+			return {.low = (middle << 32) | (ll & 0xffff'ffff), .high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32)};
+#endif
+		}
+
+		[[nodiscard]] constexpr auto mix(const std::uint64_t a, const std::uint64_t b) noexcept -> std::uint64_t
+		{
+			const auto [low, high] = multiply(a, b);
+			return low ^ high;
+		}
+
+		[[nodiscard]] constexpr auto avalanche(std::uint64_t h) noexcept -> std::uint64_t
+		{
+			h ^= h >> 37;
+			h *= 0x1656'6791'9e37'79f9;
+			h ^= h >> 32;
+			return h;
+		}
+
+		// little-endian, whatever the platform is
+		template<std::size_t N>
+			requires(N == 4 or N == 8)
+		[[nodiscard]] constexpr auto read(const char* p) noexcept -> std::uint64_t
+		{
+			using type = std::conditional_t<N == 4, std::uint32_t, std::uint64_t>;
+
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				std::uint64_t result = 0;
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					result |= static_cast<std::uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+				}
+				return result;
+			}
+			else
+			{
+				type result;
+				std::memcpy(&result, p, sizeof(type));
+
+				if constexpr (std::endian::native == std::endian::big)
+				{
+					result = std::byteswap(result);
+				}
+				return result;
+			}
+		}
+
+		using secret_type = std::array<std::uint64_t, 4>;
+
+		constexpr secret_type secret_low{0x2d35'8dcc'aa6c'78a5, 0x8bb8'4b93'962e'acc9, 0x4b33'a62e'd433'd4a3, 0x4d5a'2da5'1de1'aa47};
+		// the `high` half of the 128-bit hash
+		constexpr secret_type secret_high{0xa076'1d64'78bd'642f, 0xe703'7ed1'a0b4'28db, 0x8ebc'6af0'9c88'c6e3, 0x5899'65cc'7537'4cc3};
+
+		constexpr std::size_t stripe_size = 64;
+		constexpr std::size_t stripes_per_block = 8;
+		constexpr std::size_t block_size = stripe_size * stripes_per_block;
+		// the inputs longer than this are accumulated
+		constexpr std::size_t medium_size = 256;
+
+		constexpr std::uint64_t prime_32 = 0x9e37'79b1;
+
+		// splitmix64
+		constexpr auto stripe_secret = []() noexcept -> std::array<std::uint64_t, 48>
+		{
+			std::array<std::uint64_t, 48> result{};
+
+			std::uint64_t state = 0x9e37'79b9'7f4a'7c15;
+			for (auto& secret: result)
+			{
+				state += 0x9e37'79b9'7f4a'7c15;
+
+				auto z = state;
+				z = (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9;
+				z = (z ^ (z >> 27)) * 0x94d0'49bb'1331'11eb;
+				secret = z ^ (z >> 31);
+			}
+
+			return result;
+		}();
+
+		// stripe `i` of a block uses `[i, i + 8)`
+		constexpr auto stripe_secret_offset = 0;
+		constexpr auto scramble_secret_offset = 16;
+		constexpr auto last_stripe_secret_offset = 24;
+		constexpr auto merge_secret_low_offset = 32;
+		constexpr auto merge_secret_high_offset = 40;
+
+		using accumulator_type = std::array<std::uint64_t, 8>;
+
+		constexpr accumulator_type accumulator_initial{
+				0x0000'0000'c2b2'ae3d,
+				0x9e37'79b1'85eb'ca87,
+				0xc2b2'ae3d'27d4'eb4f,
+				0x1656'6791'9e37'79f9,
+				0x85eb'ca77'c2b2'ae63,
+				0x0000'0000'85eb'ca77,
+				0x27d4'eb2f'1656'67c5,
+				0x0000'0000'9e37'79b1
+		};
+
+		constexpr auto accumulate_stripe(accumulator_type& accumulator, const char* p, const std::uint64_t* secret) noexcept -> void
+		{
+			for (std::size_t i = 0; i < accumulator.size(); ++i)
+			{
+				const auto data = read<8>(p + 8 * i);
+				const auto data_key = data ^ secret[i];
+
+				accumulator[i ^ 1] += data;
+				accumulator[i] += (data_key & 0xffff'ffff) * (data_key >> 32);
+			}
+		}
+
+		constexpr auto scramble(accumulator_type& accumulator) noexcept -> void
+		{
+			for (std::size_t i = 0; i < accumulator.size(); ++i)
+			{
+				auto a = accumulator[i];
+				a ^= a >> 47;
+				a ^= stripe_secret[scramble_secret_offset + i];
+				a *= prime_32;
+				accumulator[i] = a;
+			}
+		}
+
+		// Accumulate `stripes` (regular) stripes, `stripe_in_block` is the index of the first stripe in its block (the block is scrambled after its last stripe).
+		constexpr auto accumulate_scalar(accumulator_type& accumulator, const char* p, const std::size_t stripes, std::size_t stripe_in_block) noexcept -> void
+		{
+			for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+			{
+				accumulate_stripe(accumulator, p + stripe * stripe_size, stripe_secret.data() + stripe_secret_offset + stripe_in_block);
+
+				if (++stripe_in_block == stripes_per_block)
+				{
+					scramble(accumulator);
+					stripe_in_block = 0;
+				}
+			}
+		}
+
+		// the same as `accumulate_scalar`, the kernel (SSE4.2/AVX2) is selected at runtime
+		auto accumulate_vectorized(accumulator_type& accumulator, const char* p, std::size_t stripes, std::size_t stripe_in_block) noexcept -> void;
+
+		// The kernels behind `accumulate_vectorized`, the instruction set must be supported (they are `accumulate_scalar` on non-x86 targets).
+		auto accumulate_sse(accumulator_type& accumulator, const char* p, std::size_t stripes, std::size_t stripe_in_block) noexcept -> void;
+		auto accumulate_avx2(accumulator_type& accumulator, const char* p, std::size_t stripes, std::size_t stripe_in_block) noexcept -> void;
+
+		constexpr auto accumulate(accumulator_type& accumulator, const char* p, const std::size_t stripes, const std::size_t stripe_in_block) noexcept -> void
+		{
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				accumulate_scalar(accumulator, p, stripes, stripe_in_block);
+			}
+			else
+			{
+				hash_detail::accumulate_vectorized(accumulator, p, stripes, stripe_in_block);
+			}
+		}
+
+		[[nodiscard]] constexpr auto make_accumulator(const std::uint64_t seed) noexcept -> accumulator_type
+		{
+			auto accumulator = accumulator_initial;
+			for (std::size_t i = 0; i < accumulator.size(); ++i)
+			{
+				accumulator[i] += i % 2 == 0 ? seed : 0 - seed;
+			}
+
+			return accumulator;
+		}
+
+		// `string.size() > medium_size`
+		[[nodiscard]] constexpr auto accumulate(const std::basic_string_view<char> string, const std::uint64_t seed) noexcept -> accumulator_type
+		{
+			auto accumulator = make_accumulator(seed);
+
+			// the last stripe is always accumulated separately (it may overlap with the previous one)
+			const auto stripes = (string.size() - 1) / stripe_size;
+			hash_detail::accumulate(accumulator, string.data(), stripes, 0);
+			accumulate_stripe(accumulator, string.data() + string.size() - stripe_size, stripe_secret.data() + last_stripe_secret_offset);
+
+			return accumulator;
+		}
+
+		[[nodiscard]] constexpr auto merge(const accumulator_type& accumulator, const std::size_t offset, const std::uint64_t start) noexcept -> std::uint64_t
+		{
+			auto result = start;
+			for (std::size_t i = 0; i < accumulator.size(); i += 2)
+			{
+				result += mix(accumulator[i] ^ stripe_secret[offset + i], accumulator[i + 1] ^ stripe_secret[offset + i + 1]);
+			}
+			return avalanche(result);
+		}
+
+		[[nodiscard]] constexpr auto merge_64(const accumulator_type& accumulator, const std::uint64_t size) noexcept -> std::uint64_t
+		{
+			return merge(accumulator, merge_secret_low_offset, size * 0x9e37'79b1'85eb'ca87);
+		}
+
+		[[nodiscard]] constexpr auto merge_128(const accumulator_type& accumulator, const std::uint64_t size) noexcept -> hash_128_result_type
+		{
+			return {
+					.low = merge(accumulator, merge_secret_low_offset, size * 0x9e37'79b1'85eb'ca87),
+					.high = merge(accumulator, merge_secret_high_offset, ~(size * 0xc2b2'ae3d'27d4'eb4f))
+			};
+		}
+
+		// `string.size() <= medium_size`
+		[[nodiscard]] constexpr auto hash_short(const std::basic_string_view<char> string, std::uint64_t seed, const secret_type& secret) noexcept -> std::uint64_t
+		{
+			const auto* p = string.data();
+			const auto size = string.size();
+
+			seed ^= mix(seed ^ secret[0], secret[1]) ^ size;
+
+			std::uint64_t a = 0;
+			std::uint64_t b = 0;
+			if (size <= 16)
+			{
+				if (size >= 4)
+				{
+					// 4~7 => [0, 4) [size - 4, size), 8~16 => [0, 4) [4, 8) [size - 8, size - 4) [size - 4, size)
+					const auto delta = (size & 24) >> (size >> 3);
+
+					a = (read<4>(p) << 32) | read<4>(p + size - 4);
+					b = (read<4>(p + delta) << 32) | read<4>(p + size - 4 - delta);
+				}
+				else if (size > 0)
+				{
+					a =
+							(static_cast<std::uint64_t>(static_cast<unsigned char>(p[0])) << 56) |
+							(static_cast<std::uint64_t>(static_cast<unsigned char>(p[size >> 1])) << 32) |
+							static_cast<std::uint64_t>(static_cast<unsigned char>(p[size - 1]));
+				}
+			}
+			else
+			{
+				auto rest = size;
+				if (rest > 48)
+				{
+					auto see_1 = seed;
+					auto see_2 = seed;
+					do
+					{
+						seed = mix(read<8>(p) ^ secret[1], read<8>(p + 8) ^ seed);
+						see_1 = mix(read<8>(p + 16) ^ secret[2], read<8>(p + 24) ^ see_1);
+						see_2 = mix(read<8>(p + 32) ^ secret[3], read<8>(p + 40) ^ see_2);
+
+						p += 48;
+						rest -= 48;
+					} while (rest > 48);
+
+					seed ^= see_1 ^ see_2;
+				}
+
+				while (rest > 16)
+				{
+					seed = mix(read<8>(p) ^ secret[1], read<8>(p + 8) ^ seed);
+
+					p += 16;
+					rest -= 16;
+				}
+
+				// the last 16 bytes (it may overlap with the previous ones)
+				a = read<8>(p + rest - 16);
+				b = read<8>(p + rest - 8);
+			}
+
+			const auto [low, high] = multiply(a ^ secret[1], b ^ seed);
+			return mix(low ^ secret[0] ^ size, high ^ secret[1]);
+		}
+	}
+
+	/**
+	 * @brief 64-bit hash of @c string, it processes 16/48 bytes (short strings) or 64 bytes (long strings, vectorized) at a time.
+	 * @note The result is stable (independent of the platform, and whether it is evaluated at compile time).
+	 */
+	[[nodiscard]] constexpr auto hash_64(const std::basic_string_view<char> string, const std::uint64_t seed = 0) noexcept -> hash_result_type
+	{
+		if (string.size() <= hash_detail::medium_size)
+		{
+			return hash_detail::hash_short(string, seed, hash_detail::secret_low);
+		}
+
+		return hash_detail::merge_64(hash_detail::accumulate(string, seed), string.size());
+	}
+
+	/**
+	 * @brief 128-bit hash of @c string, see @c hash_64.
+	 * @note The result is stable (independent of the platform, and whether it is evaluated at compile time).
+	 */
+	[[nodiscard]] constexpr auto hash_128(const std::basic_string_view<char> string, const std::uint64_t seed = 0) noexcept -> hash_128_result_type
+	{
+		if (string.size() <= hash_detail::medium_size)
+		{
+			return {
+					.low = hash_detail::hash_short(string, seed, hash_detail::secret_low),
+					.high = hash_detail::hash_short(string, seed, hash_detail::secret_high)
+			};
+		}
+
+		return hash_detail::merge_128(hash_detail::accumulate(string, seed), string.size());
+	}
+
+	/**
+	 * @brief Incremental version of @c hash_64 / @c hash_128, the input can be fed in any number of pieces.
+	 * @note The result is the same as hashing the concatenated input in one call.
+	 * @note The state is fixed size (the accumulators and a 256 bytes buffer), nothing is allocated.
+	 */
+	class Hasher
+	{
+	public:
+		constexpr static std::size_t buffer_size = hash_detail::medium_size;
+
+	private:
+		static_assert(buffer_size % hash_detail::stripe_size == 0 and buffer_size >= 2 * hash_detail::stripe_size);
+
+		hash_detail::accumulator_type accumulator_;
+		// [0, buffered_) => the input which has not been accumulated yet
+		// [buffer_size - stripe_size, buffer_size) => the last accumulated stripe (if buffered_ < stripe_size)
+		std::array<char, buffer_size> buffer_;
+		std::uint64_t seed_;
+		std::uint64_t size_;
+		std::size_t buffered_;
+		// the index of the next stripe in its block
+		std::size_t stripe_in_block_;
+
+		// `stripes * stripe_size` bytes, and they are not the end of the input
+		constexpr auto consume(const char* p, const std::size_t stripes) noexcept -> void
+		{
+			hash_detail::accumulate(accumulator_, p, stripes, stripe_in_block_);
+			stripe_in_block_ = (stripe_in_block_ + stripes) % hash_detail::stripes_per_block;
+		}
+
+		// `size_ > buffer_size`
+		[[nodiscard]] constexpr auto finalize_accumulator() const noexcept -> hash_detail::accumulator_type
+		{
+			using hash_detail::stripe_size;
+
+			auto accumulator = accumulator_;
+
+			std::array<char, stripe_size> last_stripe{};
+			if (buffered_ >= stripe_size)
+			{
+				const auto stripes = (buffered_ - 1) / stripe_size;
+				hash_detail::accumulate(accumulator, buffer_.data(), stripes, stripe_in_block_);
+
+				std::ranges::copy_n(buffer_.data() + buffered_ - stripe_size, stripe_size, last_stripe.data());
+			}
+			else
+			{
+				// the tail of the last accumulated stripe + the buffered input
+				const auto rest = stripe_size - buffered_;
+				std::ranges::copy_n(buffer_.data() + buffer_size - rest, static_cast<std::ptrdiff_t>(rest), last_stripe.data());
+				std::ranges::copy_n(buffer_.data(), static_cast<std::ptrdiff_t>(buffered_), last_stripe.data() + rest);
+			}
+
+			hash_detail::accumulate_stripe(accumulator, last_stripe.data(), hash_detail::stripe_secret.data() + hash_detail::last_stripe_secret_offset);
+			return accumulator;
+		}
+
+	public:
+		constexpr explicit Hasher(const std::uint64_t seed = 0) noexcept
+			: accumulator_{hash_detail::make_accumulator(seed)},
+			  buffer_{},
+			  seed_{seed},
+			  size_{0},
+			  buffered_{0},
+			  stripe_in_block_{0} {}
+
+		/**
+		 * @brief Start a new input (with the same seed).
+		 */
+		constexpr auto reset() noexcept -> void
+		{
+			*this = Hasher{seed_};
+		}
+
+		constexpr auto update(std::basic_string_view<char> string) noexcept -> Hasher&
+		{
+			using hash_detail::stripe_size;
+
+			size_ += string.size();
+
+			if (buffered_ + string.size() <= buffer_size)
+			{
+				std::ranges::copy(string, buffer_.data() + buffered_);
+				buffered_ += string.size();
+				return *this;
+			}
+
+			// fill the buffer, there is more input after it
+			{
+				const auto fill = buffer_size - buffered_;
+				std::ranges::copy(string.substr(0, fill), buffer_.data() + buffered_);
+				string.remove_prefix(fill);
+
+				this->consume(buffer_.data(), buffer_size / stripe_size);
+				buffered_ = 0;
+			}
+
+			// accumulate the input in place, but keep the last (1 ~ stripe_size) bytes
+			if (string.size() > buffer_size)
+			{
+				const auto stripes = (string.size() - 1) / stripe_size;
+				this->consume(string.data(), stripes);
+
+				std::ranges::copy_n(string.data() + (stripes - 1) * stripe_size, stripe_size, buffer_.data() + buffer_size - stripe_size);
+				string.remove_prefix(stripes * stripe_size);
+			}
+
+			std::ranges::copy(string, buffer_.data());
+			buffered_ = string.size();
+
+			return *this;
+		}
+
+		auto update(const std::span<const std::byte> bytes) noexcept -> Hasher&
+		{
+			return this->update({reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+		}
+
+		/**
+		 * @brief The same as @c hash_64(input, seed), the state is not changed (more input can be fed after it).
+		 */
+		[[nodiscard]] constexpr auto finalize() const noexcept -> hash_result_type
+		{
+			if (size_ <= buffer_size)
+			{
+				return hash_detail::hash_short({buffer_.data(), buffered_}, seed_, hash_detail::secret_low);
+			}
+
+			return hash_detail::merge_64(this->finalize_accumulator(), size_);
+		}
+
+		/**
+		 * @brief The same as @c hash_128(input, seed), the state is not changed (more input can be fed after it).
+		 */
+		[[nodiscard]] constexpr auto finalize_128() const noexcept -> hash_128_result_type
+		{
+			if (size_ <= buffer_size)
+			{
+				return {
+						.low = hash_detail::hash_short({buffer_.data(), buffered_}, seed_, hash_detail::secret_low),
+						.high = hash_detail::hash_short({buffer_.data(), buffered_}, seed_, hash_detail::secret_high)
+				};
+			}
+
+			return hash_detail::merge_128(this->finalize_accumulator(), size_);
+		}
+
+		/**
+		 * @brief The number of bytes fed so far.
+		 */
+		[[nodiscard]] constexpr auto size() const noexcept -> std::uint64_t
+		{
+			return size_;
+		}
+	};
+
 	namespace hash_detail
 	{
 		template<typename T, typename Hash>
@@ -29,36 +538,28 @@ namespace prometheus::functional
 		};
 
 		template<std::ranges::contiguous_range String, typename Hash>
-			requires std::is_same_v<typename String::value_typ, char>
+			requires std::is_same_v<typename String::value_type, char>
 		struct hash<String, Hash>
 		{
 			using is_transparent = int;
+			// every bit of the result depends on every bit of the input, the hash tables do not have to mix it again
+			using is_avalanching = int;
 			using value_type = String;
 			using hash_type = Hash;
 
-			[[nodiscard]] constexpr auto operator()(const std::ranges::viewable_range auto string) const noexcept -> hash_result_type
+			[[nodiscard]] constexpr auto operator()(const std::basic_string_view<char> string) const noexcept -> hash_result_type
 			{
-				// FNV-1a hash. See: http://www.isthe.com/chongo/tech/comp/fnv/
-				static_assert(sizeof(hash_result_type) == 8);
-				constexpr hash_result_type hash_init{14695981039346656037ull};
-				constexpr hash_result_type hash_prime{1099511628211ull};
-
-				auto result = hash_init;
-				std::ranges::for_each(
-					string,
-					[&result](const auto v) noexcept -> void
-					{
-						result ^= v;
-						result *= hash_prime;
-					}
-				);
-				return result;
+				return functional::hash_64(string);
 			}
 
-			template<typename S>
-			[[nodiscard]] constexpr auto operator()(S&& string) const noexcept -> hash_result_type
+			template<std::ranges::contiguous_range S>
+				requires(
+					std::is_same_v<std::ranges::range_value_t<S>, char> and
+					not std::is_convertible_v<const S&, std::basic_string_view<char>>
+				)
+			[[nodiscard]] constexpr auto operator()(const S& string) const noexcept -> hash_result_type
 			{
-				return this->operator()(std::forward<S>(string) | std::views::all);
+				return this->operator()(std::basic_string_view<char>{std::ranges::data(string), std::ranges::size(string)});
 			}
 		};
 
@@ -87,10 +588,15 @@ namespace prometheus::functional
 	template<typename T, typename Hash = std::hash<T>>
 	constexpr auto hash = hash_detail::hash<T, Hash>{};
 
+	/**
+	 * @brief Mix @c hash2 into @c hash1 (order-dependent), by folding the 128-bit product of both (xor-ed with the secrets).
+	 * @note The product is 0 if either factor is 0 (i.e. a hash equals its secret), so both hashes are also xor-ed into the result,
+	 * otherwise such a hash would erase the other one.
+	 */
 	[[nodiscard]] constexpr auto hash_combine_2(const hash_result_type hash1, const hash_result_type hash2) noexcept -> hash_result_type
 	{
 		static_assert(sizeof(hash_result_type) == 8);
-		return hash1 + 0x9e3779b97f681800ull + (hash2 << 6) + (hash2 >> 2);
+		return hash_detail::mix(hash1 ^ hash_detail::secret_low[0], hash2 ^ hash_detail::secret_low[1]) ^ hash1 ^ std::rotl(hash2, 32);
 	}
 
 	template<typename First, typename Second, typename... Reset>
@@ -101,17 +607,189 @@ namespace prometheus::functional
 		(hash<std::remove_cvref_t<Reset>>, ...);
 	}
 	{
-		if constexpr (sizeof...(Reset) == 0)
+		// all hashes are independent of each other, only the (cheap) combination is sequential
+		auto result = functional::hash_combine_2(
+			hash<std::remove_cvref_t<First>>(std::forward<First>(first)),
+			hash<std::remove_cvref_t<Second>>(std::forward<Second>(second))
+		);
+		((result = functional::hash_combine_2(result, hash<std::remove_cvref_t<Reset>>(std::forward<Reset>(reset)))), ...);
+
+		return result;
+	}
+
+	namespace hash_detail
+	{
+		template<typename T>
+		struct member_layout
 		{
-			const auto hash1 = hash<std::remove_cvref_t<First>>(std::forward<First>(first));
-			const auto hash2 = hash<std::remove_cvref_t<Second>>(std::forward<Second>(second));
-			return functional::hash_combine_2(hash1, hash2);
-		}
-		else
+			constexpr static auto size = meta::member_size<T>();
+
+			// the member can be hashed by its object representation
+			std::array<bool, size> bytewise;
+			// the size of the (contiguous) bytewise members starting at this member, 0 if it does not start a run
+			std::array<std::size_t, size> run_size;
+			// the member is the last one of a run
+			std::array<bool, size> run_end;
+
+			std::size_t max_run_size;
+			// the size of `T` according to the computed layout
+			std::size_t object_size;
+		};
+
+		// The offsets are deduced by the (common) layout rule of standard-layout aggregates (each member is placed at the next suitably aligned offset),
+		// the members of the other types are never merged.
+		template<typename T>
+		[[nodiscard]] constexpr auto make_member_layout(const bool merge) noexcept -> member_layout<T>
 		{
-			const auto hash1 = hash<std::remove_cvref_t<First>>(std::forward<First>(first));
-			const auto hash2 = hash_combine(std::forward<Second>(second), std::forward<Reset>(reset)...);
-			return functional::hash_combine_2(hash1, hash2);
+			member_layout<T> layout{};
+
+			std::size_t offset = 0;
+			std::size_t alignment = 1;
+			std::size_t run_begin = layout.size;
+
+			[&]<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> void
+			{
+				const auto f = [&]<std::size_t I>() noexcept -> void
+				{
+					using type = meta::member_type_of_index<I, const T&>;
+
+					const auto aligned_offset = (offset + alignof(type) - 1) / alignof(type) * alignof(type);
+
+					if constexpr (std::has_unique_object_representations_v<type>)
+					{
+						layout.bytewise[I] = true;
+
+						if (merge and run_begin != layout.size and aligned_offset == offset)
+						{
+							layout.run_size[run_begin] += sizeof(type);
+						}
+						else
+						{
+							run_begin = I;
+							layout.run_size[I] = sizeof(type);
+						}
+					}
+					else
+					{
+						run_begin = layout.size;
+					}
+
+					offset = aligned_offset + sizeof(type);
+					alignment = std::ranges::max(alignment, alignof(type));
+				};
+
+				(f.template operator()<Index>(), ...);
+			}(std::make_index_sequence<layout.size>{});
+
+			for (std::size_t i = 0; i < layout.size; ++i)
+			{
+				layout.run_end[i] = layout.bytewise[i] and (i + 1 == layout.size or not layout.bytewise[i + 1] or layout.run_size[i + 1] != 0);
+				layout.max_run_size = std::ranges::max(layout.max_run_size, layout.run_size[i]);
+			}
+			layout.object_size = (offset + alignment - 1) / alignment * alignment;
+
+			return layout;
 		}
+
+		template<typename T>
+		constexpr auto member_layout_of = []() noexcept -> member_layout<T>
+		{
+			if constexpr (std::is_aggregate_v<T> and std::is_standard_layout_v<T>)
+			{
+				// something we do not understand (e.g. reference members), do not merge anything
+				if (const auto layout = hash_detail::make_member_layout<T>(true);
+					layout.object_size == sizeof(T))
+				{
+					return layout;
+				}
+			}
+
+			return hash_detail::make_member_layout<T>(false);
+		}();
+	}
+
+	/**
+	 * @brief Hash all members of @c object in a single pass.
+	 * The contiguous members that can be hashed by their object representation (@c std::has_unique_object_representations) are hashed as one memory block,
+	 * the floating point members are hashed by value (+0.0 == -0.0), the string members by @c hash_64, the nested aggregates recursively, and the others by @c std::hash.
+	 * @note The result is the same whether it is evaluated at compile time or not.
+	 */
+	template<meta::known_member_t T>
+	[[nodiscard]] constexpr auto hash_of(const T& object, const hash_result_type seed = 0) noexcept -> hash_result_type
+	{
+		auto result = seed;
+
+		// runtime
+		const char* run_begin = nullptr;
+		// compile time
+		std::array<char, hash_detail::member_layout_of<T>.max_run_size> run_buffer{};
+
+		std::size_t run_size = 0;
+
+		meta::member_walk(
+			[&]<std::size_t Index, typename M>(const M& member) noexcept -> void
+			{
+				if constexpr (hash_detail::member_layout_of<T>.bytewise[Index])
+				{
+					PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+					{
+						const auto bytes = std::bit_cast<std::array<char, sizeof(M)>>(member);
+						std::ranges::copy(bytes, run_buffer.begin() + static_cast<std::ptrdiff_t>(run_size));
+					}
+					else
+					{
+						const auto* p = reinterpret_cast<const char*>(std::addressof(member));
+
+						if constexpr (hash_detail::member_layout_of<T>.run_size[Index] != 0)
+						{
+							run_begin = p;
+						}
+						else
+						{
+							PROMETHEUS_PLATFORM_ASSUME(p == run_begin + run_size);
+						}
+					}
+
+					run_size += sizeof(M);
+
+					if constexpr (hash_detail::member_layout_of<T>.run_end[Index])
+					{
+						PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+						{
+							result = functional::hash_64({run_buffer.data(), run_size}, result);
+						}
+						else
+						{
+							result = functional::hash_64({run_begin, run_size}, result);
+						}
+
+						run_size = 0;
+					}
+				}
+				else if constexpr (std::is_convertible_v<const M&, std::basic_string_view<char>>)
+				{
+					result = functional::hash_combine_2(result, functional::hash_64(member));
+				}
+				else if constexpr (std::is_same_v<M, float> or std::is_same_v<M, double>)
+				{
+					using integer_type = std::conditional_t<sizeof(M) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+					// +0.0 == -0.0
+					const auto bits = member == 0 ? integer_type{0} : std::bit_cast<integer_type>(member);
+					result = functional::hash_combine_2(result, hash_detail::mix(bits ^ hash_detail::secret_low[2], hash_detail::secret_low[3]));
+				}
+				else if constexpr (meta::known_member_t<M>)
+				{
+					result = functional::hash_combine_2(result, functional::hash_of(member));
+				}
+				else
+				{
+					result = functional::hash_combine_2(result, hash<M>(member));
+				}
+			},
+			object
+		);
+
+		return result;
 	}
 }
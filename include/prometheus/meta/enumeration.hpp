@@ -7,13 +7,20 @@
 
 #include <array>
 #include <algorithm>
+#include <bit>
+#include <utility>
 #include <limits>
 #include <vector>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <string>
+#include <iterator>
 
 #include <prometheus/macro.hpp>
 
 #include <prometheus/meta/name.hpp>
+#include <prometheus/meta/perfect_hash.hpp>
 
 enum class PrometheusMetaEnumerationEnum123456789987654321: std::uint8_t
 {
@@ -24,8 +31,10 @@ namespace prometheus::meta
 {
 	namespace enumeration_detail
 	{
-		template<auto EnumValue>
-			requires std::is_enum_v<std::decay_t<decltype(EnumValue)>>
+		// name_of<MyEnum::E1>() => "MyEnum::E1"
+		// name_of<MyEnum::E1, static_cast<MyEnum>(42)>() => "MyEnum::E1, (MyEnum)42" (the separator and the unnamed value depend on the compiler)
+		template<auto... EnumValues>
+			requires(sizeof...(EnumValues) != 0 and (std::is_enum_v<std::decay_t<decltype(EnumValues)>> and ...))
 		[[nodiscard]] constexpr auto name_of() noexcept -> std::string_view
 		{
 #if defined(PROMETHEUS_COMPILER_MSVC)
@@ -82,7 +91,7 @@ namespace prometheus::meta
 			// 			// clang-format on
 			// #endif
 
-			auto full_name = meta::get_full_function_name<EnumValue>();
+			auto full_name = meta::get_full_function_name<EnumValues...>();
 
 			// #if defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG)
 			// 			PROMETHEUS_COMPILER_DISABLE_WARNING_POP
@@ -192,6 +201,7 @@ namespace prometheus::meta
 		 * };
 		 * 
 		 * note: Applies only to non-flag enumerations. If you do not specialize enum_range, any enumeration value outside the min/max range will be discarded.
+		 * note: Every value in the range is checked at compile time (64 values per instantiation), a tight range compiles faster.
 		 */
 		template<typename EnumType>
 		struct enum_range
@@ -324,29 +334,9 @@ namespace prometheus::meta
 			}
 		}
 
-		// Check whether a value is a named enumeration value
-		template<auto EnumValue>
-			requires std::is_enum_v<std::decay_t<decltype(EnumValue)>>
-		[[nodiscard]] constexpr auto is_valid_enum() noexcept -> bool
+		// Check whether a name (see name_of) is the name of a named enumeration value
+		[[nodiscard]] constexpr auto is_valid_enum_name(const std::string_view name) noexcept -> bool
 		{
-			// skip the `magic`
-			if constexpr (has_magic_enum_value_v<std::decay_t<decltype(EnumValue)>>)
-			{
-				if constexpr (EnumValue == has_magic_enum_value<std::decay_t<decltype(EnumValue)>>::magic)
-				{
-					return false;
-				}
-			}
-
-			// #if defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG)
-			// 			PROMETHEUS_COMPILER_DISABLE_WARNING_PUSH
-// 			// clang-format off
-// 			PROMETHEUS_COMPILER_DISABLE_WARNING(-Wenum-constexpr-conversion)
-			// 			// clang-format on
-			// #endif
-
-			constexpr auto name = name_of<EnumValue>();
-
 			// MSVC
 			// (enum MyEnum)0x1
 			// `anonymous-namespace'::(enum MyEnum)0x1
@@ -370,6 +360,31 @@ namespace prometheus::meta
 #else
 #error "fixme"
 #endif
+		}
+
+		// Check whether a value is a named enumeration value
+		template<auto EnumValue>
+			requires std::is_enum_v<std::decay_t<decltype(EnumValue)>>
+		[[nodiscard]] constexpr auto is_valid_enum() noexcept -> bool
+		{
+			// skip the `magic`
+			if constexpr (has_magic_enum_value_v<std::decay_t<decltype(EnumValue)>>)
+			{
+				if constexpr (EnumValue == has_magic_enum_value<std::decay_t<decltype(EnumValue)>>::magic)
+				{
+					return false;
+				}
+			}
+
+			// #if defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG)
+			// 			PROMETHEUS_COMPILER_DISABLE_WARNING_PUSH
+// 			// clang-format off
+// 			PROMETHEUS_COMPILER_DISABLE_WARNING(-Wenum-constexpr-conversion)
+			// 			// clang-format on
+			// #endif
+
+			constexpr auto name = name_of<EnumValue>();
+			return is_valid_enum_name(name);
 
 			// #if defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG)
 			// 			PROMETHEUS_COMPILER_DISABLE_WARNING_POP
@@ -434,137 +449,224 @@ namespace prometheus::meta
 		}
 
 		// ==============================================================
-		// FLAG
+		// PROBE
 		// ==============================================================
 
-		enum class FlagBehavior : std::uint8_t
-		{
-			// Only single-bit values (powers of two)
-			SINGLE_BIT_ONLY,
-			// All combinations of consecutive bits
-			ALLOW_COMBINATION,
-		};
+		// The number of candidates checked by one instantiation of name_of.
+		// Every instantiation costs the compiler a function signature to print and parse,
+		// putting 64 values in one signature is much cheaper than 64 signatures.
+		constexpr std::size_t probe_chunk_size = 64;
 
-		// Generates a bitmask with 'Count' consecutive bits starting from chunk 'Index'
-		// Returns a value where bits at positions [Index*Count, Index*Count+Count-1] are set to 1
-		// Example: flag_get_contiguous_bits<MyEnum, 3, 1>() with 8-bit underlying type would return 0b00011100
-		template<typename EnumType, std::size_t Count, std::size_t Index>
-			requires std::is_enum_v<EnumType>
-		[[nodiscard]] constexpr auto flag_get_contiguous_bits() noexcept -> std::underlying_type_t<EnumType>
+		// name_of<MyEnum::E1, static_cast<MyEnum>(42), MyEnum::E3>() => "MyEnum::E1, (MyEnum)42, MyEnum::E3" => 0b101
+		// The names are separated by the top-level commas, std::nullopt if the list does not contain exactly `count` names.
+		[[nodiscard]] constexpr auto probe_parse(const std::string_view names, const std::size_t count) noexcept -> std::optional<std::uint64_t>
 		{
-			using type = std::underlying_type_t<EnumType>;
+			std::uint64_t mask = 0;
+			std::size_t index = 0;
+			std::size_t depth = 0;
+			std::size_t begin = 0;
 
-			// Create sequence of bit positions [0, digits-1] where 'digits' is the number of bits in the underlying type
-			constexpr auto index_sequence = std::views::iota(static_cast<type>(0), static_cast<type>(std::numeric_limits<type>::digits));
+			for (std::size_t i = 0; i <= names.size(); ++i)
+			{
+				if (i == names.size() or (depth == 0 and names[i] == ','))
+				{
+					if (index == count)
+					{
+						return std::nullopt;
+					}
 
-			// Split the sequence into chunks of size 'Count'
-			// Each chunk represents a group of consecutive bit positions
-			constexpr auto index_chunk = index_sequence | std::views::chunk(static_cast<type>(Count));
+					auto name = names.substr(begin, i - begin);
+					while (name.starts_with(' '))
+					{
+						name.remove_prefix(1);
+					}
 
-			// Select the specific chunk at position 'Index'
-			// This contains 'Count' consecutive bit positions
-			constexpr auto indices = index_chunk[Index];
+					if (is_valid_enum_name(name))
+					{
+						mask |= std::uint64_t{1} << index;
+					}
 
-			// Generate bitmask by setting bits at all positions in the selected chunk
-			// Fold left combines all positions using bitwise OR
-			constexpr auto bits = std::ranges::fold_left(
-				indices,
-				static_cast<type>(0),
-				[](const auto total, const auto current) noexcept -> auto
+					index += 1;
+					begin = i + 1;
+					continue;
+				}
+
+				switch (names[i])
 				{
-					// Set bits at position 'current' by left-shifting 1
-					return total | (type{1} << current);
+					case '(':
+					case '<':
+					case '[':
+					case '{':
+					{
+						depth += 1;
+						break;
+					}
+					case ')':
+					case '>':
+					case ']':
+					case '}':
+					{
+						if (depth == 0)
+						{
+							return std::nullopt;
+						}
+						depth -= 1;
+						break;
+					}
+					default:
+					{
+						break;
+					}
 				}
-			);
+			}
 
-			return bits;
+			if (index != count or depth != 0)
+			{
+				return std::nullopt;
+			}
+			return mask;
 		}
 
-		// Generates all valid enum values
-		template<typename EnumType, FlagBehavior Behavior>
+		// Check the candidates [Offset, Offset + Count), bit N of the result => Candidates::at(Offset + N) is a named enumeration value
+		template<typename EnumType, typename Candidates, std::size_t Offset, std::size_t Count>
+			requires std::is_enum_v<EnumType> and (Count != 0 and Count <= probe_chunk_size)
+		[[nodiscard]] constexpr auto probe_chunk() noexcept -> std::uint64_t
+		{
+			return []<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> std::uint64_t
+			{
+				std::uint64_t mask;
+
+				if constexpr (constexpr auto parsed = probe_parse(name_of<static_cast<EnumType>(Candidates::at(Offset + Index))...>(), Count);
+					parsed.has_value())
+				{
+					mask = *parsed;
+
+					// skip the `magic`
+					if constexpr (has_magic_enum_value_v<EnumType>)
+					{
+						constexpr auto magic = std::to_underlying(has_magic_enum_value<EnumType>::magic);
+						mask &= ~((Candidates::at(Offset + Index) == magic ? std::uint64_t{1} << Index : 0) | ...);
+					}
+				}
+				else
+				{
+					// the compiler printed something we cannot split, check the values one by one
+					mask = ((is_valid_enum<EnumType, Candidates::at(Offset + Index)>() ? std::uint64_t{1} << Index : 0) | ...);
+				}
+
+				return mask;
+			}(std::make_index_sequence<Count>{});
+		}
+
+		// Collect every named enumeration value in Candidates (in the order of Candidates)
+		// Candidates::size => the number of candidates
+		// Candidates::at(index) => the underlying value of the candidate
+		template<typename EnumType, typename Candidates>
 			requires std::is_enum_v<EnumType>
-		[[nodiscard]] constexpr auto flag_collect_values() noexcept -> std::vector<EnumType>
+		[[nodiscard]] constexpr auto probe_values() noexcept -> std::vector<EnumType>
 		{
-			// Get number of bits in the underlying type
-			constexpr auto digits = std::numeric_limits<std::underlying_type_t<EnumType>>::digits;
+			constexpr std::size_t size = Candidates::size;
+			constexpr auto chunk_count = (size + probe_chunk_size - 1) / probe_chunk_size;
 
-			// Container for valid enum values
 			std::vector<EnumType> values{};
 
-			// Always include zero value if it's valid
-			// Zero often represents "no flags set" in flag enums
-			if constexpr (is_valid_enum<EnumType, 0>())
+			const auto check = [&values]<std::size_t Offset>() noexcept -> void
 			{
-				values.push_back(static_cast<EnumType>(0));
-			}
+				constexpr auto count = std::ranges::min(probe_chunk_size, size - Offset);
+
+				for (auto mask = probe_chunk<EnumType, Candidates, Offset, count>(); mask != 0; mask &= mask - 1)
+				{
+					values.push_back(static_cast<EnumType>(Candidates::at(Offset + static_cast<std::size_t>(std::countr_zero(mask)))));
+				}
+			};
 
-			if constexpr (Behavior == FlagBehavior::SINGLE_BIT_ONLY)
+			[check]<std::size_t... Chunk>(std::index_sequence<Chunk...>) noexcept -> void
 			{
-				// MODE 1: Only single-bit flags (powers of two)
-				// Example: 0b00000001, 0b00000010, 0b00000100, etc.
+				(check.template operator()<Chunk * probe_chunk_size>(), ...);
+			}(std::make_index_sequence<chunk_count>{});
 
-				// Single bits only
-				constexpr std::size_t this_count = 1;
+			return values;
+		}
 
-				// Lambda to check and add a specific single-bit value
-				const auto check = [&values]<std::size_t ThisIndex>() noexcept -> void
-				{
-					// Generate bitmask for a single bit at position ThisIndex
-					if constexpr (constexpr auto bits = flag_get_contiguous_bits<EnumType, this_count, ThisIndex>();
-						is_valid_enum<EnumType, bits>())
-					{
-						values.push_back(static_cast<EnumType>(bits));
-					}
-				};
+		// ==============================================================
+		// FLAG
+		// ==============================================================
 
-				// Calculate how many single-bit positions we need to check
-				constexpr auto indices_count = digits / this_count + (digits % this_count == 0 ? 0 : 1);
+		enum class FlagBehavior : std::uint8_t
+		{
+			// Only single-bit values (powers of two)
+			SINGLE_BIT_ONLY,
+			// All combinations of consecutive bits
+			ALLOW_COMBINATION,
+		};
 
-				// Iterate over all possible bit positions using compile-time indices
-				[check]<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> void
-				{
-					(check.template operator()<Index>(), ...);
-				}(std::make_index_sequence<indices_count>{});
-			}
-			else
+		// 0, every single bit, and (ALLOW_COMBINATION) every run of consecutive bits
+		// Example (8-bit underlying type, ALLOW_COMBINATION):
+		// 0b0000'0000
+		// 0b0000'0001, 0b0000'0010, ..., 0b1000'0000 (1 bit)
+		// 0b0000'0011, 0b0000'1100, ..., 0b1100'0000 (2 bits)
+		// 0b0000'0111, 0b0011'1000, (0b1100'0000 already listed) (3 bits)
+		// ...
+		template<typename EnumType, FlagBehavior Behavior>
+			requires std::is_enum_v<EnumType>
+		struct flag_candidates
+		{
+			using type = std::underlying_type_t<EnumType>;
+			using unsigned_type = std::make_unsigned_t<type>;
+
+			[[nodiscard]] constexpr static auto generate() noexcept -> std::vector<type>
 			{
-				// MODE 2: All combinations of consecutive bits
-				// Includes single bits, pairs, triples, etc.
-				// Example: 0b00000011, 0b00000111, 0b00001110, etc.
+				// Get number of bits in the underlying type
+				constexpr auto digits = std::numeric_limits<type>::digits;
+				constexpr auto max_count = Behavior == FlagBehavior::SINGLE_BIT_ONLY ? 1 : digits;
 
-				// Iterate over all possible group sizes (1 to digits)
-				[&values]<std::size_t... Count>(std::index_sequence<Count...>) noexcept -> void
+				// Zero often represents "no flags set" in flag enums
+				std::vector<type> result{type{0}};
+
+				for (auto count = 1; count <= max_count; ++count)
 				{
-					// Lambda to process each possible group size
-					const auto traversal = [&values]<std::size_t ThisCount>() noexcept -> void
+					for (auto first = 0; first < digits; first += count)
 					{
-						// Lambda to check and add a specific bit pattern
-						const auto check = [&values]<std::size_t ThisIndex>() noexcept -> void
-						{
-							// Generate bitmask for ThisCount consecutive bits starting at chunk ThisIndex
-							if constexpr (constexpr auto bits = flag_get_contiguous_bits<EnumType, ThisCount, ThisIndex>();
-								is_valid_enum<EnumType, bits>())
-							{
-								values.push_back(static_cast<EnumType>(bits));
-							}
-						};
+						const auto last = std::ranges::min(first + count, digits);
 
-						// Calculate how many positions of this group size we can fit
-						constexpr auto indices_count = digits / ThisCount + (digits % ThisCount == 0 ? 0 : 1);
+						unsigned_type bits = 0;
+						for (auto bit = first; bit < last; ++bit)
+						{
+							bits |= static_cast<unsigned_type>(unsigned_type{1} << bit);
+						}
 
-						// Check all possible starting positions for this group size
-						return [check]<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> void
+						// the last run of a count may be shorter than the count and equal to a run listed before
+						if (std::ranges::find(result, static_cast<type>(bits)) == result.end())
 						{
-							(check.template operator()<Index>(), ...);
-						}(std::make_index_sequence<indices_count>{});
-					};
+							result.push_back(static_cast<type>(bits));
+						}
+					}
+				}
 
-					// Process all group sizes from 1 to 'digits'
-					(traversal.template operator()<Count + 1>(), ...);
-				}(std::make_index_sequence<digits>{});
+				return result;
 			}
 
-			return values;
+			constexpr static std::size_t size = generate().size();
+
+			constexpr static auto values = []() noexcept -> std::array<type, size>
+			{
+				std::array<type, size> result{};
+				std::ranges::copy(generate(), result.data());
+				return result;
+			}();
+
+			[[nodiscard]] constexpr static auto at(const std::size_t index) noexcept -> type
+			{
+				return values[index];
+			}
+		};
+
+		// Generates all valid enum values
+		template<typename EnumType, FlagBehavior Behavior>
+			requires std::is_enum_v<EnumType>
+		[[nodiscard]] constexpr auto flag_collect_values() noexcept -> std::vector<EnumType>
+		{
+			return probe_values<EnumType, flag_candidates<EnumType, Behavior>>();
 		}
 
 		template<typename EnumType, FlagBehavior Behavior>
@@ -662,130 +764,84 @@ namespace prometheus::meta
 		// ENUM
 		// ==============================================================
 
-		// Finds the minimum valid enum value
-
+		// [user_defined::enum_range<EnumType>::min, user_defined::enum_range<EnumType>::max]
 		template<typename EnumType>
-		[[nodiscard]] constexpr auto enum_min_value() noexcept -> EnumType
+			requires std::is_enum_v<EnumType>
+		struct enum_candidates
 		{
 			using type = std::underlying_type_t<EnumType>;
+			using unsigned_type = std::make_unsigned_t<type>;
 
-			constexpr auto min = user_defined::enum_range<EnumType>::min;
-			constexpr auto max = user_defined::enum_range<EnumType>::max;
+			constexpr static auto min = static_cast<type>(user_defined::enum_range<EnumType>::min);
+			constexpr static auto max = static_cast<type>(user_defined::enum_range<EnumType>::max);
+			static_assert(min <= max);
 
-			if constexpr (is_valid_enum<EnumType, min>())
+			// note: computed in the unsigned type, a signed range (e.g. [-128, 127]) does not overflow
+			constexpr static std::size_t size = static_cast<std::size_t>(static_cast<unsigned_type>(static_cast<unsigned_type>(max) - static_cast<unsigned_type>(min))) + 1;
+
+			[[nodiscard]] constexpr static auto at(const std::size_t index) noexcept -> type
 			{
-				return static_cast<EnumType>(min);
+				return static_cast<type>(static_cast<unsigned_type>(static_cast<unsigned_type>(min) + static_cast<unsigned_type>(index)));
 			}
-			else
-			{
-				type result = min;
-				const auto process = [&result]<type Current>() noexcept -> bool
-				{
-					if constexpr (is_valid_enum<EnumType, Current>())
-					{
-						result = Current;
-						return false;
-					}
-					else
-					{
-						return true;
-					}
-				};
-
-				[process]<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> void
-				{
-					(process.template operator()<min + 1 + Index>() and ...);
-				}(std::make_index_sequence<max - min>{});
+		};
 
-				return static_cast<EnumType>(result);
-			}
+		template<typename EnumType>
+			requires std::is_enum_v<EnumType>
+		[[nodiscard]] constexpr auto enum_collect_values() noexcept -> std::vector<EnumType>
+		{
+			return probe_values<EnumType, enum_candidates<EnumType>>();
 		}
 
-		// Finds the maximum valid enum value
+		template<typename EnumType>
+			requires std::is_enum_v<EnumType>
+		struct cached_enum_values_size : std::integral_constant<std::size_t, enum_collect_values<EnumType>().size()> {};
 
 		template<typename EnumType>
-		[[nodiscard]] constexpr auto enum_max_value() noexcept -> EnumType
+			requires std::is_enum_v<EnumType>
+		struct cached_enum_values
 		{
-			using type = std::underlying_type_t<EnumType>;
-
-			constexpr auto min = user_defined::enum_range<EnumType>::min;
-			constexpr auto max = user_defined::enum_range<EnumType>::max;
+			constexpr static auto value = enumeration_detail::save_values<cached_enum_values_size<EnumType>::value>(enum_collect_values<EnumType>());
+		};
 
-			if constexpr (is_valid_enum<EnumType, max>())
+		// Finds the minimum valid enum value (the values are collected in ascending order)
+		template<typename EnumType>
+			requires std::is_enum_v<EnumType>
+		[[nodiscard]] constexpr auto enum_min_value() noexcept -> EnumType
+		{
+			if constexpr (constexpr auto& values = cached_enum_values<EnumType>::value;
+				values.empty())
 			{
-				return static_cast<EnumType>(max);
+				return static_cast<EnumType>(enum_candidates<EnumType>::min);
 			}
 			else
 			{
-				type result = max;
-				const auto process = [&result]<type Current>() noexcept -> bool
-				{
-					if constexpr (is_valid_enum<EnumType, Current>())
-					{
-						result = Current;
-						return false;
-					}
-					else
-					{
-						return true;
-					}
-				};
-
-				[process]<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> void
-				{
-					(process.template operator()<max - 1 - Index>() and ...);
-				}(std::make_index_sequence<max - min>{});
-
-				return static_cast<EnumType>(result);
+				return values.front();
 			}
 		}
 
+		// Finds the maximum valid enum value (the values are collected in ascending order)
 		template<typename EnumType>
 			requires std::is_enum_v<EnumType>
-		struct cached_enum_min_value : std::integral_constant<EnumType, enum_min_value<EnumType>()> {};
-
-		template<typename EnumType>
-			requires std::is_enum_v<EnumType>
-		struct cached_enum_max_value : std::integral_constant<EnumType, enum_max_value<EnumType>()> {};
-
-		template<typename EnumType>
-			requires std::is_enum_v<EnumType>
-		[[nodiscard]] constexpr auto enum_collect_values() noexcept -> std::vector<EnumType>
+		[[nodiscard]] constexpr auto enum_max_value() noexcept -> EnumType
 		{
-			using type = std::underlying_type_t<EnumType>;
-
-			constexpr auto min = cached_enum_min_value<EnumType>::value;
-			constexpr auto max = cached_enum_max_value<EnumType>::value;
-			constexpr auto range = static_cast<type>(max) - static_cast<type>(min) + 1;
-
-			std::vector<EnumType> values{};
-
-			const auto check = [&values]<type Value>() noexcept -> void
+			if constexpr (constexpr auto& values = cached_enum_values<EnumType>::value;
+				values.empty())
 			{
-				if constexpr (is_valid_enum<EnumType, Value>())
-				{
-					values.push_back(static_cast<EnumType>(Value));
-				}
-			};
-
-			[check]<std::size_t... Index>(std::index_sequence<Index...>) noexcept -> void
+				return static_cast<EnumType>(enum_candidates<EnumType>::max);
+			}
+			else
 			{
-				(check.template operator()<static_cast<type>(min) + Index>(), ...);
-			}(std::make_index_sequence<range>{});
-
-			return values;
+				return values.back();
+			}
 		}
 
 		template<typename EnumType>
 			requires std::is_enum_v<EnumType>
-		struct cached_enum_values_size : std::integral_constant<std::size_t, enum_collect_values<EnumType>().size()> {};
+		struct cached_enum_min_value : std::integral_constant<EnumType, enum_min_value<EnumType>()> {};
 
 		template<typename EnumType>
 			requires std::is_enum_v<EnumType>
-		struct cached_enum_values
-		{
-			constexpr static auto value = enumeration_detail::save_values<cached_enum_values_size<EnumType>::value>(enum_collect_values<EnumType>());
-		};
+		struct cached_enum_max_value : std::integral_constant<EnumType, enum_max_value<EnumType>()> {};
 
 		template<typename EnumType, std::size_t Index>
 			requires std::is_enum_v<EnumType> and (Index < cached_enum_values_size<EnumType>::value)
@@ -901,8 +957,143 @@ namespace prometheus::meta
 		return names_of<EnumType, user_defined::enum_name_policy<EnumType>::value>();
 	}
 
+	namespace enumeration_detail
+	{
+		template<typename EnumType, EnumNamePolicy Policy>
+			requires std::is_enum_v<EnumType>
+		struct cached_name_table
+		{
+			constexpr static auto size = names_of<EnumType, Policy>().size();
+
+			constexpr static auto values = []() noexcept -> std::array<EnumType, size>
+			{
+				constexpr auto list = names_of<EnumType, Policy>();
+
+				std::array<EnumType, size> result{};
+				std::ranges::copy(list | std::views::keys, result.data());
+				return result;
+			}();
+
+			// note: the names must be unique (user_defined::enum_value_name), otherwise it is a compile error
+			constexpr static auto table = []() noexcept -> PerfectHash<size>
+			{
+				constexpr auto list = names_of<EnumType, Policy>();
+
+				std::array<std::string_view, size> result{};
+				std::ranges::copy(list | std::views::values, result.data());
+				return meta::make_perfect_hash(result);
+			}();
+		};
+	}
+
 	constexpr std::string_view enum_name_not_found{"?"};
 
+	namespace enumeration_detail
+	{
+		template<typename EnumType, EnumNamePolicy Policy>
+			requires std::is_enum_v<EnumType>
+		struct cached_value_table
+		{
+			using value_type = std::underlying_type_t<EnumType>;
+			using unsigned_value_type = std::make_unsigned_t<value_type>;
+
+			constexpr static auto size = names_of<EnumType, Policy>().size();
+
+			// sorted by value
+			constexpr static auto sorted = []() noexcept -> std::array<std::pair<value_type, std::string_view>, size>
+			{
+				constexpr auto list = names_of<EnumType, Policy>();
+
+				std::array<std::pair<value_type, std::string_view>, size> result{};
+				std::ranges::transform(
+					list,
+					result.begin(),
+					[](const auto& pair) noexcept -> std::pair<value_type, std::string_view>
+					{
+						return {std::to_underlying(pair.first), pair.second};
+					}
+				);
+				std::ranges::sort(result);
+				return result;
+			}();
+
+			constexpr static auto values = []() noexcept -> std::array<value_type, size>
+			{
+				std::array<value_type, size> result{};
+				std::ranges::copy(sorted | std::views::keys, result.begin());
+				return result;
+			}();
+
+			// note: the distance is calculated in 64-bit unsigned, it works for both signed and unsigned underlying types
+			constexpr static std::uint64_t min = size == 0 ? 0 : static_cast<std::uint64_t>(sorted.front().first);
+			constexpr static std::uint64_t range = size == 0 ? 0 : static_cast<std::uint64_t>(sorted.back().first) - min + 1;
+
+			// values[i] => names[value - min], if the range is compact enough (at least 1/4 of the table is used)
+			constexpr static auto is_dense = not is_flag<EnumType>() and size != 0 and range <= size * 4 + 8;
+
+			constexpr static auto dense = []() noexcept -> std::array<std::string_view, is_dense ? range : 0>
+			{
+				std::array<std::string_view, is_dense ? range : 0> result{};
+				if constexpr (is_dense)
+				{
+					std::ranges::fill(result, enum_name_not_found);
+					for (const auto& [value, name]: sorted)
+					{
+						result[static_cast<std::uint64_t>(value) - min] = name;
+					}
+				}
+				return result;
+			}();
+
+			// bits[n] => the name of (1 << n), for flags
+			constexpr static auto bits = []() noexcept -> std::array<std::string_view, std::numeric_limits<unsigned_value_type>::digits>
+			{
+				std::array<std::string_view, std::numeric_limits<unsigned_value_type>::digits> result{};
+				std::ranges::fill(result, enum_name_not_found);
+				for (const auto& [value, name]: sorted)
+				{
+					if (const auto v = static_cast<unsigned_value_type>(value);
+						std::has_single_bit(v))
+					{
+						result[static_cast<std::size_t>(std::countr_zero(v))] = name;
+					}
+				}
+				return result;
+			}();
+
+			[[nodiscard]] constexpr static auto name_of(const EnumType enum_value) noexcept -> std::string_view
+			{
+				const auto value = std::to_underlying(enum_value);
+
+				if constexpr (is_flag<EnumType>())
+				{
+					// a single flag
+					if (const auto v = static_cast<unsigned_value_type>(value);
+						std::has_single_bit(v))
+					{
+						return bits[static_cast<std::size_t>(std::countr_zero(v))];
+					}
+				}
+				else if constexpr (is_dense)
+				{
+					if (const auto offset = static_cast<std::uint64_t>(value) - min;
+						offset < range)
+					{
+						return dense[offset];
+					}
+					return enum_name_not_found;
+				}
+
+				if (const auto it = std::ranges::lower_bound(values, value);
+					it != values.end() and *it == value)
+				{
+					return sorted[static_cast<std::size_t>(it - values.begin())].second;
+				}
+				return enum_name_not_found;
+			}
+		};
+	}
+
 	// enum class MyEnum
 	// {
 	//		E1 = 0,
@@ -941,21 +1132,7 @@ namespace prometheus::meta
 		requires std::is_enum_v<EnumType>
 	[[nodiscard]] constexpr auto name_of(const EnumType enum_value) noexcept -> std::string_view
 	{
-		constexpr auto list = names_of<EnumType, Policy>();
-
-		if (const auto it = std::ranges::find(
-				list,
-				enum_value,
-				[](const auto& pair) noexcept -> EnumType
-				{
-					return pair.first;
-				}
-			);
-			it != std::ranges::end(list))
-		{
-			return it->second;
-		}
-		return enum_name_not_found;
+		return enumeration_detail::cached_value_table<EnumType, Policy>::name_of(enum_value);
 	}
 
 	template<typename EnumType>
@@ -987,61 +1164,141 @@ namespace prometheus::meta
 	// full_name_of(MyFlag::F3 | MyFlag::F4) => "F3|F4"
 	// full_name_of(static_cast<MyFlag>(0x1'0000)) => "?" (enum_name_not_found)
 	//
+	// full_name_size(MyFlag::F5) => 5
+	// full_name_to(std::back_inserter(string), MyFlag::F5) => string += "F1|F2"
+	// full_name_to(std::span{buffer, 3}, MyFlag::F5) => 5, buffer = "F1|"
+	//
 	// name_of<MyFlag>(0x0001) => "F1"
 	// name_of<MyFlag>(0x0010) => "F2"
 	// name_of<MyFlag>(0x0001 | 0x0010) => "F1|F2"
 	// name_of<MyFlag>(0x0100 | 0x1000) => "F3|F4"
 	// name_of<MyFlag>(0x1'0000) => "?" (enum_name_not_found)
 
-	template<EnumNamePolicy Policy, typename Allocator = std::allocator<char>, typename EnumType>
-		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
-	[[nodiscard]] constexpr auto full_name_of(
-		const EnumType enum_value,
-		const std::string_view split = "|",
-		const Allocator& allocator = {}
-	) noexcept -> std::basic_string<char, std::char_traits<char>, Allocator>
+	namespace enumeration_detail
 	{
-		const auto value = std::to_underlying(enum_value);
-		const auto unsigned_value = static_cast<std::make_unsigned_t<std::underlying_type_t<EnumType>>>(value);
+		// name_of(single_bit_0), split, name_of(single_bit_1), split, ...
+		template<EnumNamePolicy Policy, typename EnumType, typename Function>
+			requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+		constexpr auto visit_full_name(const EnumType enum_value, const std::string_view split, Function function) noexcept -> void
+		{
+			using unsigned_type = std::make_unsigned_t<std::underlying_type_t<EnumType>>;
+			using table_type = cached_value_table<EnumType, Policy>;
 
-		std::basic_string<char, std::char_traits<char>, Allocator> result{allocator};
+			auto bits = static_cast<unsigned_type>(std::to_underlying(enum_value));
+			for (auto first = true; bits != 0; first = false)
+			{
+				if (not first)
+				{
+					function(split);
+				}
 
-		if (std::popcount(unsigned_value) == 1)
-		{
-			const auto i = std::countr_zero(unsigned_value);
-			if constexpr (requires { result.append_range(meta::name_of<EnumType, Policy>(1 << i)); })
+				function(table_type::bits[static_cast<std::size_t>(std::countr_zero(bits))]);
+				bits = static_cast<unsigned_type>(bits & (bits - 1));
+			}
+		}
+	}
+
+	/**
+	 * @brief The size of @c full_name_of(enum_value, split), without building the string.
+	 */
+	template<EnumNamePolicy Policy, typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	[[nodiscard]] constexpr auto full_name_size(const EnumType enum_value, const std::string_view split = "|") noexcept -> std::size_t
+	{
+		std::size_t size = 0;
+		enumeration_detail::visit_full_name<Policy>(
+			enum_value,
+			split,
+			[&size](const std::string_view part) noexcept -> void
 			{
-				result.append_range(meta::name_of<EnumType, Policy>(1 << i));
+				size += part.size();
 			}
-			else
+		);
+		return size;
+	}
+
+	template<typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	[[nodiscard]] constexpr auto full_name_size(const EnumType enum_value, const std::string_view split = "|") noexcept -> std::size_t
+	{
+		return meta::full_name_size<user_defined::enum_name_policy<EnumType>::value, EnumType>(enum_value, split);
+	}
+
+	/**
+	 * @brief Write @c full_name_of(enum_value, split) to @c out, nothing is allocated.
+	 * @return The iterator past the last character written.
+	 */
+	template<EnumNamePolicy Policy, std::output_iterator<char> OutputIterator, typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	constexpr auto full_name_to(OutputIterator out, const EnumType enum_value, const std::string_view split = "|") noexcept -> OutputIterator
+	{
+		enumeration_detail::visit_full_name<Policy>(
+			enum_value,
+			split,
+			[&out](const std::string_view part) noexcept -> void
 			{
-				result.append(meta::name_of<EnumType, Policy>(1 << i));
+				out = std::ranges::copy(part, std::move(out)).out;
 			}
+		);
+		return out;
+	}
 
-			return result;
-		}
+	template<std::output_iterator<char> OutputIterator, typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	constexpr auto full_name_to(OutputIterator out, const EnumType enum_value, const std::string_view split = "|") noexcept -> OutputIterator
+	{
+		return meta::full_name_to<user_defined::enum_name_policy<EnumType>::value, OutputIterator, EnumType>(std::move(out), enum_value, split);
+	}
 
-		for (std::size_t i = 0; i < std::numeric_limits<std::underlying_type_t<EnumType>>::digits; ++i)
-		{
-			if (value & (1 << i))
+	/**
+	 * @brief Write @c full_name_of(enum_value, split) to @c buffer, the name is truncated if the buffer is not large enough.
+	 * @return The size of the full name, the name is complete if it is not greater than @c buffer.size().
+	 */
+	template<EnumNamePolicy Policy, typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	constexpr auto full_name_to(const std::span<char> buffer, const EnumType enum_value, const std::string_view split = "|") noexcept -> std::size_t
+	{
+		std::size_t size = 0;
+		enumeration_detail::visit_full_name<Policy>(
+			enum_value,
+			split,
+			[buffer, &size](const std::string_view part) noexcept -> void
 			{
-				if constexpr (requires { result.append_range(meta::name_of<EnumType, Policy>(1 << i)); })
-				{
-					result.append_range(meta::name_of<EnumType, Policy>(1 << i));
-					result.append_range(split);
-				}
-				else
+				if (size < buffer.size())
 				{
-					result.append(meta::name_of<EnumType, Policy>(1 << i));
-					result.append(split);
+					const auto n = std::ranges::min(part.size(), buffer.size() - size);
+					std::ranges::copy_n(part.data(), static_cast<std::ptrdiff_t>(n), buffer.data() + size);
 				}
+				size += part.size();
 			}
-		}
+		);
+		return size;
+	}
 
-		if (not result.empty())
-		{
-			result.erase(result.size() - split.size(), split.size());
-		}
+	template<typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	constexpr auto full_name_to(const std::span<char> buffer, const EnumType enum_value, const std::string_view split = "|") noexcept -> std::size_t
+	{
+		return meta::full_name_to<user_defined::enum_name_policy<EnumType>::value, EnumType>(buffer, enum_value, split);
+	}
+
+	template<EnumNamePolicy Policy, typename Allocator = std::allocator<char>, typename EnumType>
+		requires(std::is_enum_v<EnumType> and is_flag<EnumType>())
+	[[nodiscard]] constexpr auto full_name_of(
+		const EnumType enum_value,
+		const std::string_view split = "|",
+		const Allocator& allocator = {}
+	) noexcept -> std::basic_string<char, std::char_traits<char>, Allocator>
+	{
+		std::basic_string<char, std::char_traits<char>, Allocator> result{allocator};
+
+		result.resize_and_overwrite(
+			meta::full_name_size<Policy>(enum_value, split),
+			[enum_value, split](char* data, const std::size_t size) noexcept -> std::size_t
+			{
+				return meta::full_name_to<Policy>(std::span{data, size}, enum_value, split);
+			}
+		);
 
 		return result;
 	}
@@ -1105,23 +1362,38 @@ namespace prometheus::meta
 		const std::string_view split
 	) noexcept -> EnumType
 	{
-		constexpr auto list = names_of<EnumType, Policy>();
+		using table_type = enumeration_detail::cached_name_table<EnumType, Policy>;
 
-		// error C2662: `const std::ranges::split_view<std::basic_string_view<char,std::char_traits<char>>,std::basic_string_view<char,std::char_traits<char>>>` => `std::ranges::split_view<std::basic_string_view<char,std::char_traits<char>>,std::basic_string_view<char,std::char_traits<char>>> &`
-		// ReSharper disable once CppLocalVariableMayBeConst
-		auto names = enum_name | std::views::split(split);
 		auto result = std::to_underlying(empty);
 
-		for (const auto& each: names)
+		const auto parse = [&result](const std::string_view s) noexcept -> bool
 		{
-			const std::string_view s{each};
+			if (const auto index = table_type::table.index_of(s);
+				index != table_type::table.npos)
+			{
+				result |= std::to_underlying(table_type::values[index]);
+				return true;
+			}
+			return false;
+		};
 
-			if (const auto it = std::ranges::find(list | std::views::values, s);
-				it != std::ranges::end(list | std::views::values))
+		// the most common case, one name only
+		if (not enum_name.contains(split))
+		{
+			if (not parse(enum_name))
 			{
-				result |= std::to_underlying(it.base()->first);
+				return empty;
 			}
-			else
+			return static_cast<EnumType>(result);
+		}
+
+		// error C2662: `const std::ranges::split_view<std::basic_string_view<char,std::char_traits<char>>,std::basic_string_view<char,std::char_traits<char>>>` => `std::ranges::split_view<std::basic_string_view<char,std::char_traits<char>>,std::basic_string_view<char,std::char_traits<char>>> &`
+		// ReSharper disable once CppLocalVariableMayBeConst
+		auto names = enum_name | std::views::split(split);
+
+		for (const auto& each: names)
+		{
+			if (not parse(std::string_view{each}))
 			{
 				if constexpr (Strict)
 				{
@@ -11,3 +11,4 @@
 #include <prometheus/meta/member.hpp>
 #include <prometheus/meta/to_string.hpp>
 #include <prometheus/meta/dimension.hpp>
+#include <prometheus/meta/perfect_hash.hpp>
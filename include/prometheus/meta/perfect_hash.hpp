@@ -0,0 +1,336 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <vector>
+#include <bit>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <string_view>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/meta/string.hpp>
+#include <prometheus/platform/os.hpp>
+
+namespace prometheus::meta
+{
+	namespace perfect_hash_detail
+	{
+		// average number of keys per bucket
+		constexpr std::size_t bucket_load = 4;
+
+		// the maximum pilot tried for one bucket, then the builder changes the seed
+		constexpr std::uint32_t max_pilot = 1 << 16;
+
+		constexpr std::uint64_t seed_step = 0x9e37'79b9'7f4a'7c15;
+
+		// NOT constexpr, a duplicate key makes `make_perfect_hash` not a constant expression
+		inline auto perfect_hash_duplicate_key() noexcept -> void {}
+
+		// murmur3 finalizer, every input bit affects every output bit
+		[[nodiscard]] constexpr auto avalanche(std::uint64_t h) noexcept -> std::uint64_t
+		{
+			h ^= h >> 33;
+			h *= 0xff51'afd7'ed55'8ccd;
+			h ^= h >> 33;
+			h *= 0xc4ce'b9fe'1a85'ec53;
+			h ^= h >> 33;
+			return h;
+		}
+
+		[[nodiscard]] constexpr auto read(const char* p, const std::size_t size) noexcept -> std::uint64_t
+		{
+			PROMETHEUS_SEMANTIC_IF_NOT_CONSTANT_EVALUATED
+			{
+				if (size == sizeof(std::uint64_t))
+				{
+					std::uint64_t result;
+					std::memcpy(&result, p, sizeof(std::uint64_t));
+
+					if constexpr (std::endian::native == std::endian::big)
+					{
+						result = std::byteswap(result);
+					}
+					return result;
+				}
+			}
+
+			std::uint64_t result = 0;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				result |= static_cast<std::uint64_t>(static_cast<unsigned char>(p[i])) << (i * 8);
+			}
+			return result;
+		}
+
+		// the keys are short (names and keywords), a few multiplications are cheaper than a general purpose hash
+		// note: the result is the same in constant evaluation and at runtime
+		[[nodiscard]] constexpr auto hash_of(const std::string_view key, const std::uint64_t seed) noexcept -> std::uint64_t
+		{
+			auto h = seed ^ (key.size() * seed_step);
+
+			const auto* p = key.data();
+			auto size = key.size();
+			for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t), p += sizeof(std::uint64_t))
+			{
+				h = avalanche(h ^ read(p, sizeof(std::uint64_t)));
+			}
+
+			return avalanche(h ^ read(p, size));
+		}
+
+		// the high half of the hash selects the bucket
+		[[nodiscard]] constexpr auto bucket_of(const std::uint64_t hash, const std::size_t bucket_count) noexcept -> std::size_t
+		{
+			return static_cast<std::size_t>(((hash >> 32) * bucket_count) >> 32);
+		}
+
+		// the hash mixed with the pilot of the bucket selects the slot
+		// note: all bits of the hash take part in it, keys in the same bucket can always be separated (unless their hashes are equal)
+		[[nodiscard]] constexpr auto position_of(const std::uint64_t hash, const std::uint64_t pilot, const std::size_t table_size) noexcept -> std::size_t
+		{
+			return static_cast<std::size_t>(avalanche(hash ^ ((pilot + 1) * seed_step)) & (table_size - 1));
+		}
+	}
+
+	/**
+	 * @brief Perfect hash over a fixed set of @c N distinct strings, built at compile time (see @c make_perfect_hash).
+	 * @note A lookup is one hash, two table reads and one string comparison, it never probes.
+	 * @note The keys are hashed by a small private hash (8-byte chunks through the murmur3 finalizer, see @c perfect_hash_detail::hash_of),
+	 * not @c functional::hash_64, so this header does not depend on functional/hash.hpp (and its reflection), the result is the same in constant evaluation and at runtime.
+	 * @note A duplicate key fails the build at compile time, and terminates at runtime.
+	 * @note The keys are not copied, the table refers to the strings it was built from.
+	 */
+	template<std::size_t N>
+	class PerfectHash
+	{
+	public:
+		using size_type = std::size_t;
+
+		constexpr static size_type key_count = N;
+		// the next power of 2 of N + N / 4: the load factor is above 0.4 and at most N / (N + N / 4),
+		// which is about 0.8 for larger N (but 1.0 for N <= 2, 0.875 for N == 7)
+		constexpr static size_type table_size = std::bit_ceil(std::ranges::max(N + N / 4, size_type{1}));
+		constexpr static size_type bucket_count = std::ranges::max((N + perfect_hash_detail::bucket_load - 1) / perfect_hash_detail::bucket_load, size_type{1});
+
+		constexpr static size_type npos = static_cast<size_type>(-1);
+
+		using index_type = std::conditional_t<(N < std::numeric_limits<std::uint16_t>::max()), std::uint16_t, std::uint32_t>;
+		using pilot_type = std::conditional_t<(perfect_hash_detail::max_pilot <= std::numeric_limits<std::uint16_t>::max() + 1), std::uint16_t, std::uint32_t>;
+
+		constexpr static index_type empty_slot = std::numeric_limits<index_type>::max();
+
+		template<std::size_t M>
+		friend constexpr auto make_perfect_hash(const std::array<std::string_view, M>& keys) noexcept -> PerfectHash<M>;
+
+	private:
+		std::uint64_t seed_;
+		std::array<std::string_view, N> keys_;
+		std::array<pilot_type, bucket_count> pilots_;
+		std::array<index_type, table_size> slots_;
+
+		constexpr PerfectHash() noexcept
+			: seed_{0},
+			  keys_{},
+			  pilots_{},
+			  slots_{} {}
+
+		// false => the seed does not work, try another one
+		constexpr auto build(const std::uint64_t seed) noexcept -> bool
+		{
+			using namespace perfect_hash_detail;
+
+			seed_ = seed;
+			std::ranges::fill(pilots_, pilot_type{0});
+			std::ranges::fill(slots_, empty_slot);
+
+			std::array<std::uint64_t, N> hashes{};
+			std::ranges::transform(
+				keys_,
+				hashes.begin(),
+				[seed](const std::string_view key) noexcept -> std::uint64_t
+				{
+					return hash_of(key, seed);
+				}
+			);
+
+			// no pilot can separate two keys with the same hash
+			{
+				std::array<std::pair<std::uint64_t, index_type>, N> sorted{};
+				for (size_type i = 0; i < N; ++i)
+				{
+					sorted[i] = {hashes[i], static_cast<index_type>(i)};
+				}
+				std::ranges::sort(sorted);
+
+				for (size_type i = 1; i < N; ++i)
+				{
+					if (sorted[i - 1].first != sorted[i].first)
+					{
+						continue;
+					}
+
+					// the same key => the hash of any seed is the same
+					if (const auto is_duplicate_key = keys_[sorted[i - 1].second] == keys_[sorted[i].second];
+						is_duplicate_key)
+					{
+						PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+						{
+							perfect_hash_duplicate_key();
+						}
+						// no seed can ever separate them, never return (and retry) here
+						PROMETHEUS_PLATFORM_BREAKPOINT_OR_TERMINATE_IF(is_duplicate_key, "duplicate key in make_perfect_hash");
+					}
+					return false;
+				}
+			}
+
+			std::vector<std::vector<index_type>> buckets(bucket_count);
+			for (size_type i = 0; i < N; ++i)
+			{
+				buckets[bucket_of(hashes[i], bucket_count)].push_back(static_cast<index_type>(i));
+			}
+
+			// the largest buckets first, they are the hardest to place
+			std::vector<size_type> order(bucket_count);
+			for (size_type i = 0; i < bucket_count; ++i)
+			{
+				order[i] = i;
+			}
+			std::ranges::sort(
+				order,
+				[&buckets](const size_type lhs, const size_type rhs) noexcept -> bool
+				{
+					if (buckets[lhs].size() != buckets[rhs].size())
+					{
+						return buckets[lhs].size() > buckets[rhs].size();
+					}
+					return lhs < rhs;
+				}
+			);
+
+			std::vector<size_type> positions{};
+			for (const auto b: order)
+			{
+				const auto& bucket = buckets[b];
+				if (bucket.empty())
+				{
+					break;
+				}
+
+				auto placed = false;
+				for (std::uint32_t pilot = 0; pilot < max_pilot and not placed; ++pilot)
+				{
+					positions.clear();
+					placed = std::ranges::all_of(
+						bucket,
+						[&](const index_type index) noexcept -> bool
+						{
+							const auto position = position_of(hashes[index], pilot, table_size);
+							if (slots_[position] != empty_slot or std::ranges::find(positions, position) != positions.end())
+							{
+								return false;
+							}
+
+							positions.push_back(position);
+							return true;
+						}
+					);
+
+					if (placed)
+					{
+						pilots_[b] = static_cast<pilot_type>(pilot);
+						for (size_type i = 0; i < bucket.size(); ++i)
+						{
+							slots_[positions[i]] = bucket[i];
+						}
+					}
+				}
+
+				if (not placed)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+	public:
+		/**
+		 * @brief The index (in the list the table was built from) of @c key, or @c npos.
+		 */
+		[[nodiscard]] constexpr auto index_of(const std::string_view key) const noexcept -> size_type
+		{
+			using namespace perfect_hash_detail;
+
+			const auto hash = hash_of(key, seed_);
+			const auto pilot = pilots_[bucket_of(hash, bucket_count)];
+			const auto index = slots_[position_of(hash, pilot, table_size)];
+
+			if (index == empty_slot or keys_[index] != key)
+			{
+				return npos;
+			}
+			return index;
+		}
+
+		[[nodiscard]] constexpr auto contains(const std::string_view key) const noexcept -> bool
+		{
+			return this->index_of(key) != npos;
+		}
+
+		[[nodiscard]] constexpr auto keys() const noexcept -> const std::array<std::string_view, N>&
+		{
+			return keys_;
+		}
+
+		[[nodiscard]] constexpr auto size() const noexcept -> size_type
+		{
+			return N;
+		}
+	};
+
+	// std::array<std::string_view, 3> keys{"GET", "POST", "PUT"};
+	// constexpr auto table = make_perfect_hash(keys);
+	//
+	// table.index_of("POST") => 1
+	// table.index_of("HEAD") => npos
+
+	template<std::size_t N>
+	[[nodiscard]] constexpr auto make_perfect_hash(const std::array<std::string_view, N>& keys) noexcept -> PerfectHash<N>
+	{
+		using namespace perfect_hash_detail;
+
+		PerfectHash<N> result{};
+		result.keys_ = keys;
+
+		for (std::uint64_t seed = 0;; seed += seed_step)
+		{
+			if (result.build(seed))
+			{
+				return result;
+			}
+		}
+	}
+
+	// constexpr auto table = make_perfect_hash<"GET", "POST", "PUT">();
+	//
+	// table.index_of("POST") => 1
+	// table.index_of("HEAD") => npos
+
+	template<basic_fixed_string... Keys>
+		requires(std::is_same_v<typename decltype(Keys)::value_type, char> and ...)
+	[[nodiscard]] constexpr auto make_perfect_hash() noexcept -> PerfectHash<sizeof...(Keys)>
+	{
+		return meta::make_perfect_hash<sizeof...(Keys)>({std::string_view{Keys.value, Keys.size}...});
+	}
+}
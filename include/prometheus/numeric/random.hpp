@@ -5,6 +5,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <span>
+#include <bit>
+#include <limits>
+#include <algorithm>
 #include <random>
 #include <type_traits>
 #include <chrono>
@@ -60,6 +67,118 @@ namespace prometheus::numeric
 
 		template<template<typename> typename Distribution, typename T>
 		constexpr auto is_user_defined_distribution_v = is_user_defined_distribution<Distribution, T>::value;
+
+		// ===================================
+		// BULK GENERATION
+
+		// the number of words generated at once by `fill` / `generate_n` (bulk engine only)
+		constexpr std::size_t bulk_chunk_size = 256;
+
+		// the engine generates every value of its result_type (which `Bounded` / `unit` require)
+		template<typename Engine>
+		constexpr auto is_full_range_engine_v =
+				std::is_unsigned_v<typename Engine::result_type> and
+				Engine::min() == 0 and
+				Engine::max() == std::numeric_limits<typename Engine::result_type>::max();
+
+		// the engine generates many words at once (e.g. RandomEngineLanes)
+		template<typename Engine>
+		constexpr auto is_bulk_engine_v = requires(Engine& engine, const std::span<typename Engine::result_type> out) { engine.generate(out); };
+
+		template<std::unsigned_integral Word>
+		struct multiply_result_type
+		{
+			Word low;
+			Word high;
+		};
+
+		template<std::unsigned_integral Word>
+		[[nodiscard]] constexpr auto multiply(const Word a, const Word b) noexcept -> multiply_result_type<Word>
+		{
+			if constexpr (sizeof(Word) <= sizeof(std::uint32_t))
+			{
+				const auto result = static_cast<std::uint64_t>(a) * b;
+				return {.low = static_cast<Word>(result), .high = static_cast<Word>(result >> std::numeric_limits<Word>::digits)};
+			}
+			else
+			{
+#if defined(__SIZEOF_INT128__)
+				__extension__ using uint128_t = unsigned __int128;
+
+				const auto result = static_cast<uint128_t>(a) * b;
+				return {.low = static_cast<Word>(result), .high = static_cast<Word>(result >> 64)};
+#else
+				const auto a_low = a & 0xffff'ffff;
+				const auto a_high = a >> 32;
+				const auto b_low = b & 0xffff'ffff;
+				const auto b_high = b >> 32;
+
+				const auto ll = a_low * b_low;
+				const auto lh = a_low * b_high;
+				const auto hl = a_high * b_low;
+				const auto hh = a_high * b_high;
+
+				const auto middle = (ll >> 32) + (lh & 0xffff'ffff) + (hl & 0xffff'ffff);
+				return {.low = (middle << 32) | (ll & 0xffff'ffff), .high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32)};
+#endif
+			}
+		}
+
+		// [0, range), range != 0
+		// Lemire, Fast Random Integer Generation in an Interval: the high half of `x * range`, the low half rejects the (few) biased x.
+		template<std::unsigned_integral Word>
+		class Bounded
+		{
+		public:
+			using word_type = Word;
+
+		private:
+			word_type range_;
+			// 2^N % range, computed once for all values (the only division)
+			word_type threshold_;
+
+		public:
+			constexpr explicit Bounded(const word_type range) noexcept
+				: range_{range},
+				  threshold_{static_cast<word_type>(static_cast<word_type>(0 - range) % range)}
+			{
+				PROMETHEUS_PLATFORM_ASSUME(range != 0);
+			}
+
+			template<typename Engine>
+			[[nodiscard]] constexpr auto operator()(Engine& engine, const word_type x) const noexcept -> word_type
+			{
+				auto result = random_detail::multiply(x, range_);
+
+				while (result.low < threshold_)
+				{
+					result = random_detail::multiply(static_cast<word_type>(engine()), range_);
+				}
+
+				return result.high;
+			}
+		};
+
+		// [0, 1), the top mantissa-digits bits of x are the mantissa of a number in [1, 2)
+		template<std::floating_point T, std::unsigned_integral Word>
+		[[nodiscard]] constexpr auto unit(const Word x) noexcept -> T
+		{
+			constexpr auto word_bits = std::numeric_limits<Word>::digits;
+			constexpr auto mantissa_bits = std::numeric_limits<T>::digits - 1;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				const auto bits = static_cast<std::uint32_t>(x >> (word_bits - mantissa_bits)) | 0x3f80'0000;
+				return std::bit_cast<float>(bits) - 1.f;
+			}
+			else
+			{
+				static_assert(std::is_same_v<T, double>);
+
+				const auto bits = static_cast<std::uint64_t>(x >> (word_bits - mantissa_bits)) | 0x3ff0'0000'0000'0000;
+				return std::bit_cast<double>(bits) - 1.;
+			}
+		}
 	}
 
 	template<template<typename> typename, typename>
@@ -143,8 +262,13 @@ namespace prometheus::numeric
 	struct is_distribution_compatible<DistributionAlias, long double> : std::true_type {};
 
 	// In fact, this holds true for arbitrary types, but if UserDefinedDistribution does not support type T, it should raise a compile error.
+	// note: default_int_distribution<double> / default_floating_point_distribution<int> are not user-defined distributions.
 	template<template<typename> typename UserDefinedDistribution, typename T>
-		requires(random_detail::is_user_defined_distribution_v<UserDefinedDistribution, T>)
+		requires(
+			not random_detail::is_distribution_alias_v<default_int_distribution, UserDefinedDistribution> and
+			not random_detail::is_distribution_alias_v<default_floating_point_distribution, UserDefinedDistribution> and
+			random_detail::is_user_defined_distribution_v<UserDefinedDistribution, T>
+		)
 	struct is_distribution_compatible<UserDefinedDistribution, T> : std::true_type {};
 
 	template<template<typename> typename Distribution, typename T>
@@ -154,11 +278,110 @@ namespace prometheus::numeric
 
 	enum class RandomStateCategory : std::uint8_t
 	{
+		// one engine for all threads (not synchronized)
 		SHARED,
+		// one engine per thread, seeded independently
 		SHARED_THREAD_ONLY,
+		// one engine per thread, thread N (in the order of their first use) takes substream N of one global seed (N long jumps, see `seed`),
+		// N is handed out by an atomic counter and the N long jumps are applied at once (see `long_jump(count)`)
+		SHARED_THREAD_STREAM,
 		PRIVATE,
 	};
 
+	namespace random_detail
+	{
+		// the engine may take a seed wider than its result_type (e.g. RandomEnginePhilox)
+		template<typename Engine>
+		struct seed_type_of
+		{
+			using type = Engine::result_type;
+		};
+
+		template<typename Engine>
+			requires requires { typename Engine::seed_type; }
+		struct seed_type_of<Engine>
+		{
+			using type = Engine::seed_type;
+		};
+
+		// RandomEngineLanes: the engine of lane 0
+		template<typename Engine>
+		struct base_engine_of
+		{
+			using type = Engine;
+		};
+
+		template<typename Engine>
+			requires requires { typename Engine::engine_type; }
+		struct base_engine_of<Engine>
+		{
+			using type = Engine::engine_type;
+		};
+
+		// RandomStateCategory::SHARED_THREAD_STREAM
+		template<typename Engine>
+		class ThreadStreams
+		{
+		public:
+			using engine_type = Engine;
+			using seed_type = seed_type_of<engine_type>::type;
+
+			using base_engine_type = base_engine_of<engine_type>::type;
+
+		private:
+			std::atomic<seed_type> seed_;
+			// the next substream to hand out
+			std::atomic<std::size_t> next_;
+			// incremented by each `seed`, a thread takes a new substream when its generation is older
+			std::atomic<std::size_t> generation_;
+
+		public:
+			explicit ThreadStreams() noexcept
+				: seed_{static_cast<seed_type>(std::random_device{}())},
+				  next_{0},
+				  generation_{1} {}
+
+			// note: not synchronized with the threads taking a substream, seed before they use the engine
+			auto seed(const seed_type new_seed) noexcept -> void
+			{
+				seed_.store(new_seed, std::memory_order_relaxed);
+				next_.store(0, std::memory_order_relaxed);
+				generation_.fetch_add(1, std::memory_order_release);
+			}
+
+			[[nodiscard]] auto generation() const noexcept -> std::size_t
+			{
+				return generation_.load(std::memory_order_acquire);
+			}
+
+			// the engine of the next substream: the engine of the seed after `index` long jumps
+			// (RandomEngineLanes: the long jumps apply to the engine of lane 0)
+			[[nodiscard]] auto take() noexcept -> engine_type
+			{
+				const auto index = next_.fetch_add(1, std::memory_order_relaxed);
+
+				base_engine_type engine{seed_.load(std::memory_order_relaxed)};
+				engine.long_jump(index);
+
+				if constexpr (std::is_same_v<base_engine_type, engine_type>)
+				{
+					return engine;
+				}
+				else
+				{
+					return engine_type{std::move(engine)};
+				}
+			}
+		};
+
+		template<typename Engine>
+		struct ThreadStream
+		{
+			std::size_t generation;
+			Engine engine;
+		};
+	}
+
 	template<
 		RandomStateCategory Category = RandomStateCategory::PRIVATE,
 		typename RandomEngine = random_engine_xrsr_128_star_star,
@@ -171,11 +394,15 @@ namespace prometheus::numeric
 	{
 	public:
 		constexpr static auto category = Category;
-		constexpr static bool is_shared_category = category == RandomStateCategory::SHARED or category == RandomStateCategory::SHARED_THREAD_ONLY;
+		constexpr static bool is_shared_category =
+				category == RandomStateCategory::SHARED or
+				category == RandomStateCategory::SHARED_THREAD_ONLY or
+				category == RandomStateCategory::SHARED_THREAD_STREAM;
 
 		using engine_type = RandomEngine;
 
 		using result_type = engine_type::result_type;
+		using seed_type = random_detail::seed_type_of<engine_type>::type;
 
 		template<typename T>
 		using integer_distribution_type = IntegerDistribution<T>;
@@ -186,6 +413,13 @@ namespace prometheus::numeric
 		using boolean_distribution_type = BooleanDistribution;
 
 	private:
+		[[nodiscard]] static auto streams() -> random_detail::ThreadStreams<engine_type>& //
+			requires(category == RandomStateCategory::SHARED_THREAD_STREAM)
+		{
+			static random_detail::ThreadStreams<engine_type> streams{};
+			return streams;
+		}
+
 		[[nodiscard]] constexpr static auto engine() -> engine_type& //
 			requires(is_shared_category)
 		{
@@ -199,6 +433,20 @@ namespace prometheus::numeric
 				thread_local engine_type engine{};
 				return engine;
 			}
+			else if constexpr (category == RandomStateCategory::SHARED_THREAD_STREAM)
+			{
+				// the only shared access is a load of the generation (and an increment of the substream counter when a substream is taken), the engine itself is not shared
+				auto& all = streams();
+				thread_local random_detail::ThreadStream<engine_type> stream{.generation = all.generation(), .engine = all.take()};
+
+				if (const auto generation = all.generation();
+					stream.generation != generation) [[unlikely]]
+				{
+					stream = {.generation = generation, .engine = all.take()};
+				}
+
+				return stream.engine;
+			}
 			else
 			{
 				PROMETHEUS_SEMANTIC_STATIC_UNREACHABLE();
@@ -221,6 +469,129 @@ namespace prometheus::numeric
 			return real_engine_.engine;
 		}
 
+		template<typename T>
+		using distribution_type_of = std::conditional_t<
+			distribution_compatible_t<integer_distribution_type, T>,
+			integer_distribution_type<T>,
+			floating_point_distribution_type<T>
+		>;
+
+		// The default distributions are computed directly from the engine's words (a bulk engine generates a chunk of words at once),
+		// any other distribution (or an engine that does not generate every value of its result_type) is constructed once for all values.
+		template<typename T, typename OutputIterator>
+		constexpr static auto do_generate_n(engine_type& engine, OutputIterator out, std::size_t count, T from, T to) -> OutputIterator
+		{
+			using distribution_type = distribution_type_of<T>;
+
+			if (to < from)
+			{
+				std::ranges::swap(from, to);
+			}
+
+			constexpr auto is_fast_integer =
+					random_detail::is_full_range_engine_v<engine_type> and
+					std::is_same_v<distribution_type, std::uniform_int_distribution<T>> and
+					sizeof(T) <= sizeof(result_type);
+			constexpr auto is_fast_floating_point =
+					random_detail::is_full_range_engine_v<engine_type> and
+					std::is_same_v<distribution_type, std::uniform_real_distribution<T>> and
+					(std::is_same_v<T, float> or std::is_same_v<T, double>) and
+					std::numeric_limits<result_type>::digits >= std::numeric_limits<T>::digits - 1;
+
+			if constexpr (is_fast_integer or is_fast_floating_point)
+			{
+				const auto for_each_word = [&engine, &out, &count](auto convert) -> void
+				{
+					if constexpr (random_detail::is_bulk_engine_v<engine_type>)
+					{
+						std::array<result_type, random_detail::bulk_chunk_size> words; // NOLINT(cppcoreguidelines-pro-type-member-init)
+
+						while (count != 0)
+						{
+							const auto chunk = std::span{words}.first(std::ranges::min(count, words.size()));
+							engine.generate(chunk);
+
+							for (const auto word: chunk)
+							{
+								*out = convert(word);
+								++out;
+							}
+
+							count -= chunk.size();
+						}
+					}
+					else
+					{
+						// generating a chunk first is slower than using each word as soon as it is generated
+						for (; count != 0; --count)
+						{
+							*out = convert(engine());
+							++out;
+						}
+					}
+				};
+
+				if constexpr (is_fast_integer)
+				{
+					using unsigned_type = std::make_unsigned_t<T>;
+
+					// [from, to] => from + [0, range), range == 0 => all values of result_type (only if T is as wide as result_type)
+					const auto range = static_cast<result_type>(
+						static_cast<result_type>(static_cast<unsigned_type>(static_cast<unsigned_type>(to) - static_cast<unsigned_type>(from))) + 1
+					);
+					const auto base = static_cast<unsigned_type>(from);
+
+					if (range == 0)
+					{
+						for_each_word(
+							[](const result_type word) noexcept -> T
+							{
+								return static_cast<T>(word);
+							}
+						);
+					}
+					else
+					{
+						const random_detail::Bounded<result_type> bounded{range};
+
+						for_each_word(
+							[&engine, bounded, base](const result_type word) noexcept -> T
+							{
+								const auto offset = static_cast<unsigned_type>(bounded(engine, word));
+								return static_cast<T>(static_cast<unsigned_type>(base + offset));
+							}
+						);
+					}
+				}
+				else
+				{
+					// [from, to)
+					const auto scale = to - from;
+
+					for_each_word(
+						[from, scale](const result_type word) noexcept -> T
+						{
+							return from + random_detail::unit<T>(word) * scale;
+						}
+					);
+				}
+
+				return out;
+			}
+			else
+			{
+				distribution_type distribution{from, to};
+
+				for (; count != 0; --count)
+				{
+					*out = distribution(engine);
+					++out;
+				}
+
+				return out;
+			}
+		}
+
 	public:
 		template<typename... Args>
 			requires std::is_constructible_v<engine_type, Args...>
@@ -247,16 +618,27 @@ namespace prometheus::numeric
 			return engine_type::max();
 		}
 
+		/**
+		 * @note SHARED_THREAD_STREAM: @c new_seed is the seed of all threads, each thread takes a new substream of it the next time it uses the engine.
+		 * It is not synchronized with the threads which are using the engine, seed before the threads start.
+		 */
 		constexpr static auto seed(
-			const result_type new_seed = static_cast<result_type>(std::chrono::steady_clock::now().time_since_epoch().count()))
+			const seed_type new_seed = static_cast<seed_type>(std::chrono::steady_clock::now().time_since_epoch().count()))
 			noexcept(noexcept(
 				engine().seed(new_seed)
 			)) -> void requires(is_shared_category)
 		{
-			engine().seed(new_seed);
+			if constexpr (category == RandomStateCategory::SHARED_THREAD_STREAM)
+			{
+				streams().seed(new_seed);
+			}
+			else
+			{
+				engine().seed(new_seed);
+			}
 		}
 
-		constexpr auto seed(const result_type new_seed = static_cast<result_type>(std::chrono::steady_clock::now().time_since_epoch().count()))
+		constexpr auto seed(const seed_type new_seed = static_cast<seed_type>(std::chrono::steady_clock::now().time_since_epoch().count()))
 			noexcept(noexcept(
 				std::declval<Random>().engine().seed(new_seed)
 			)) -> void requires(not is_shared_category)
@@ -264,13 +646,13 @@ namespace prometheus::numeric
 			engine().seed(new_seed);
 		}
 
-		constexpr static auto discard(const result_type count) noexcept(noexcept(engine().discard(count))) -> void //
+		constexpr static auto discard(const std::uint64_t count) noexcept(noexcept(engine().discard(count))) -> void //
 			requires(is_shared_category)
 		{
 			engine().discard(count);
 		}
 
-		constexpr static auto discard(const result_type count) noexcept(noexcept(engine().discard(count))) -> void //
+		constexpr static auto discard(const std::uint64_t count) noexcept(noexcept(engine().discard(count))) -> void //
 			requires(not is_shared_category)
 		{
 			engine().discard(count);
@@ -304,7 +686,7 @@ namespace prometheus::numeric
 				floating_point_distribution_type<T>
 			>;
 
-			if (std::cmp_greater(from, to))
+			if (from > to)
 			{
 				return distribution_type{static_cast<T>(to), from}(engine());
 			}
@@ -351,7 +733,7 @@ namespace prometheus::numeric
 				floating_point_distribution_type<T>
 			>;
 
-			if (std::cmp_greater(from, to))
+			if (from > to)
 			{
 				return distribution_type{static_cast<T>(to), from}(engine());
 			}
@@ -553,28 +935,11 @@ namespace prometheus::numeric
 			const std::size_t count
 		)
 			noexcept(noexcept(
-				// https://github.com/llvm/llvm-project/issues/97980
-#if defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG)
-				false
-#else
-				std::ranges::generate_n(
-					std::back_inserter(container),
-					count,
-					[from, to]() noexcept(noexcept(Random::get(from, to))) -> T
-					{
-						return Random::get(from, to);
-					}) //
-#endif
+				Random::generate_n<T>(std::back_inserter(container), count, from, to)
 			)) -> void //
 			requires(is_shared_category)
 		{
-			std::ranges::generate_n(
-				std::back_inserter(container),
-				count,
-				[from, to]() noexcept(noexcept(Random::get(from, to))) -> T
-				{
-					return Random::get(from, to);
-				});
+			Random::generate_n<T>(std::back_inserter(container), count, from, to);
 		}
 
 		template<typename Container, typename T>
@@ -615,28 +980,11 @@ namespace prometheus::numeric
 			const std::type_identity_t<T> to,
 			const std::size_t count)
 			noexcept(noexcept(
-				// https://github.com/llvm/llvm-project/issues/97980
-#if defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG)
-				false
-#else
-				std::ranges::generate_n(
-					std::back_inserter(container),
-					count,
-					[from, to]() noexcept(noexcept(std::declval<Random>().get(from, to))) -> T
-					{
-						return Random::get(from, to);
-					}) //
-#endif
+				std::declval<Random>().template generate_n<T>(std::back_inserter(container), count, from, to)
 			)) -> void //
 			requires(not is_shared_category)
 		{
-			std::ranges::generate_n(
-				std::back_inserter(container),
-				count,
-				[from, to, this]() noexcept(noexcept(this->get(from, to))) -> T
-				{
-					return this->get(from, to);
-				});
+			this->template generate_n<T>(std::back_inserter(container), count, from, to);
 		}
 
 		template<typename Container, typename T>
@@ -727,6 +1075,96 @@ namespace prometheus::numeric
 			return this->template get<Container, T>(from, to, count);
 		}
 
+		/**
+		 * @brief Write @c count random numbers in a [from, to] range (by *_distribution_type) to @c out.
+		 * @tparam T A distribution compatible type.
+		 * @param out The first position to write.
+		 * @param count The number of random numbers.
+		 * @param from The first limit number of a random range.
+		 * @param to The second limit number of a random range.
+		 * @return The position after the last written number.
+		 * @note The distribution is set up once for all numbers. With the default distributions integers are bounded by Lemire's method
+		 * and floating points take their mantissa from the engine's bits (the numbers differ from @c count calls to @c get),
+		 * an engine with a bulk @c generate (e.g. RandomEngineLanes) generates the bits of a chunk of numbers at once.
+		 */
+		template<typename T, typename OutputIterator>
+			requires distribution_compatible_t<integer_distribution_type, T> or distribution_compatible_t<floating_point_distribution_type, T>
+		constexpr static auto generate_n(
+			OutputIterator out,
+			const std::size_t count,
+			const T from,
+			const std::type_identity_t<T> to
+		) noexcept(noexcept(Random::get<T>(from, to)) and noexcept(*out = from) and noexcept(++out)) -> OutputIterator //
+			requires(is_shared_category)
+		{
+			return Random::do_generate_n<T>(engine(), std::move(out), count, from, static_cast<T>(to));
+		}
+
+		/**
+		 * @brief Write @c count random numbers in a [from, to] range (by *_distribution_type) to @c out.
+		 * @tparam T A distribution compatible type.
+		 * @param out The first position to write.
+		 * @param count The number of random numbers.
+		 * @param from The first limit number of a random range.
+		 * @param to The second limit number of a random range.
+		 * @return The position after the last written number.
+		 * @note The distribution is set up once for all numbers. With the default distributions integers are bounded by Lemire's method
+		 * and floating points take their mantissa from the engine's bits (the numbers differ from @c count calls to @c get),
+		 * an engine with a bulk @c generate (e.g. RandomEngineLanes) generates the bits of a chunk of numbers at once.
+		 */
+		template<typename T, typename OutputIterator>
+			requires distribution_compatible_t<integer_distribution_type, T> or distribution_compatible_t<floating_point_distribution_type, T>
+		constexpr auto generate_n(
+			OutputIterator out,
+			const std::size_t count,
+			const T from,
+			const std::type_identity_t<T> to
+		) noexcept(noexcept(std::declval<Random>().template get<T>(from, to)) and noexcept(*out = from) and noexcept(++out)) -> OutputIterator //
+			requires(not is_shared_category)
+		{
+			return Random::do_generate_n<T>(engine(), std::move(out), count, from, static_cast<T>(to));
+		}
+
+		/**
+		 * @brief Fill @c out with random numbers in a [from, to] range by *_distribution_type.
+		 * @tparam T A distribution compatible type.
+		 * @param out The numbers.
+		 * @param from The first limit number of a random range.
+		 * @param to The second limit number of a random range.
+		 * @note Same as @c generate_n(out.begin(), out.size(), from, to).
+		 */
+		template<typename T>
+			requires distribution_compatible_t<integer_distribution_type, T> or distribution_compatible_t<floating_point_distribution_type, T>
+		constexpr static auto fill(
+			const std::type_identity_t<std::span<T>> out,
+			const T from,
+			const std::type_identity_t<T> to
+		) noexcept(noexcept(Random::get<T>(from, to))) -> void //
+			requires(is_shared_category)
+		{
+			Random::do_generate_n<T>(engine(), out.begin(), out.size(), from, static_cast<T>(to));
+		}
+
+		/**
+		 * @brief Fill @c out with random numbers in a [from, to] range by *_distribution_type.
+		 * @tparam T A distribution compatible type.
+		 * @param out The numbers.
+		 * @param from The first limit number of a random range.
+		 * @param to The second limit number of a random range.
+		 * @note Same as @c generate_n(out.begin(), out.size(), from, to).
+		 */
+		template<typename T>
+			requires distribution_compatible_t<integer_distribution_type, T> or distribution_compatible_t<floating_point_distribution_type, T>
+		constexpr auto fill(
+			const std::type_identity_t<std::span<T>> out,
+			const T from,
+			const std::type_identity_t<T> to
+		) noexcept(noexcept(std::declval<Random>().template get<T>(from, to))) -> void //
+			requires(not is_shared_category)
+		{
+			Random::do_generate_n<T>(engine(), out.begin(), out.size(), from, static_cast<T>(to));
+		}
+
 		template<typename Distribution, typename... Args>
 		constexpr static auto get(Args&&... args)
 			noexcept(noexcept(Distribution{std::forward<Args>(args)...}(engine()))) -> Distribution::result_type //
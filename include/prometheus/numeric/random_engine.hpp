@@ -4,18 +4,28 @@
 // found in the top-level directory of this distribution.
 
 // A C++ implementation based on [http://prng.di.unimi.it/].
+// RandomEnginePhilox: Philox4x32-10, see [Salmon et al., Parallel Random Numbers: As Easy as 1, 2, 3] and [https://github.com/DEShawResearch/random123].
 
 #pragma once
 
+#include <cstdint>
+#include <climits>
 #include <concepts>
 #include <array>
+#include <span>
+#include <bit>
 #include <limits>
 #include <algorithm>
 #include <ranges>
 #include <random>
+#include <tuple>
 
 #include <prometheus/macro.hpp>
 
+#if defined(PROMETHEUS_COMPILER_CLANG_CL) or defined(PROMETHEUS_COMPILER_CLANG) or defined(PROMETHEUS_COMPILER_APPLE_CLANG) or defined(PROMETHEUS_COMPILER_GNU)
+#define PROMETHEUS_NUMERIC_RANDOM_ENGINE_VECTOR_EXTENSION
+#endif
+
 namespace prometheus::numeric
 {
 	namespace random_engine_detail
@@ -23,18 +33,316 @@ namespace prometheus::numeric
 		using bit64_type = std::uint64_t;
 		using bit32_type = std::uint32_t;
 
-		template<std::size_t N, std::size_t Total, std::unsigned_integral T>
+		template<std::size_t N, std::size_t Total, typename T>
 		constexpr auto rotate_left(const T value) noexcept -> T
 		{
 			return (value << N) | (value >> (Total - N));
 		}
 
-		template<std::size_t N, std::size_t Total, std::unsigned_integral T>
+		template<std::size_t N, std::size_t Total, typename T>
 		constexpr auto rotate_left_to(T& value) noexcept -> void
 		{
 			value = random_engine_detail::rotate_left<N, Total>(value);
 		}
 
+		// The same word of the state of every lane (see `RandomEngineLanes`), `value[lane]` is the word of lane `lane`.
+		// An operator applies to all lanes at once, which is one (or a few) SIMD instruction(s) for the target of the caller.
+		template<std::unsigned_integral T, std::size_t Lanes>
+		struct LaneWord
+		{
+#if defined(PROMETHEUS_NUMERIC_RANDOM_ENGINE_VECTOR_EXTENSION)
+			// `using` would ignore the (dependent) attribute
+			typedef T value_type __attribute__((vector_size(sizeof(T) * Lanes))); // NOLINT(modernize-use-using)
+
+			value_type value;
+
+			[[nodiscard]] constexpr friend auto operator+(const LaneWord& lhs, const LaneWord& rhs) noexcept -> LaneWord
+			{
+				return {.value = lhs.value + rhs.value};
+			}
+
+			[[nodiscard]] constexpr friend auto operator*(const LaneWord& lhs, const T rhs) noexcept -> LaneWord
+			{
+				return {.value = lhs.value * rhs};
+			}
+
+			[[nodiscard]] constexpr friend auto operator|(const LaneWord& lhs, const LaneWord& rhs) noexcept -> LaneWord
+			{
+				return {.value = lhs.value | rhs.value};
+			}
+
+			[[nodiscard]] constexpr friend auto operator^(const LaneWord& lhs, const LaneWord& rhs) noexcept -> LaneWord
+			{
+				return {.value = lhs.value ^ rhs.value};
+			}
+
+			[[nodiscard]] constexpr friend auto operator<<(const LaneWord& lhs, const std::size_t rhs) noexcept -> LaneWord
+			{
+				return {.value = lhs.value << rhs};
+			}
+
+			[[nodiscard]] constexpr friend auto operator>>(const LaneWord& lhs, const std::size_t rhs) noexcept -> LaneWord
+			{
+				return {.value = lhs.value >> rhs};
+			}
+
+#else
+			alignas(sizeof(T) * Lanes) std::array<T, Lanes> value;
+
+			[[nodiscard]] constexpr friend auto operator+(const LaneWord& lhs, const LaneWord& rhs) noexcept -> LaneWord
+			{
+				LaneWord result;
+				for (std::size_t i = 0; i < Lanes; ++i)
+				{
+					result.value[i] = lhs.value[i] + rhs.value[i];
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr friend auto operator*(const LaneWord& lhs, const T rhs) noexcept -> LaneWord
+			{
+				LaneWord result;
+				for (std::size_t i = 0; i < Lanes; ++i)
+				{
+					result.value[i] = lhs.value[i] * rhs;
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr friend auto operator|(const LaneWord& lhs, const LaneWord& rhs) noexcept -> LaneWord
+			{
+				LaneWord result;
+				for (std::size_t i = 0; i < Lanes; ++i)
+				{
+					result.value[i] = lhs.value[i] | rhs.value[i];
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr friend auto operator^(const LaneWord& lhs, const LaneWord& rhs) noexcept -> LaneWord
+			{
+				LaneWord result;
+				for (std::size_t i = 0; i < Lanes; ++i)
+				{
+					result.value[i] = lhs.value[i] ^ rhs.value[i];
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr friend auto operator<<(const LaneWord& lhs, const std::size_t rhs) noexcept -> LaneWord
+			{
+				LaneWord result;
+				for (std::size_t i = 0; i < Lanes; ++i)
+				{
+					result.value[i] = lhs.value[i] << rhs;
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr friend auto operator>>(const LaneWord& lhs, const std::size_t rhs) noexcept -> LaneWord
+			{
+				LaneWord result;
+				for (std::size_t i = 0; i < Lanes; ++i)
+				{
+					result.value[i] = lhs.value[i] >> rhs;
+				}
+				return result;
+			}
+
+#endif
+
+			constexpr auto operator^=(const LaneWord& other) noexcept -> LaneWord&
+			{
+				*this = *this ^ other;
+				return *this;
+			}
+		};
+
+		// LaneEngine => RandomEngineLanes<Engine, Lanes>
+		// out[step * Lanes + lane] => the output of lane `lane` of step `step`
+		template<typename LaneEngine>
+		constexpr auto generate_lanes(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, const std::size_t steps) noexcept -> void
+		{
+			// keep the state in registers
+			auto s = state;
+
+			for (std::size_t step = 0; step < steps; ++step)
+			{
+				const auto result = LaneEngine::step(s);
+				for (std::size_t lane = 0; lane < LaneEngine::lane_count; ++lane)
+				{
+					out[step * LaneEngine::lane_count + lane] = result.value[lane];
+				}
+			}
+
+			state = s;
+		}
+
+		// the same as `generate_lanes`, the kernel (AVX2/AVX-512) is selected at runtime
+		template<typename LaneEngine>
+		auto generate_lanes_vectorized(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, std::size_t steps) noexcept -> void;
+
+		namespace philox
+		{
+			using word_type = bit32_type;
+			using key_type = std::array<word_type, 2>;
+			using block_type = std::array<word_type, 4>;
+
+			constexpr std::size_t rounds = 10;
+
+			constexpr word_type multiplier_0 = 0xd251'1f53;
+			constexpr word_type multiplier_1 = 0xcd9e'8d57;
+			// the key is bumped by these constants after each round
+			constexpr word_type weyl_0 = 0x9e37'79b9;
+			constexpr word_type weyl_1 = 0xbb67'ae85;
+
+			// the 128-bit counter of block `index` of stream `stream`
+			[[nodiscard]] constexpr auto counter_of(const bit64_type stream, const bit64_type index) noexcept -> block_type
+			{
+				return {
+						static_cast<word_type>(index),
+						static_cast<word_type>(index >> 32),
+						static_cast<word_type>(stream),
+						static_cast<word_type>(stream >> 32)
+				};
+			}
+
+			[[nodiscard]] constexpr auto block(block_type counter, key_type key) noexcept -> block_type
+			{
+				for (std::size_t round = 0; round < rounds; ++round)
+				{
+					if (round != 0)
+					{
+						key[0] += weyl_0;
+						key[1] += weyl_1;
+					}
+
+					const auto product_0 = static_cast<bit64_type>(multiplier_0) * counter[0];
+					const auto product_1 = static_cast<bit64_type>(multiplier_1) * counter[2];
+
+					counter = {
+							static_cast<word_type>(product_1 >> 32) ^ counter[1] ^ key[0],
+							static_cast<word_type>(product_1),
+							static_cast<word_type>(product_0 >> 32) ^ counter[3] ^ key[1],
+							static_cast<word_type>(product_0)
+					};
+				}
+
+				return counter;
+			}
+
+			// out[0 ~ 4 * blocks] = block first_block, block first_block + 1, ...
+			constexpr auto generate(const key_type& key, const bit64_type stream, const bit64_type first_block, word_type* out, const std::size_t blocks) noexcept -> void
+			{
+				for (std::size_t i = 0; i < blocks; ++i)
+				{
+					const auto result = philox::block(philox::counter_of(stream, first_block + i), key);
+					std::ranges::copy(result, out + i * result.size());
+				}
+			}
+
+			// the same as `generate`, the kernel (AVX2/AVX-512) is selected at runtime
+			auto generate_vectorized(const key_type& key, bit64_type stream, bit64_type first_block, word_type* out, std::size_t blocks) noexcept -> void;
+		}
+
+		// Polynomials over GF(2) modulo the characteristic polynomial of an engine: p(x) = x ^ n + low(x), n = bits of the state.
+		// A polynomial of degree < n is stored like a state (and like the jump steps): bit `i % bits` of word `i / bits` is the coefficient of x ^ i.
+		//
+		// Stepping the engine `count` times is the same as applying (x ^ count mod p)(T) to the state (T: the transition of the engine),
+		// which is what `do_jump` does with the steps.
+
+		// a => a * x mod p
+		template<typename State>
+		constexpr auto polynomial_multiply_x(State& a, const State& low) noexcept -> void
+		{
+			using word_type = State::value_type;
+			constexpr auto bits = std::numeric_limits<word_type>::digits;
+
+			const auto carry = a.back() >> (bits - 1);
+
+			for (auto i = a.size() - 1; i != 0; --i)
+			{
+				a[i] = static_cast<word_type>((a[i] << 1) | (a[i - 1] >> (bits - 1)));
+			}
+			a[0] = static_cast<word_type>(a[0] << 1);
+
+			if (carry != 0)
+			{
+				for (std::size_t i = 0; i < a.size(); ++i)
+				{
+					a[i] ^= low[i];
+				}
+			}
+		}
+
+		// a * b mod p
+		template<typename State>
+		[[nodiscard]] constexpr auto polynomial_multiply(const State& a, const State& b, const State& low) noexcept -> State
+		{
+			using word_type = State::value_type;
+			constexpr auto bits = std::numeric_limits<word_type>::digits;
+
+			// Horner, from the highest coefficient of b
+			State result{};
+			for (auto i = b.size(); i != 0; --i)
+			{
+				for (auto bit = bits; bit != 0; --bit)
+				{
+					polynomial_multiply_x(result, low);
+
+					if ((b[i - 1] >> (bit - 1)) & 1)
+					{
+						for (std::size_t j = 0; j < result.size(); ++j)
+						{
+							result[j] ^= a[j];
+						}
+					}
+				}
+			}
+
+			return result;
+		}
+
+		// x ^ exponent mod p
+		template<typename State>
+		[[nodiscard]] constexpr auto polynomial_power_of_x(const std::uint64_t exponent, const State& low) noexcept -> State
+		{
+			State result{};
+			result[0] = 1;
+
+			for (auto bit = std::bit_width(exponent); bit != 0; --bit)
+			{
+				result = random_engine_detail::polynomial_multiply(result, result, low);
+
+				if ((exponent >> (bit - 1)) & 1)
+				{
+					random_engine_detail::polynomial_multiply_x(result, low);
+				}
+			}
+
+			return result;
+		}
+
+		// polynomial ^ exponent mod p (e.g. `exponent` jumps of the same distance)
+		template<typename State>
+		[[nodiscard]] constexpr auto polynomial_power(const State& polynomial, const std::uint64_t exponent, const State& low) noexcept -> State
+		{
+			State result{};
+			result[0] = 1;
+
+			for (auto bit = std::bit_width(exponent); bit != 0; --bit)
+			{
+				result = random_engine_detail::polynomial_multiply(result, result, low);
+
+				if ((exponent >> (bit - 1)) & 1)
+				{
+					result = random_engine_detail::polynomial_multiply(result, polynomial, low);
+				}
+			}
+
+			return result;
+		}
+
 		template<std::unsigned_integral T, std::size_t StateSize, typename Engine>
 		class RandomEngineBase
 		{
@@ -53,6 +361,11 @@ namespace prometheus::numeric
 			using state_type = std::array<result_type, StateSize>;
 
 			constexpr static auto bits_of_this = std::numeric_limits<result_type>::digits;
+			constexpr static auto bits_of_state = bits_of_this * StateSize;
+
+			// below this distance, stepping costs less than a jump (`bits_of_state` steps plus log2(count) polynomial multiplications)
+			// measured: 128 bits => ~10'000, 256 bits => ~30'000, 512 bits => ~100'000
+			constexpr static std::uint64_t discard_jump_threshold = bits_of_state * bits_of_state / 2;
 
 			/**
 			 * Output: 64 bits
@@ -86,32 +399,25 @@ namespace prometheus::numeric
 			state_type state_;
 
 		private:
-			constexpr auto do_jump(const state_type steps) noexcept -> void
+			// state => steps(T) * state, see `polynomial_power_of_x`
+			constexpr auto do_jump(const state_type& steps) noexcept -> void
 			{
 				state_type to{};
 
-				std::ranges::for_each(
-					steps,
-					[this, &to](const auto step) noexcept -> void
+				for (const auto step: steps)
+				{
+					for (auto bit = 0; bit < bits_of_this; ++bit)
 					{
-						std::ranges::for_each(
-							std::views::iota(0, bits_of_this),
-							[this, &to, step](const auto mask) noexcept -> void
-							{
-								if (step & mask)
-								{
-									for (auto& [t, s]: std::views::zip(to, state_))
-									{
-										t ^= s;
-									}
-								}
-								discard();
-							},
-							[](const auto this_bit) noexcept -> result_type
+						if (step & (result_type{1} << bit))
+						{
+							for (std::size_t i = 0; i < StateSize; ++i)
 							{
-								return result_type{1} << this_bit;
-							});
-					});
+								to[i] ^= state_[i];
+							}
+						}
+						next();
+					}
+				}
 
 				state_.swap(to);
 			}
@@ -151,21 +457,29 @@ namespace prometheus::numeric
 
 			[[nodiscard]] constexpr auto peek() const noexcept -> result_type
 			{
-				return rep().do_peek();
+				return Engine::do_peek(state_);
 			}
 
 			constexpr auto next() noexcept -> result_type
 			{
-				return rep().do_next();
+				return Engine::do_next(state_);
 			}
 
-			constexpr auto discard(const result_type count) noexcept -> void
+			/**
+			 * @brief Equivalent to @c count calls to @c next(), a long distance costs O(bits_of_state ^ 2 * log(count)).
+			 */
+			constexpr auto discard(const std::uint64_t count) noexcept -> void
 			{
-				// fixme
-				for (result_type i = 0; i < count; ++i)
+				if (count < discard_jump_threshold)
 				{
-					next();
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						next();
+					}
+					return;
 				}
+
+				do_jump(random_engine_detail::polynomial_power_of_x(count, rep().do_characteristic_polynomial()));
 			}
 
 			[[nodiscard]] constexpr auto operator()() noexcept -> result_type
@@ -182,6 +496,20 @@ namespace prometheus::numeric
 			{
 				rep().do_jump(rep().do_long_jump_state());
 			}
+
+			/**
+			 * @brief Equivalent to @c count calls to @c long_jump(), costs one jump plus O(log(count)) polynomial multiplications.
+			 */
+			constexpr auto long_jump(const std::uint64_t count) noexcept -> void
+			{
+				if (count == 0)
+				{
+					return;
+				}
+
+				const auto low = rep().do_characteristic_polynomial();
+				rep().do_jump(random_engine_detail::polynomial_power(rep().do_long_jump_state(), count, low));
+			}
 		};
 
 		template<std::unsigned_integral T, std::size_t StateSize, typename Engine>
@@ -196,9 +524,10 @@ namespace prometheus::numeric
 			using result_type = engine_type::result_type;
 			using state_type = engine_type::state_type;
 
-			constexpr static auto rotate(state_type& state) noexcept -> void
+			template<typename State>
+			constexpr static auto rotate(State& state) noexcept -> void
 			{
-				const result_type t = state[1] << 9;
+				const auto t = state[1] << 9;
 
 				state[2] ^= state[0];
 				state[3] ^= state[1];
@@ -209,6 +538,21 @@ namespace prometheus::numeric
 				random_engine_detail::rotate_left_to<11, engine_type::bits_of_this>(state[3]);
 			}
 
+			/**
+			* @brief The characteristic polynomial of the generator (without the leading x ^ 128), see `discard`.
+			* @return the coefficients of x ^ 0 ~ x ^ 127
+			*/
+			[[nodiscard]] constexpr static auto characteristic_polynomial() noexcept -> state_type
+			{
+				return
+				{
+						static_cast<result_type>(0xde18fc01ull),
+						static_cast<result_type>(0x1b489db6ull),
+						static_cast<result_type>(0x006254b1ull),
+						static_cast<result_type>(0x00fc65a2ull),
+				};
+			}
+
 			/**
 			* @brief This is the jump function for the generator. It is equivalent
 			* to 2 ^ 64 calls to operator(); it can be used to generate 2 ^ 64
@@ -254,6 +598,19 @@ namespace prometheus::numeric
 			using result_type = engine_type::result_type;
 			using state_type = engine_type::state_type;
 
+			/**
+			* @brief The characteristic polynomial of the generator (without the leading x ^ 128), see `discard`.
+			* @return the coefficients of x ^ 0 ~ x ^ 127
+			*/
+			[[nodiscard]] constexpr static auto characteristic_polynomial() noexcept -> state_type
+			{
+				return
+				{
+						static_cast<result_type>(0x095b8f76579aa001ull),
+						static_cast<result_type>(0x0008828e513b43d5ull),
+				};
+			}
+
 			/**
 			* @brief This is the jump function for the generator. It is equivalent
 			* to 2 ^ 64 calls to next(); it can be used to generate 2 ^ 64
@@ -295,9 +652,10 @@ namespace prometheus::numeric
 			using result_type = engine_type::result_type;
 			using state_type = engine_type::state_type;
 
-			constexpr static auto rotate(state_type& state) noexcept -> void
+			template<typename State>
+			constexpr static auto rotate(State& state) noexcept -> void
 			{
-				const result_type t = state[1] << 17;
+				const auto t = state[1] << 17;
 
 				state[2] ^= state[0];
 				state[3] ^= state[1];
@@ -308,6 +666,21 @@ namespace prometheus::numeric
 				random_engine_detail::rotate_left_to<45, engine_type::bits_of_this>(state[3]);
 			}
 
+			/**
+			* @brief The characteristic polynomial of the generator (without the leading x ^ 256), see `discard`.
+			* @return the coefficients of x ^ 0 ~ x ^ 255
+			*/
+			[[nodiscard]] constexpr static auto characteristic_polynomial() noexcept -> state_type
+			{
+				return
+				{
+						static_cast<result_type>(0x9d116f2bb0f0f001ull),
+						static_cast<result_type>(0x0280002bcefd1a5eull),
+						static_cast<result_type>(0x04b4edcf26259f85ull),
+						static_cast<result_type>(0x0003c03c3f3ecb19ull),
+				};
+			}
+
 			/**
 			* @brief This is the jump function for the generator. It is equivalent
 			* to 2 ^ 128 calls to operator(); it can be used to generate 2 ^ 128
@@ -353,9 +726,10 @@ namespace prometheus::numeric
 			using result_type = engine_type::result_type;
 			using state_type = engine_type::state_type;
 
-			constexpr static auto rotate(state_type& state) noexcept -> void
+			template<typename State>
+			constexpr static auto rotate(State& state) noexcept -> void
 			{
-				const result_type t = state[1] << 11;
+				const auto t = state[1] << 11;
 
 				state[2] ^= state[0];
 				state[5] ^= state[1];
@@ -370,6 +744,25 @@ namespace prometheus::numeric
 				random_engine_detail::rotate_left_to<21, engine_type::bits_of_this>(state[7]);
 			}
 
+			/**
+			* @brief The characteristic polynomial of the generator (without the leading x ^ 512), see `discard`.
+			* @return the coefficients of x ^ 0 ~ x ^ 511
+			*/
+			[[nodiscard]] constexpr static auto characteristic_polynomial() noexcept -> state_type
+			{
+				return
+				{
+						static_cast<result_type>(0xcf3cff0c00000001ull),
+						static_cast<result_type>(0x7fdc78d886f00c63ull),
+						static_cast<result_type>(0xf05e63fca6d7b781ull),
+						static_cast<result_type>(0x7a67058e7bbab6f0ull),
+						static_cast<result_type>(0xf11eef832e32518full),
+						static_cast<result_type>(0x51ba7c47edc758adull),
+						static_cast<result_type>(0x8f2d27268ce4b20bull),
+						static_cast<result_type>(0x0000500055d8b77full),
+				};
+			}
+
 			/**
 			* @brief This is the jump function for the generator. It is equivalent
 			* to 2 ^ 256 calls to operator(); it can be used to generate 2 ^ 256
@@ -440,6 +833,9 @@ namespace prometheus::numeric
 	template<RandomEngineCategory Category, RandomEngineTag Tag, RandomEngineBit Bit>
 	class RandomEngine;
 
+	template<typename Engine, std::size_t Lanes>
+	class RandomEngineLanes;
+
 	/**
 	 * @brief Fastest 32-bit generator for 32-bit floating-point numbers.
 	 * We suggest to use its upper bits for floating-point generation,
@@ -463,6 +859,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit32_type, 4, RandomEngine>;
@@ -470,15 +868,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return state_[0] + state_[3];
+			return state[0] + state[3];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -491,6 +891,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_128_plus = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::PLUS, RandomEngineBit::BITS_128>;
@@ -517,6 +922,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit32_type, 4, RandomEngine>;
@@ -524,15 +931,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<7, bits_of_this>(state_[0] + state_[3]) + state_[0];
+			return random_engine_detail::rotate_left<7, bits_of_this>(state[0] + state[3]) + state[0];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -545,6 +954,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_128_plus_plus = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::PLUS_PLUS, RandomEngineBit::BITS_128>;
@@ -571,6 +985,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit32_type, 4, RandomEngine>;
@@ -578,15 +994,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<7, bits_of_this>(state_[1] * 5) * 9;
+			return random_engine_detail::rotate_left<7, bits_of_this>(state[1] * 5) * 9;
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -599,6 +1017,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_128_star_star = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::STAR_STAR, RandomEngineBit::BITS_128>;
@@ -630,6 +1053,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 2, RandomEngine>;
@@ -637,19 +1062,21 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return state_[0] + state_[1];
+			return state[0] + state[1];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
+			const auto result = do_peek(state);
 
-			const auto s1 = state_[1] ^ state_[0];
+			const auto s1 = state[1] ^ state[0];
 
-			state_[0] = random_engine_detail::rotate_left<24, bits_of_this>(state_[0]) ^ s1 ^ (s1 << 16);
-			state_[1] = random_engine_detail::rotate_left<37, bits_of_this>(s1);
+			state[0] = random_engine_detail::rotate_left<24, bits_of_this>(state[0]) ^ s1 ^ (s1 << 16);
+			state[1] = random_engine_detail::rotate_left<37, bits_of_this>(s1);
 
 			return result;
 		}
@@ -663,6 +1090,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	// ReSharper disable once IdentifierTypo
@@ -690,6 +1122,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 2, RandomEngine>;
@@ -697,19 +1131,21 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<17, bits_of_this>(state_[0] + state_[1]) + state_[0];
+			return random_engine_detail::rotate_left<17, bits_of_this>(state[0] + state[1]) + state[0];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
+			const auto result = do_peek(state);
 
-			const auto s1 = state_[1] ^ state_[0];
+			const auto s1 = state[1] ^ state[0];
 
-			state_[0] = random_engine_detail::rotate_left<49, bits_of_this>(state_[0]) ^ s1 ^ (s1 << 21);
-			state_[1] = random_engine_detail::rotate_left<28, bits_of_this>(s1);
+			state[0] = random_engine_detail::rotate_left<49, bits_of_this>(state[0]) ^ s1 ^ (s1 << 21);
+			state[1] = random_engine_detail::rotate_left<28, bits_of_this>(s1);
 
 			return result;
 		}
@@ -742,6 +1178,18 @@ namespace prometheus::numeric
 					static_cast<result_type>(0x9c6e6877736c46e3ull)
 			};
 		}
+
+		/**
+		 * @brief The characteristic polynomial of the generator (without the leading x ^ 128), see `discard`.
+		 * @return the coefficients of x ^ 0 ~ x ^ 127
+		 */
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return {
+					static_cast<result_type>(0x8dae70779760b081ull),
+					static_cast<result_type>(0x0031bcf2f855d6e5ull)
+			};
+		}
 	};
 
 	// ReSharper disable once IdentifierTypo
@@ -769,6 +1217,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 2, RandomEngine>;
@@ -776,19 +1226,21 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<7, bits_of_this>(state_[0] * 5) * 9;
+			return random_engine_detail::rotate_left<7, bits_of_this>(state[0] * 5) * 9;
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
+			const auto result = do_peek(state);
 
-			const auto s1 = state_[1] ^ state_[0];
+			const auto s1 = state[1] ^ state[0];
 
-			state_[0] = random_engine_detail::rotate_left<24, bits_of_this>(state_[0]) ^ s1 ^ (s1 << 16);
-			state_[1] = random_engine_detail::rotate_left<37, bits_of_this>(s1);
+			state[0] = random_engine_detail::rotate_left<24, bits_of_this>(state[0]) ^ s1 ^ (s1 << 16);
+			state[1] = random_engine_detail::rotate_left<37, bits_of_this>(s1);
 
 			return result;
 		}
@@ -802,6 +1254,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	// ReSharper disable once IdentifierTypo
@@ -831,6 +1288,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 4, RandomEngine>;
@@ -838,15 +1297,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return state_[0] + state_[3];
+			return state[0] + state[3];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -859,6 +1320,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_256_plus = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::PLUS, RandomEngineBit::BITS_256>;
@@ -886,6 +1352,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 4, RandomEngine>;
@@ -893,15 +1361,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<23, bits_of_this>(state_[0] + state_[3]) + state_[0];
+			return random_engine_detail::rotate_left<23, bits_of_this>(state[0] + state[3]) + state[0];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -914,6 +1384,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_256_plus_plus = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::PLUS_PLUS, RandomEngineBit::BITS_256>;
@@ -941,6 +1416,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 4, RandomEngine>;
@@ -948,15 +1425,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<7, bits_of_this>(state_[1] * 5) * 9;
+			return random_engine_detail::rotate_left<7, bits_of_this>(state[1] * 5) * 9;
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -969,6 +1448,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_256_star_star = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::STAR_STAR, RandomEngineBit::BITS_256>;
@@ -997,6 +1481,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 8, RandomEngine>;
@@ -1004,15 +1490,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return state_[0] + state_[3];
+			return state[0] + state[3];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -1025,6 +1513,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_512_plus = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::PLUS, RandomEngineBit::BITS_512>;
@@ -1052,6 +1545,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 8, RandomEngine>;
@@ -1059,15 +1554,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<17, bits_of_this>(state_[0] + state_[2]) + state_[2];
+			return random_engine_detail::rotate_left<17, bits_of_this>(state[0] + state[2]) + state[2];
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -1080,6 +1577,11 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_512_plus_plus = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::PLUS_PLUS, RandomEngineBit::BITS_512>;
@@ -1107,6 +1609,8 @@ namespace prometheus::numeric
 			>
 	{
 		friend RandomEngineBase;
+		template<typename, std::size_t>
+		friend class RandomEngineLanes;
 
 	public:
 		using jumper = random_engine_detail::Jumper<random_engine_detail::bit64_type, 8, RandomEngine>;
@@ -1114,15 +1618,17 @@ namespace prometheus::numeric
 		using RandomEngineBase::RandomEngineBase;
 
 	private:
-		[[nodiscard]] constexpr auto do_peek() const noexcept -> result_type
+		template<typename State>
+		[[nodiscard]] constexpr static auto do_peek(const State& state) noexcept -> State::value_type
 		{
-			return random_engine_detail::rotate_left<7, bits_of_this>(state_[1] * 5) * 9;
+			return random_engine_detail::rotate_left<7, bits_of_this>(state[1] * 5) * 9;
 		}
 
-		constexpr auto do_next() noexcept -> result_type
+		template<typename State>
+		constexpr static auto do_next(State& state) noexcept -> State::value_type
 		{
-			const auto result = do_peek();
-			jumper::rotate(state_);
+			const auto result = do_peek(state);
+			jumper::rotate(state);
 			return result;
 		}
 
@@ -1135,10 +1641,360 @@ namespace prometheus::numeric
 		{
 			return jumper::long_jump();
 		}
+
+		[[nodiscard]] constexpr static auto do_characteristic_polynomial() noexcept -> state_type
+		{
+			return jumper::characteristic_polynomial();
+		}
 	};
 
 	using random_engine_xsr_512_star_star = RandomEngine<RandomEngineCategory::X_S_R, RandomEngineTag::STAR_STAR, RandomEngineBit::BITS_512>;
 
 	static_assert(std::uniform_random_bit_generator<random_engine_xsr_512_star_star>);
 	static_assert(sizeof(random_engine_xsr_512_star_star) == 512 / CHAR_BIT);
+
+	/**
+	 * @brief @c Lanes interleaved copies of @c Engine, stepped at once (the same word of the state of every lane is kept in one SIMD register).
+	 * Lane @c i starts @c i jumps (see @c Engine::jump) after lane 0, so the lanes never overlap (within 2 ^ 64 steps, at least).
+	 * The output is lane 0, lane 1, ..., lane Lanes - 1 of the first step, then of the second step, and so on.
+	 * @note Use @c generate to fill a buffer, it is vectorized (AVX2/AVX-512, selected at runtime).
+	 * @note One state word of all lanes should fit in one register: 4 x 64 / 8 x 32 bits (AVX2), 8 x 64 / 16 x 32 bits (AVX-512),
+	 * a wider word is kept in memory by the compiler, which is (much) slower.
+	 */
+	template<typename Engine, std::size_t Lanes>
+	class RandomEngineLanes
+	{
+		static_assert(Lanes == 4 or Lanes == 8 or Lanes == 16);
+
+	public:
+		using engine_type = Engine;
+		using result_type = engine_type::result_type;
+		using lane_type = random_engine_detail::LaneWord<result_type, Lanes>;
+		using state_type = std::array<lane_type, std::tuple_size_v<typename engine_type::state_type>>;
+
+		constexpr static auto lane_count = Lanes;
+
+		/**
+		 * @brief Step all lanes once.
+		 * @return The output of every lane.
+		 */
+		constexpr static auto step(state_type& state) noexcept -> lane_type
+		{
+			return engine_type::do_next(state);
+		}
+
+	private:
+		state_type state_;
+		// the outputs of the last step which have not been returned yet: buffer_[Lanes - remaining_] ~ buffer_[Lanes - 1]
+		lane_type buffer_;
+		std::size_t remaining_;
+
+	public:
+		constexpr explicit RandomEngineLanes(engine_type engine) noexcept
+			: state_{},
+			  buffer_{},
+			  remaining_{0}
+		{
+			for (std::size_t lane = 0; lane < Lanes; ++lane)
+			{
+				for (std::size_t i = 0; i < state_.size(); ++i)
+				{
+					state_[i].value[lane] = engine.state_[i];
+				}
+
+				engine.jump();
+			}
+		}
+
+		constexpr explicit RandomEngineLanes(const result_type seed) noexcept
+			: RandomEngineLanes{engine_type{seed}} {}
+
+		constexpr explicit RandomEngineLanes() noexcept
+			: RandomEngineLanes{engine_type{}} {}
+
+		constexpr RandomEngineLanes(RandomEngineLanes&&) noexcept = default;
+		constexpr auto operator=(RandomEngineLanes&&) noexcept -> RandomEngineLanes& = default;
+
+		constexpr RandomEngineLanes(const RandomEngineLanes&) noexcept = delete;
+		constexpr auto operator=(const RandomEngineLanes&) noexcept -> RandomEngineLanes& = delete;
+
+		constexpr ~RandomEngineLanes() noexcept = default;
+
+		[[nodiscard]] constexpr static auto min() noexcept -> result_type
+		{
+			return engine_type::min();
+		}
+
+		[[nodiscard]] constexpr static auto max() noexcept -> result_type
+		{
+			return engine_type::max();
+		}
+
+		constexpr auto seed(const result_type new_seed) noexcept -> void
+		{
+			*this = RandomEngineLanes{new_seed};
+		}
+
+		constexpr auto next() noexcept -> result_type
+		{
+			if (remaining_ == 0)
+			{
+				buffer_ = step(state_);
+				remaining_ = Lanes;
+			}
+
+			const auto result = buffer_.value[Lanes - remaining_];
+			remaining_ -= 1;
+			return result;
+		}
+
+		[[nodiscard]] constexpr auto operator()() noexcept -> result_type
+		{
+			return next();
+		}
+
+		/**
+		 * @brief Equivalent to @c out.size() calls to @c next().
+		 */
+		constexpr auto generate(const std::span<result_type> out) noexcept -> void
+		{
+			auto* dest = out.data();
+			auto size = out.size();
+
+			// the rest of the last step
+			for (; remaining_ != 0 and size != 0; --remaining_, --size)
+			{
+				*dest = buffer_.value[Lanes - remaining_];
+				++dest;
+			}
+
+			if (const auto steps = size / Lanes; steps != 0)
+			{
+				PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+				{
+					random_engine_detail::generate_lanes<RandomEngineLanes>(state_, dest, steps);
+				}
+				else
+				{
+					random_engine_detail::generate_lanes_vectorized<RandomEngineLanes>(state_, dest, steps);
+				}
+
+				dest += steps * Lanes;
+				size -= steps * Lanes;
+			}
+
+			if (size != 0)
+			{
+				buffer_ = step(state_);
+				for (std::size_t lane = 0; lane < size; ++lane)
+				{
+					dest[lane] = buffer_.value[lane];
+				}
+				remaining_ = Lanes - size;
+			}
+		}
+	};
+
+	template<typename Engine>
+	using random_engine_x4 = RandomEngineLanes<Engine, 4>;
+	template<typename Engine>
+	using random_engine_x8 = RandomEngineLanes<Engine, 8>;
+	template<typename Engine>
+	using random_engine_x16 = RandomEngineLanes<Engine, 16>;
+
+	static_assert(std::uniform_random_bit_generator<random_engine_x8<random_engine_xsr_256_plus_plus>>);
+
+	/**
+	 * @brief A counter-based engine (Philox4x32-10): value @c i of the stream is a function of (key, stream, i) only.
+	 * Block @c n (values 4n ~ 4n + 3) is 10 rounds of a bijection of the 128-bit counter (stream << 64 | n) keyed by the seed.
+	 * @note @c at(index) computes any value of the stream without generating the values before it,
+	 * the elements of a parallel loop compute their values independently (@c at(first, out) computes a range, vectorized).
+	 * @note @c discard is O(1), @c jump / @c long_jump switch to another (non-overlapping) stream of the same seed.
+	 */
+	class RandomEnginePhilox
+	{
+	public:
+		using result_type = random_engine_detail::philox::word_type;
+		using key_type = random_engine_detail::philox::key_type;
+		using block_type = random_engine_detail::philox::block_type;
+		// the key is 64 bits, wider than result_type
+		using seed_type = std::uint64_t;
+
+		// values per counter
+		constexpr static std::size_t block_size = std::tuple_size_v<block_type>;
+
+	private:
+		key_type key_;
+		// the high 64 bits of the counter
+		std::uint64_t stream_;
+		// the index of the next value, the low 64 bits of its counter are position_ / block_size
+		std::uint64_t position_;
+		// the block of position_ (if position_ % block_size != 0)
+		block_type buffer_;
+
+		[[nodiscard]] constexpr auto block_of(const std::uint64_t index) const noexcept -> block_type
+		{
+			return random_engine_detail::philox::block(random_engine_detail::philox::counter_of(stream_, index), key_);
+		}
+
+	public:
+		constexpr explicit RandomEnginePhilox(const seed_type seed) noexcept
+			: key_{static_cast<result_type>(seed), static_cast<result_type>(seed >> 32)},
+			  stream_{0},
+			  position_{0},
+			  buffer_{} {}
+
+		explicit RandomEnginePhilox() noexcept
+			: RandomEnginePhilox{(static_cast<seed_type>(std::random_device{}()) << 32) | std::random_device{}()} {}
+
+		constexpr RandomEnginePhilox(RandomEnginePhilox&&) noexcept = default;
+		constexpr auto operator=(RandomEnginePhilox&&) noexcept -> RandomEnginePhilox& = default;
+
+		constexpr RandomEnginePhilox(const RandomEnginePhilox&) noexcept = delete;
+		constexpr auto operator=(const RandomEnginePhilox&) noexcept -> RandomEnginePhilox& = delete;
+
+		constexpr ~RandomEnginePhilox() noexcept = default;
+
+		[[nodiscard]] constexpr static auto min() noexcept -> result_type
+		{
+			return std::numeric_limits<result_type>::lowest();
+		}
+
+		[[nodiscard]] constexpr static auto max() noexcept -> result_type
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto seed(const seed_type new_seed) noexcept -> void
+		{
+			*this = RandomEnginePhilox{new_seed};
+		}
+
+		/**
+		 * @brief The index of the value @c next() returns.
+		 */
+		[[nodiscard]] constexpr auto position() const noexcept -> std::uint64_t
+		{
+			return position_;
+		}
+
+		/**
+		 * @brief Value @c index of the stream (independent of @c position()).
+		 */
+		[[nodiscard]] constexpr auto at(const std::uint64_t index) const noexcept -> result_type
+		{
+			return this->block_of(index / block_size)[index % block_size];
+		}
+
+		/**
+		 * @brief out[i] = at(first + i)
+		 */
+		constexpr auto at(const std::uint64_t first, const std::span<result_type> out) const noexcept -> void
+		{
+			auto* dest = out.data();
+			auto size = out.size();
+			auto index = first;
+
+			// the rest of the first block
+			if (const auto offset = index % block_size;
+				offset != 0 and size != 0)
+			{
+				const auto block = this->block_of(index / block_size);
+				for (auto i = offset; i < block_size and size != 0; ++i, --size)
+				{
+					*dest = block[i];
+					++dest;
+					++index;
+				}
+			}
+
+			if (const auto blocks = size / block_size; blocks != 0)
+			{
+				PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+				{
+					random_engine_detail::philox::generate(key_, stream_, index / block_size, dest, blocks);
+				}
+				else
+				{
+					random_engine_detail::philox::generate_vectorized(key_, stream_, index / block_size, dest, blocks);
+				}
+
+				dest += blocks * block_size;
+				size -= blocks * block_size;
+				index += blocks * block_size;
+			}
+
+			if (size != 0)
+			{
+				const auto block = this->block_of(index / block_size);
+				std::ranges::copy_n(block.begin(), static_cast<std::ptrdiff_t>(size), dest);
+			}
+		}
+
+		constexpr auto next() noexcept -> result_type
+		{
+			const auto offset = position_ % block_size;
+			if (offset == 0)
+			{
+				buffer_ = this->block_of(position_ / block_size);
+			}
+
+			position_ += 1;
+			return buffer_[offset];
+		}
+
+		[[nodiscard]] constexpr auto operator()() noexcept -> result_type
+		{
+			return next();
+		}
+
+		/**
+		 * @brief Equivalent to @c out.size() calls to @c next().
+		 */
+		constexpr auto generate(const std::span<result_type> out) noexcept -> void
+		{
+			this->at(position_, out);
+			this->discard(out.size());
+		}
+
+		constexpr auto discard(const std::uint64_t count) noexcept -> void
+		{
+			position_ += count;
+			if (position_ % block_size != 0)
+			{
+				buffer_ = this->block_of(position_ / block_size);
+			}
+		}
+
+		/**
+		 * @brief Switch to the next stream (the values of a stream never overlap another stream), the position is unchanged.
+		 * It can be used to generate 2 ^ 64 non-overlapping streams of 2 ^ 64 values (the position is 64 bits, a stream repeats itself after 2 ^ 64 values).
+		 */
+		constexpr auto jump() noexcept -> void
+		{
+			stream_ += 1;
+			this->discard(0);
+		}
+
+		/**
+		 * @brief Equivalent to 2 ^ 32 calls to @c jump().
+		 */
+		constexpr auto long_jump() noexcept -> void
+		{
+			this->long_jump(1);
+		}
+
+		/**
+		 * @brief Equivalent to @c count calls to @c long_jump().
+		 */
+		constexpr auto long_jump(const std::uint64_t count) noexcept -> void
+		{
+			stream_ += count << 32;
+			this->discard(0);
+		}
+	};
+
+	using random_engine_philox_4x32 = RandomEnginePhilox;
+
+	static_assert(std::uniform_random_bit_generator<random_engine_philox_4x32>);
 }
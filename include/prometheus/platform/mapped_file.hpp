@@ -0,0 +1,64 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <optional>
+#include <filesystem>
+
+namespace prometheus::platform
+{
+	/**
+	 * @brief A read-only memory mapped file.
+	 */
+	class MappedFile
+	{
+	public:
+		using size_type = std::size_t;
+
+	private:
+		const std::byte* data_;
+		size_type size_;
+		// file mapping object (Windows only)
+		void* mapping_;
+
+		constexpr MappedFile(const std::byte* data, const size_type size, void* mapping) noexcept
+			: data_{data},
+			  size_{size},
+			  mapping_{mapping} {}
+
+	public:
+		/**
+		 * @brief Map the whole file into memory.
+		 * @return std::nullopt if the file cannot be mapped, use `os_error_reason` to get the reason.
+		 */
+		[[nodiscard]] static auto open(const std::filesystem::path& path) noexcept -> std::optional<MappedFile>;
+
+		MappedFile(const MappedFile&) = delete;
+		auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+		MappedFile(MappedFile&& other) noexcept;
+		auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+		~MappedFile() noexcept;
+
+		[[nodiscard]] constexpr auto data() const noexcept -> const std::byte*
+		{
+			return data_;
+		}
+
+		[[nodiscard]] constexpr auto size() const noexcept -> size_type
+		{
+			return size_;
+		}
+
+		[[nodiscard]] constexpr auto bytes() const noexcept -> std::span<const std::byte>
+		{
+			return {data_, size_};
+		}
+	};
+}
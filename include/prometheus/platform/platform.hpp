@@ -8,4 +8,5 @@
 #include <prometheus/platform/cpu.hpp>
 #include <prometheus/platform/environment.hpp>
 #include <prometheus/platform/exception.hpp>
+#include <prometheus/platform/mapped_file.hpp>
 #include <prometheus/platform/os.hpp>
@@ -5,7 +5,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <bit>
+#include <limits>
 #include <string>
+#include <span>
+#include <iterator>
 #include <algorithm>
 #include <charconv>
 #include <format>
@@ -13,6 +20,7 @@
 #include <prometheus/macro.hpp>
 
 #include <prometheus/platform/exception.hpp>
+#include <prometheus/platform/os.hpp>
 
 namespace prometheus
 {
@@ -24,6 +32,63 @@ namespace prometheus
 
 	namespace string
 	{
+		namespace charconv_detail
+		{
+			enum class CharacterCategory : std::uint8_t
+			{
+				UPPER,
+				LOWER,
+				ALPHA,
+				DIGIT,
+				ALPHA_DIGIT,
+			};
+
+			// The kernels process 64/32/16/8 ASCII characters at a time (AVX-512BW/AVX2/SSE4.2/SWAR, selected at runtime),
+			// a chunk that contains any non-ASCII character is processed by the scalar (locale-aware) version.
+
+			[[nodiscard]] auto is_all_of(CharacterCategory category, std::basic_string_view<char> string) noexcept -> bool;
+
+			// `dest` may be `string.data()`
+			auto to_upper(std::basic_string_view<char> string, char* dest) noexcept -> void;
+
+			// `dest` may be `string.data()`
+			auto to_lower(std::basic_string_view<char> string, char* dest) noexcept -> void;
+
+			// `dest` may be `string.data()`
+			// `first`: whether `string` starts a new word, returns whether the character after `string` starts a new word
+			[[nodiscard]] auto to_title(std::basic_string_view<char> string, char* dest, bool first) noexcept -> bool;
+
+			enum class Kernel : std::uint8_t
+			{
+				SCALAR,
+				SWAR,
+				SSE42,
+				AVX2,
+				AVX512BW,
+			};
+
+			// The kernels behind `is_all_of` / `to_upper` / `to_lower`, the instruction set must be supported (the x86 kernels are the SWAR kernel on non-x86 targets).
+
+			[[nodiscard]] auto is_all_of(Kernel kernel, CharacterCategory category, std::basic_string_view<char> string) noexcept -> bool;
+
+			auto to_upper(Kernel kernel, std::basic_string_view<char> string, char* dest) noexcept -> void;
+
+			auto to_lower(Kernel kernel, std::basic_string_view<char> string, char* dest) noexcept -> void;
+
+			// Eisel-Lemire (and Clinger's fast path), the same syntax and result as `std::from_chars(begin, end, value)` (`std::chars_format::general`).
+			// The rare inputs with more than 19 significant digits whose rounding depends on the remaining digits are passed to `std::from_chars`.
+
+			[[nodiscard]] auto from_chars(const char* begin, const char* end, float& value) noexcept -> std::from_chars_result;
+
+			[[nodiscard]] auto from_chars(const char* begin, const char* end, double& value) noexcept -> std::from_chars_result;
+
+			// Schubfach, the shortest representation that round trips, the same result as `std::to_chars(begin, end, value)`.
+
+			[[nodiscard]] auto to_chars(char* begin, char* end, float value) noexcept -> std::to_chars_result;
+
+			[[nodiscard]] auto to_chars(char* begin, char* end, double value) noexcept -> std::to_chars_result;
+		}
+
 		[[nodiscard]] constexpr auto is_upper(const char c) noexcept -> bool
 		{
 			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
@@ -36,7 +101,12 @@ namespace prometheus
 
 		[[nodiscard]] constexpr auto is_upper(const std::basic_string_view<char> string) noexcept -> bool
 		{
-			return std::ranges::all_of(string, static_cast<auto(*)(char c) noexcept -> bool>(is_upper));
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				return std::ranges::all_of(string, static_cast<auto(*)(char c) noexcept -> bool>(is_upper));
+			}
+
+			return charconv_detail::is_all_of(charconv_detail::CharacterCategory::UPPER, string);
 		}
 
 		[[nodiscard]] constexpr auto is_lower(const char c) noexcept -> bool
@@ -51,7 +121,12 @@ namespace prometheus
 
 		[[nodiscard]] constexpr auto is_lower(const std::basic_string_view<char> string) noexcept -> bool
 		{
-			return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_lower));
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_lower));
+			}
+
+			return charconv_detail::is_all_of(charconv_detail::CharacterCategory::LOWER, string);
 		}
 
 		[[nodiscard]] constexpr auto is_alpha(const char c) noexcept -> bool
@@ -66,7 +141,12 @@ namespace prometheus
 
 		[[nodiscard]] constexpr auto is_alpha(const std::basic_string_view<char> string) noexcept -> bool
 		{
-			return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_alpha));
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_alpha));
+			}
+
+			return charconv_detail::is_all_of(charconv_detail::CharacterCategory::ALPHA, string);
 		}
 
 		[[nodiscard]] constexpr auto is_digit(const char c) noexcept -> bool
@@ -81,7 +161,12 @@ namespace prometheus
 
 		[[nodiscard]] constexpr auto is_digit(const std::basic_string_view<char> string) noexcept -> bool
 		{
-			return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_digit));
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_digit));
+			}
+
+			return charconv_detail::is_all_of(charconv_detail::CharacterCategory::DIGIT, string);
 		}
 
 		[[nodiscard]] constexpr auto is_alpha_digit(const char c) noexcept -> bool
@@ -96,7 +181,12 @@ namespace prometheus
 
 		[[nodiscard]] constexpr auto is_alpha_digit(const std::basic_string_view<char> string) noexcept -> bool
 		{
-			return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_alpha_digit));
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				return std::ranges::all_of(string, static_cast<auto (*)(char c) noexcept -> bool>(is_alpha_digit));
+			}
+
+			return charconv_detail::is_all_of(charconv_detail::CharacterCategory::ALPHA_DIGIT, string);
 		}
 
 		[[nodiscard]] constexpr auto to_upper(const char c) noexcept -> char
@@ -109,116 +199,278 @@ namespace prometheus
 			return static_cast<char>(std::toupper(c));
 		}
 
-		constexpr auto to_upper(std::basic_string<char>& string) noexcept -> void
+		[[nodiscard]] constexpr auto to_lower(const char c) noexcept -> char
 		{
-			std::ranges::for_each(
-				string,
-				[](char& c) noexcept -> void
-				{
-					c = to_upper(c);
-				});
+			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+			{
+				return static_cast<char>(is_upper(c) ? c - 'A' + 'a' : c);
+			}
+
+			return static_cast<char>(std::tolower(c));
 		}
 
-		[[nodiscard]] constexpr auto to_upper(const std::basic_string_view<char> string) noexcept -> std::string
+		namespace charconv_detail
 		{
-			std::string result{};
-			result.reserve(string.size());
+			enum class CaseConversion : std::uint8_t
+			{
+				UPPER,
+				LOWER,
+				TITLE,
+			};
 
-			std::ranges::for_each(
-				string,
-				[&result](const char c) noexcept -> void
+			template<typename Out>
+			concept contiguous_char_iterator = std::contiguous_iterator<Out> and std::is_same_v<std::iter_value_t<Out>, char>;
+
+			// The characters are converted in chunks of this size (on the stack) if the output is not contiguous.
+			constexpr std::size_t conversion_buffer_size = 256;
+
+			template<CaseConversion Conversion, std::output_iterator<char> Out>
+			constexpr auto convert(const std::basic_string_view<char> string, Out out) noexcept -> Out
+			{
+				PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
+				{
+					bool first = true;
+					for (const auto c: string)
+					{
+						if constexpr (Conversion == CaseConversion::UPPER)
+						{
+							*out = string::to_upper(c);
+						}
+						else if constexpr (Conversion == CaseConversion::LOWER)
+						{
+							*out = string::to_lower(c);
+						}
+						else
+						{
+							if (first)
+							{
+								*out = string::to_upper(c);
+								first = false;
+							}
+							else if (c == ' ')
+							{
+								*out = c;
+								first = true;
+							}
+							else
+							{
+								*out = string::to_lower(c);
+							}
+						}
+
+						++out;
+					}
+
+					return out;
+				}
+
+				const auto kernel = [](const std::basic_string_view<char> part, char* dest, const bool first) noexcept -> bool
+				{
+					if constexpr (Conversion == CaseConversion::UPPER)
+					{
+						charconv_detail::to_upper(part, dest);
+						return first;
+					}
+					else if constexpr (Conversion == CaseConversion::LOWER)
+					{
+						charconv_detail::to_lower(part, dest);
+						return first;
+					}
+					else
+					{
+						return charconv_detail::to_title(part, dest, first);
+					}
+				};
+
+				if constexpr (contiguous_char_iterator<Out>)
 				{
-					result.push_back(to_upper(c));
+					std::ignore = kernel(string, std::to_address(out), true);
+					return out + static_cast<std::iter_difference_t<Out>>(string.size());
+				}
+				else
+				{
+					char buffer[conversion_buffer_size];
+
+					bool first = true;
+					for (std::size_t offset = 0; offset < string.size(); offset += conversion_buffer_size)
+					{
+						const auto part = string.substr(offset, conversion_buffer_size);
+
+						first = kernel(part, buffer, first);
+						out = std::ranges::copy(buffer, buffer + part.size(), std::move(out)).out;
+					}
+
+					return out;
 				}
-			);
+			}
+
+			template<CaseConversion Conversion>
+			constexpr auto convert(const std::basic_string_view<char> string, std::basic_string<char>& out) noexcept -> void
+			{
+				const auto offset = out.size();
+				const auto size = offset + string.size();
+
+				out.resize_and_overwrite(
+					size,
+					// note: do not trust the size passed in, some implementations pass the capacity
+					[string, offset, size](char* data, [[maybe_unused]] const std::size_t capacity) noexcept -> std::size_t
+					{
+						std::ignore = charconv_detail::convert<Conversion>(string, data + offset);
+						return size;
+					}
+				);
+			}
+
+			template<CaseConversion Conversion>
+			constexpr auto convert(const std::basic_string_view<char> string, const std::span<char> dest) noexcept -> std::span<char>
+			{
+				PROMETHEUS_PLATFORM_ASSUME(dest.size() >= string.size());
+
+				std::ignore = charconv_detail::convert<Conversion>(string, dest.data());
+				return dest.first(string.size());
+			}
+		}
+
+		/**
+		 * @brief Write the converted characters to `out`.
+		 */
+		template<std::output_iterator<char> Out>
+		constexpr auto to_upper(const std::basic_string_view<char> string, Out out) noexcept -> Out
+		{
+			return charconv_detail::convert<charconv_detail::CaseConversion::UPPER>(string, std::move(out));
+		}
+
+		/**
+		 * @brief Append the converted characters to `out`.
+		 */
+		constexpr auto to_upper(const std::basic_string_view<char> string, std::basic_string<char>& out) noexcept -> void
+		{
+			charconv_detail::convert<charconv_detail::CaseConversion::UPPER>(string, out);
+		}
+
+		/**
+		 * @brief Write the converted characters to the beginning of `dest` (`dest.size()` must not be less than `string.size()`).
+		 * @return The written part of `dest`.
+		 */
+		constexpr auto to_upper(const std::basic_string_view<char> string, const std::span<char> dest) noexcept -> std::span<char>
+		{
+			return charconv_detail::convert<charconv_detail::CaseConversion::UPPER>(string, dest);
+		}
+
+		/**
+		 * @brief Convert the characters of `string` in place.
+		 * @note Not an overload of `to_upper`, `to_upper(char[N])` would be ambiguous with `to_upper(std::string_view)`.
+		 */
+		constexpr auto to_upper_in_place(const std::span<char> string) noexcept -> void
+		{
+			std::ignore = charconv_detail::convert<charconv_detail::CaseConversion::UPPER>({string.data(), string.size()}, string);
+		}
+
+		constexpr auto to_upper(std::basic_string<char>& string) noexcept -> void
+		{
+			to_upper_in_place(string);
+		}
+
+		[[nodiscard]] constexpr auto to_upper(const std::basic_string_view<char> string) noexcept -> std::string
+		{
+			std::string result{};
+			to_upper(string, result);
 
 			return result;
 		}
 
-		[[nodiscard]] constexpr auto to_lower(const char c) noexcept -> char
+		/**
+		 * @brief Write the converted characters to `out`.
+		 */
+		template<std::output_iterator<char> Out>
+		constexpr auto to_lower(const std::basic_string_view<char> string, Out out) noexcept -> Out
 		{
-			PROMETHEUS_SEMANTIC_IF_CONSTANT_EVALUATED
-			{
-				return static_cast<char>(is_upper(c) ? c - 'A' + 'a' : c);
-			}
+			return charconv_detail::convert<charconv_detail::CaseConversion::LOWER>(string, std::move(out));
+		}
 
-			return static_cast<char>(std::tolower(c));
+		/**
+		 * @brief Append the converted characters to `out`.
+		 */
+		constexpr auto to_lower(const std::basic_string_view<char> string, std::basic_string<char>& out) noexcept -> void
+		{
+			charconv_detail::convert<charconv_detail::CaseConversion::LOWER>(string, out);
+		}
+
+		/**
+		 * @brief Write the converted characters to the beginning of `dest` (`dest.size()` must not be less than `string.size()`).
+		 * @return The written part of `dest`.
+		 */
+		constexpr auto to_lower(const std::basic_string_view<char> string, const std::span<char> dest) noexcept -> std::span<char>
+		{
+			return charconv_detail::convert<charconv_detail::CaseConversion::LOWER>(string, dest);
+		}
+
+		/**
+		 * @brief Convert the characters of `string` in place.
+		 * @note Not an overload of `to_lower`, `to_lower(char[N])` would be ambiguous with `to_lower(std::string_view)`.
+		 */
+		constexpr auto to_lower_in_place(const std::span<char> string) noexcept -> void
+		{
+			std::ignore = charconv_detail::convert<charconv_detail::CaseConversion::LOWER>({string.data(), string.size()}, string);
 		}
 
 		constexpr auto to_lower(std::basic_string<char>& string) noexcept -> void
 		{
-			std::ranges::for_each(
-				string,
-				[](char& c) noexcept -> void
-				{
-					c = to_lower(c);
-				});
+			to_lower_in_place(string);
 		}
 
 		[[nodiscard]] constexpr auto to_lower(const std::basic_string_view<char> string) noexcept -> std::string
 		{
 			std::string result{};
-			result.reserve(string.size());
-
-			std::ranges::for_each(
-				string,
-				[&result](const char c) noexcept -> void
-				{
-					result.push_back(to_lower(c));
-				});
+			to_lower(string, result);
 
 			return result;
 		}
 
+		/**
+		 * @brief Write the converted characters to `out`.
+		 */
+		template<std::output_iterator<char> Out>
+		constexpr auto to_title(const std::basic_string_view<char> string, Out out) noexcept -> Out
+		{
+			return charconv_detail::convert<charconv_detail::CaseConversion::TITLE>(string, std::move(out));
+		}
+
+		/**
+		 * @brief Append the converted characters to `out`.
+		 */
+		constexpr auto to_title(const std::basic_string_view<char> string, std::basic_string<char>& out) noexcept -> void
+		{
+			charconv_detail::convert<charconv_detail::CaseConversion::TITLE>(string, out);
+		}
+
+		/**
+		 * @brief Write the converted characters to the beginning of `dest` (`dest.size()` must not be less than `string.size()`).
+		 * @return The written part of `dest`.
+		 */
+		constexpr auto to_title(const std::basic_string_view<char> string, const std::span<char> dest) noexcept -> std::span<char>
+		{
+			return charconv_detail::convert<charconv_detail::CaseConversion::TITLE>(string, dest);
+		}
+
+		/**
+		 * @brief Convert the characters of `string` in place.
+		 * @note Not an overload of `to_title`, `to_title(char[N])` would be ambiguous with `to_title(std::string_view)`.
+		 */
+		constexpr auto to_title_in_place(const std::span<char> string) noexcept -> void
+		{
+			std::ignore = charconv_detail::convert<charconv_detail::CaseConversion::TITLE>({string.data(), string.size()}, string);
+		}
+
 		constexpr auto to_title(std::basic_string<char>& string) noexcept -> void
 		{
-			std::ranges::for_each(
-				string,
-				[first = true](char& c) mutable noexcept -> void
-				{
-					if (first)
-					{
-						c = to_upper(c);
-						first = false;
-					}
-					else if (c == ' ')
-					{
-						first = true;
-					}
-					else
-					{
-						c = to_lower(c);
-					}
-				});
+			to_title_in_place(string);
 		}
 
 		[[nodiscard]] constexpr auto to_title(const std::basic_string_view<char> string) noexcept -> std::string
 		{
 			std::string result{};
-			result.reserve(string.size());
-
-			std::ranges::for_each(
-				string,
-				[&result, first = true](const char c) mutable noexcept -> void
-				{
-					char this_char;
-					if (first)
-					{
-						this_char = to_upper(c);
-						first = false;
-					}
-					else if (c == ' ')
-					{
-						this_char = c;
-						first = true;
-					}
-					else
-					{
-						this_char = to_lower(c);
-					}
-
-					result.push_back(this_char);
-				});
+			to_title(string, result);
 
 			return result;
 		}
@@ -352,6 +604,209 @@ namespace prometheus
 			return result;
 		}
 
+		namespace charconv_detail
+		{
+			constexpr std::uint64_t swar_ones = 0x0101'0101'0101'0101;
+			constexpr std::uint64_t swar_high = 0x8080'8080'8080'8080;
+
+			constexpr std::array<std::uint64_t, 9> power_of_10{
+					1,
+					10,
+					100,
+					1'000,
+					10'000,
+					100'000,
+					1'000'000,
+					10'000'000,
+					100'000'000
+			};
+
+			// `value * 10^n + (n digits)` can not overflow if `value < 10^(19 - n)`
+			constexpr std::array<std::uint64_t, 9> overflow_threshold{
+					0,
+					1'000'000'000'000'000'000,
+					100'000'000'000'000'000,
+					10'000'000'000'000'000,
+					1'000'000'000'000'000,
+					100'000'000'000'000,
+					10'000'000'000'000,
+					1'000'000'000'000,
+					100'000'000'000
+			};
+
+			// Up to 8 characters starting at `begin` (the first character in the lowest byte), the characters after `end` are zero.
+			[[nodiscard]] inline auto load_8_characters(const char* begin, const char* end) noexcept -> std::uint64_t
+			{
+				std::uint64_t chunk = 0;
+				if (const auto size = static_cast<std::size_t>(end - begin); size >= sizeof(chunk)) [[likely]]
+				{
+					std::memcpy(&chunk, begin, sizeof(chunk));
+				}
+				else
+				{
+					std::memcpy(&chunk, begin, size);
+				}
+
+				if constexpr (std::endian::native == std::endian::big)
+				{
+					chunk = std::byteswap(chunk);
+				}
+
+				return chunk;
+			}
+
+			// The number of leading decimal digits (0~8) of the chunk.
+			[[nodiscard]] constexpr auto count_leading_digits(const std::uint64_t chunk) noexcept -> std::size_t
+			{
+				// the non-ASCII characters are excluded by `ascii`, so the additions below never carry between bytes
+				const auto ascii = ~chunk & swar_high;
+				const auto low = chunk & ~swar_high;
+
+				const auto ge = (low + (0x80 - '0') * swar_ones) & swar_high;
+				const auto gt = (low + (0x7f - '9') * swar_ones) & swar_high;
+				const auto non_digit = ~(ge & ~gt & ascii) & swar_high;
+
+				return static_cast<std::size_t>(std::countr_zero(non_digit)) / 8;
+			}
+
+			// Convert the first `digits` (1~8) digits of the chunk at once.
+			[[nodiscard]] constexpr auto parse_8_digits(const std::uint64_t chunk, const std::size_t digits) noexcept -> std::uint64_t
+			{
+				// move the digits to the high end, the low end is filled with (leading) zeros
+				auto value = chunk << (8 * (8 - digits));
+
+				value = ((value & 0x0f0f'0f0f'0f0f'0f0f) * ((10 << 8) + 1)) >> 8;
+				value = ((value & 0x00ff'00ff'00ff'00ff) * ((100 << 16) + 1)) >> 16;
+				value = ((value & 0x0000'ffff'0000'ffff) * ((10'000ull << 32) + 1)) >> 32;
+
+				return value;
+			}
+
+			// Parse a decimal integer (with an optional `-` if `T` is signed) from the beginning of [begin, end),
+			// returns the end of the integer, or nullptr if there is no integer or it does not fit in `T`.
+			template<std::integral T>
+			[[nodiscard]] auto parse_decimal(const char* begin, const char* end, T& out) noexcept -> const char*
+			{
+				auto it = begin;
+
+				bool negative = false;
+				if constexpr (std::is_signed_v<T>)
+				{
+					// branchless, the sign is unpredictable
+					negative = it != end and *it == '-';
+					it += negative;
+				}
+
+				const auto digits_begin = it;
+
+				std::uint64_t value = 0;
+				while (true)
+				{
+					const auto chunk = load_8_characters(it, end);
+					const auto n = count_leading_digits(chunk);
+					if (n == 0)
+					{
+						break;
+					}
+
+					const auto chunk_value = parse_8_digits(chunk, n);
+					if (value >= overflow_threshold[n] and value > (std::numeric_limits<std::uint64_t>::max() - chunk_value) / power_of_10[n]) [[unlikely]]
+					{
+						return nullptr;
+					}
+
+					value = value * power_of_10[n] + chunk_value;
+					it += n;
+
+					if (n != 8)
+					{
+						break;
+					}
+				}
+
+				if (it == digits_begin)
+				{
+					return nullptr;
+				}
+
+				using unsigned_type = std::make_unsigned_t<T>;
+
+				constexpr auto max = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+				if (value > max + negative)
+				{
+					return nullptr;
+				}
+
+				out = negative ? static_cast<T>(0 - static_cast<unsigned_type>(value)) : static_cast<T>(value);
+				return it;
+			}
+		}
+
+		/**
+		 * @brief Parse the decimal integers separated by `delimiter` in `string` into `values`, the digits are validated and converted 8 at a time.
+		 * @param string fields separated by `delimiter`, e.g. `1,-2,3`, each field must be a whole integer (same as `from_string<T>(field)`)
+		 * @param delimiter the field separator (not a digit or `-`)
+		 * @param values the parsed values, the value of a field that can not be parsed is `T{}`
+		 * @param errors bitmap of the fields that can not be parsed (bit `i % 64` of `errors[i / 64]` for field `i`),
+		 * its size must not be less than `(values.size() + 63) / 64`
+		 * @return The number of parsed fields, at most `values.size()` (the remaining fields are not parsed).
+		 */
+		template<std::integral T>
+			requires(not std::is_same_v<T, bool>)
+		auto from_string(
+			const std::basic_string_view<char> string,
+			const char delimiter,
+			const std::span<T> values,
+			const std::span<std::uint64_t> errors
+		) noexcept -> std::size_t
+		{
+			PROMETHEUS_PLATFORM_ASSUME(errors.size() >= (values.size() + 63) / 64);
+			PROMETHEUS_PLATFORM_ASSUME(not(delimiter >= '0' and delimiter <= '9') and delimiter != '-', "The delimiter can not be part of an integer");
+
+			std::ranges::fill(errors.first((values.size() + 63) / 64), 0);
+
+			if (string.empty())
+			{
+				return 0;
+			}
+
+			const auto end = string.data() + string.size();
+
+			std::size_t count = 0;
+			for (auto it = string.data(); count < values.size(); ++count)
+			{
+				T value;
+				auto field_end = charconv_detail::parse_decimal(it, end, value);
+
+				if (field_end != nullptr and (field_end == end or *field_end == delimiter)) [[likely]]
+				{
+					values[count] = value;
+				}
+				else
+				{
+					values[count] = T{};
+					errors[count / 64] |= std::uint64_t{1} << (count % 64);
+
+					const auto from = field_end == nullptr ? it : field_end;
+					field_end = static_cast<const char*>(std::memchr(from, delimiter, static_cast<std::size_t>(end - from)));
+					if (field_end == nullptr)
+					{
+						field_end = end;
+					}
+				}
+
+				if (field_end == end)
+				{
+					count += 1;
+					break;
+				}
+
+				it = field_end + 1;
+			}
+
+			return count;
+		}
+
 		template<std::floating_point T, typename Exception = void>
 			requires(std::is_same_v<Exception, void> or std::is_base_of_v<platform::IException, Exception>)
 		[[nodiscard]] constexpr auto from_string(const std::basic_string_view<char> string)
@@ -361,9 +816,22 @@ namespace prometheus
 			const auto end = string.data() + string.size();
 
 			T result;
-			if (
-				const auto [last, error_code] = std::from_chars(begin, end, result);
-				error_code != std::errc{} or last != end)
+
+			const auto from_chars_result = [&]() noexcept -> std::from_chars_result
+			{
+				if constexpr (std::is_same_v<T, float> or std::is_same_v<T, double>)
+				{
+					return charconv_detail::from_chars(begin, end, result);
+				}
+				else
+				{
+					return std::from_chars(begin, end, result);
+				}
+			}();
+			const auto last = from_chars_result.ptr;
+			const auto error_code = from_chars_result.ec;
+
+			if (error_code != std::errc{} or last != end)
 			{
 				if constexpr (std::is_same_v<Exception, void>)
 				{
@@ -377,5 +845,16 @@ namespace prometheus
 
 			return result;
 		}
+
+		/**
+		 * @brief The shortest representation of @c value that round trips (fixed or scientific notation, whichever is shorter), the same result as `std::to_chars(begin, end, value)`.
+		 * @return `{end, std::errc::value_too_large}` if `[begin, end)` is too small, otherwise `{last, std::errc{}}`
+		 */
+		template<std::floating_point T>
+			requires(std::is_same_v<T, float> or std::is_same_v<T, double>)
+		[[nodiscard]] auto to_chars(char* begin, char* end, const T value) noexcept -> std::to_chars_result
+		{
+			return charconv_detail::to_chars(begin, end, value);
+		}
 	}
 }
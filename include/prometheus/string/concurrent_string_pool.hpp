@@ -0,0 +1,299 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <array>
+#include <unordered_set>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <limits>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/string/string_pool.hpp>
+
+namespace prometheus::string
+{
+	namespace concurrent_string_pool_detail
+	{
+		// Never reused, so a thread local cache entry of a destroyed pool never matches a new pool.
+		[[nodiscard]] inline auto next_pool_id() noexcept -> std::uint64_t
+		{
+			static std::atomic<std::uint64_t> id{0};
+			return id.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+	}
+
+	/**
+	 * @brief A string pool that can be added to from multiple threads at the same time.
+	 *
+	 * Each thread appends to its own arena (a chain of `StringBlock`), so adding a string does not take any lock,
+	 * the full blocks are published to the pool through a lock-free list and released when the pool is destroyed.
+	 * If `Deduplicate` is true, a global (sharded) index is used to store each distinct string only once.
+	 *
+	 * @note Like `StringPool::add`, the returned views stay valid for the lifetime of the pool.
+	 * @note Each thread that has ever added to the pool keeps an arena until the pool is destroyed,
+	 * a thread that later gets the same `std::thread::id` reuses it.
+	 */
+	template<
+		typename CharType = char,
+		bool IsNullTerminate = true,
+		typename CharTrait = std::char_traits<CharType>,
+		bool Deduplicate = false,
+		typename Hash = std::hash<std::basic_string_view<CharType, CharTrait>>
+	>
+	class ConcurrentStringPool
+	{
+		using block_type = string_pool_detail::StringBlock<CharType, IsNullTerminate, CharTrait>;
+
+	public:
+		constexpr static bool is_deduplicate = Deduplicate;
+
+		using view_type = block_type::view_type;
+		using value_type = block_type::value_type;
+		using size_type = block_type::size_type;
+
+		using hasher = Hash;
+
+		constexpr static size_type default_block_initial_size = 8192;
+		constexpr static size_type shard_count = 64;
+
+	private:
+		struct block_node
+		{
+			block_type block;
+			block_node* next;
+		};
+
+		struct arena_type
+		{
+			std::thread::id owner;
+			// only accessed by the owner thread
+			block_node* current;
+			arena_type* next;
+		};
+
+		struct alignas(64) shard_type
+		{
+			std::shared_mutex mutex;
+			std::unordered_set<view_type, hasher> strings;
+		};
+
+		struct no_shard_type {};
+
+		using shards_type = std::conditional_t<Deduplicate, std::array<shard_type, shard_count>, no_shard_type>;
+
+		std::uint64_t id_;
+		std::atomic<size_type> block_initial_size_;
+		std::atomic<size_type> block_count_;
+
+		// full blocks (and blocks of the huge strings)
+		std::atomic<block_node*> published_;
+		std::atomic<arena_type*> arenas_;
+
+		PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS shards_type shards_;
+
+		template<typename T>
+		static auto push(std::atomic<T*>& list, T* node) noexcept -> void
+		{
+			// nodes are never popped before the pool is destroyed, so there is no ABA problem
+			node->next = list.load(std::memory_order_relaxed);
+			while (not list.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+
+		[[nodiscard]] auto create_block(const size_type capacity) -> block_node*
+		{
+			auto* node = new block_node{.block = block_type{capacity}, .next = nullptr};
+			block_count_.fetch_add(1, std::memory_order_relaxed);
+
+			return node;
+		}
+
+		[[nodiscard]] auto arena_of_this_thread() -> arena_type&
+		{
+			struct cache_type
+			{
+				std::uint64_t pool_id;
+				arena_type* arena;
+			};
+
+			thread_local cache_type cache{.pool_id = 0, .arena = nullptr};
+
+			if (cache.pool_id == id_)
+			{
+				return *cache.arena;
+			}
+
+			const auto owner = std::this_thread::get_id();
+
+			auto* arena = arenas_.load(std::memory_order_acquire);
+			while (arena != nullptr and arena->owner != owner)
+			{
+				arena = arena->next;
+			}
+
+			if (arena == nullptr)
+			{
+				arena = new arena_type{.owner = owner, .current = nullptr, .next = nullptr};
+				ConcurrentStringPool::push(arenas_, arena);
+			}
+
+			cache = {.pool_id = id_, .arena = arena};
+			return *arena;
+		}
+
+		[[nodiscard]] auto append(arena_type& arena, const view_type string) -> view_type
+		{
+			// the length of the string in the block (including the null terminator, if any)
+			const auto length = block_type::length_of(string);
+
+			if (arena.current != nullptr and arena.current->block.storable(length))
+			{
+				return arena.current->block.append(string);
+			}
+
+			if (const auto block_initial_size = block_initial_size_.load(std::memory_order_relaxed);
+				length > block_initial_size)
+			{
+				// the string gets its own block, and the current block is kept
+				auto* node = this->create_block(length);
+				const auto view = node->block.append(string);
+
+				ConcurrentStringPool::push(published_, node);
+				return view;
+			}
+			else
+			{
+				if (arena.current != nullptr)
+				{
+					ConcurrentStringPool::push(published_, arena.current);
+				}
+
+				arena.current = this->create_block(block_initial_size);
+				return arena.current->block.append(string);
+			}
+		}
+
+		[[nodiscard]] auto shard_of(const view_type string) noexcept -> shard_type&
+			requires Deduplicate
+		{
+			const auto hash = static_cast<std::size_t>(hasher{}(string));
+			// the low bits are used by the buckets of the set
+			return shards_[(hash >> (std::numeric_limits<std::size_t>::digits / 2)) % shard_count];
+		}
+
+	public:
+		explicit ConcurrentStringPool(const size_type block_initial_size = default_block_initial_size) noexcept
+			: id_{concurrent_string_pool_detail::next_pool_id()},
+			  block_initial_size_{block_initial_size},
+			  block_count_{0},
+			  published_{nullptr},
+			  arenas_{nullptr},
+			  shards_{} {}
+
+		// The arenas are bound to the pool
+		ConcurrentStringPool(const ConcurrentStringPool&) = delete;
+		ConcurrentStringPool(ConcurrentStringPool&&) = delete;
+		auto operator=(const ConcurrentStringPool&) -> ConcurrentStringPool& = delete;
+		auto operator=(ConcurrentStringPool&&) -> ConcurrentStringPool& = delete;
+
+		/**
+		 * @note No thread may be adding to the pool while it is destroyed.
+		 */
+		~ConcurrentStringPool() noexcept
+		{
+			for (auto* node = published_.load(std::memory_order_acquire); node != nullptr;)
+			{
+				delete std::exchange(node, node->next);
+			}
+
+			for (auto* arena = arenas_.load(std::memory_order_acquire); arena != nullptr;)
+			{
+				delete arena->current;
+				delete std::exchange(arena, arena->next);
+			}
+		}
+
+		/**
+		 * @brief Add a string to the pool, and then you can freely use the added string.
+		 * @note Thread-safe.
+		 * @note If `Deduplicate` is true, adding the same string multiple times (from any thread) always returns the same view.
+		 */
+		[[nodiscard]] auto add(const view_type string) -> view_type
+		{
+			if constexpr (Deduplicate)
+			{
+				auto& [mutex, strings] = this->shard_of(string);
+
+				{
+					std::shared_lock lock{mutex};
+					if (const auto it = strings.find(string);
+						it != strings.end())
+					{
+						return *it;
+					}
+				}
+
+				std::unique_lock lock{mutex};
+				// someone else may have added it
+				if (const auto it = strings.find(string);
+					it != strings.end())
+				{
+					return *it;
+				}
+
+				const auto view = this->append(this->arena_of_this_thread(), string);
+				strings.insert(view);
+				return view;
+			}
+			else
+			{
+				return this->append(this->arena_of_this_thread(), string);
+			}
+		}
+
+		/**
+		 * @note Thread-safe.
+		 */
+		[[nodiscard]] auto contains(const view_type string) -> bool
+			requires Deduplicate
+		{
+			auto& [mutex, strings] = this->shard_of(string);
+
+			std::shared_lock lock{mutex};
+			return strings.contains(string);
+		}
+
+		/**
+		 * @brief The number of blocks.
+		 * @note Thread-safe, but the result may be outdated as soon as it is returned.
+		 */
+		[[nodiscard]] auto size() const noexcept -> size_type
+		{
+			return block_count_.load(std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] auto block_initial_size() const noexcept -> size_type
+		{
+			return block_initial_size_.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @note Only affect the block created after modification
+		 */
+		auto reset_block_initial_size(const size_type capacity) noexcept -> void
+		{
+			block_initial_size_.store(capacity, std::memory_order_relaxed);
+		}
+	};
+}
@@ -0,0 +1,329 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <span>
+#include <ostream>
+#include <limits>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/string/string_pool.hpp>
+#include <prometheus/platform/os.hpp>
+
+namespace prometheus::string
+{
+	/**
+	 * @brief A string pool that stores each distinct string only once.
+	 *
+	 * Strings are stored in a `StringPool` (so the returned views stay valid for the lifetime of the pool),
+	 * and an open-addressing (linear probing) hash index over the stored views is used to find duplicates.
+	 * Every distinct string gets a dense, stable id (0, 1, 2...) in insertion order,
+	 * two interned strings are equal if and only if their ids are equal.
+	 */
+	template<
+		typename CharType = char,
+		bool IsNullTerminate = true,
+		typename CharTrait = std::char_traits<CharType>,
+		typename Hash = std::hash<std::basic_string_view<CharType, CharTrait>>,
+		typename Allocator = std::allocator<CharType>
+	>
+	class InternedStringPool
+	{
+	public:
+		using pool_type = StringPool<CharType, IsNullTerminate, CharTrait, Allocator>;
+
+		using view_type = pool_type::view_type;
+		using value_type = pool_type::value_type;
+		using size_type = pool_type::size_type;
+
+		using allocator_type = pool_type::allocator_type;
+
+		using hasher = Hash;
+		using hash_type = std::size_t;
+		using id_type = std::uint32_t;
+
+		constexpr static id_type invalid_id = std::numeric_limits<id_type>::max();
+
+		constexpr static size_type default_block_initial_size = pool_type::default_block_initial_size;
+		constexpr static size_type default_index_initial_size = 16;
+
+	private:
+		struct slot_type
+		{
+			hash_type hash;
+			// invalid_id => empty slot
+			id_type id;
+		};
+
+		using slots_type = std::vector<slot_type>;
+		using views_type = std::vector<view_type>;
+
+		pool_type pool_;
+		// id => view
+		views_type views_;
+		// size is always 0 or a power of 2
+		slots_type slots_;
+
+		PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS hasher hasher_;
+
+		[[nodiscard]] constexpr auto hash_of(const view_type string) const noexcept -> hash_type
+		{
+			return static_cast<hash_type>(hasher_(string));
+		}
+
+		// Returns the slot holding the string, or the empty slot where the string should be inserted.
+		[[nodiscard]] constexpr auto probe(const view_type string, const hash_type hash) const noexcept -> size_type
+		{
+			PROMETHEUS_PLATFORM_ASSUME(not slots_.empty());
+
+			const auto mask = slots_.size() - 1;
+			for (auto index = static_cast<size_type>(hash) & mask;; index = (index + 1) & mask)
+			{
+				const auto& [slot_hash, slot_id] = slots_[index];
+
+				if (slot_id == invalid_id)
+				{
+					return index;
+				}
+
+				if (slot_hash == hash and views_[slot_id] == string)
+				{
+					return index;
+				}
+			}
+		}
+
+		constexpr auto rehash(const size_type capacity) -> void
+		{
+			PROMETHEUS_PLATFORM_ASSUME(std::has_single_bit(capacity));
+
+			slots_type new_slots(capacity, slot_type{.hash = 0, .id = invalid_id});
+
+			const auto mask = capacity - 1;
+			for (const auto& slot: slots_)
+			{
+				if (slot.id == invalid_id)
+				{
+					continue;
+				}
+
+				auto index = static_cast<size_type>(slot.hash) & mask;
+				while (new_slots[index].id != invalid_id)
+				{
+					index = (index + 1) & mask;
+				}
+				new_slots[index] = slot;
+			}
+
+			slots_.swap(new_slots);
+		}
+
+		[[nodiscard]] constexpr static auto index_capacity_of(const size_type count) noexcept -> size_type
+		{
+			// keep the load factor below 3/4
+			return std::ranges::max(default_index_initial_size, std::bit_ceil(count + count / 3 + 1));
+		}
+
+		[[nodiscard]] constexpr auto index_full() const noexcept -> bool
+		{
+			return (views_.size() + 1) * 4 > slots_.size() * 3;
+		}
+
+	public:
+		constexpr explicit InternedStringPool(
+			const size_type block_initial_size = default_block_initial_size,
+			const allocator_type& allocator = allocator_type{}
+		) noexcept(std::is_nothrow_constructible_v<pool_type, size_type, const allocator_type&>)
+			: pool_{block_initial_size, allocator},
+			  hasher_{} {}
+
+		constexpr explicit InternedStringPool(const allocator_type& allocator) noexcept(std::is_nothrow_constructible_v<pool_type, size_type, const allocator_type&>)
+			: InternedStringPool{default_block_initial_size, allocator} {}
+
+		// The views refer to the memory of the pool, a copied pool would have to re-point all of them
+		InternedStringPool(const InternedStringPool&) = delete;
+		auto operator=(const InternedStringPool&) -> InternedStringPool& = delete;
+
+		constexpr InternedStringPool(InternedStringPool&&) noexcept = default;
+		// If the allocators are not equal, the strings would be copied into the memory of our allocator, and the views would dangle
+		constexpr auto operator=(InternedStringPool&&) noexcept -> InternedStringPool& //
+			requires(
+				std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value or
+				std::allocator_traits<allocator_type>::is_always_equal::value
+			)
+		= default;
+
+		constexpr ~InternedStringPool() noexcept = default;
+
+		/**
+		 * @brief Pre-size the index for at least `count` distinct strings.
+		 */
+		constexpr auto reserve(const size_type count) -> void
+		{
+			views_.reserve(count);
+
+			if (const auto capacity = InternedStringPool::index_capacity_of(count);
+				capacity > slots_.size())
+			{
+				this->rehash(capacity);
+			}
+		}
+
+		/**
+		 * @brief Add a string to the pool (if it is not already there), and return its id.
+		 */
+		[[nodiscard]] constexpr auto intern(const view_type string) -> id_type
+		{
+			if (slots_.empty())
+			{
+				this->rehash(default_index_initial_size);
+			}
+
+			const auto hash = this->hash_of(string);
+
+			auto index = this->probe(string, hash);
+			if (const auto id = slots_[index].id;
+				id != invalid_id)
+			{
+				return id;
+			}
+
+			if (this->index_full())
+			{
+				this->rehash(slots_.size() * 2);
+				index = this->probe(string, hash);
+			}
+
+			PROMETHEUS_PLATFORM_ASSUME(views_.size() < invalid_id, "Too many strings.");
+
+			const auto id = static_cast<id_type>(views_.size());
+			views_.push_back(pool_.add(string));
+			slots_[index] = {.hash = hash, .id = id};
+
+			return id;
+		}
+
+		/**
+		 * @brief Add a string to the pool (if it is not already there), and then you can freely use the added string.
+		 * @note Adding the same string multiple times always returns the same view.
+		 */
+		[[nodiscard]] constexpr auto add(const view_type string) -> view_type
+		{
+			return views_[this->intern(string)];
+		}
+
+		/**
+		 * @brief Find the id of the string, or `invalid_id` if the string has not been added.
+		 */
+		[[nodiscard]] constexpr auto find(const view_type string) const noexcept -> id_type
+		{
+			if (slots_.empty())
+			{
+				return invalid_id;
+			}
+
+			return slots_[this->probe(string, this->hash_of(string))].id;
+		}
+
+		[[nodiscard]] constexpr auto contains(const view_type string) const noexcept -> bool
+		{
+			return this->find(string) != invalid_id;
+		}
+
+		[[nodiscard]] constexpr auto view_of(const id_type id) const noexcept -> view_type
+		{
+			PROMETHEUS_PLATFORM_ASSUME(id < views_.size());
+
+			return views_[id];
+		}
+
+		[[nodiscard]] constexpr auto operator[](const id_type id) const noexcept -> view_type
+		{
+			return this->view_of(id);
+		}
+
+		/**
+		 * @brief All distinct strings, indexed by id.
+		 */
+		[[nodiscard]] constexpr auto views() const noexcept -> std::span<const view_type>
+		{
+			return views_;
+		}
+
+		/**
+		 * @brief The number of distinct strings.
+		 */
+		[[nodiscard]] constexpr auto size() const noexcept -> size_type
+		{
+			return views_.size();
+		}
+
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool
+		{
+			return views_.empty();
+		}
+
+		/**
+		 * @brief Write all distinct strings (indexed by id) to `out`, use `MappedStringPool` to read them back.
+		 */
+		auto serialize(std::ostream& out) const -> void
+		{
+			pool_.serialize(out, views_);
+		}
+
+		/**
+		 * @brief Repack all strings into a single allocation.
+		 * @note All views returned before are invalidated, the ids are not changed.
+		 */
+		constexpr auto compact() -> void
+		{
+			pool_.compact(views_);
+		}
+
+		[[nodiscard]] constexpr auto pool() const noexcept -> const pool_type&
+		{
+			return pool_;
+		}
+
+		[[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type
+		{
+			return pool_.get_allocator();
+		}
+
+		[[nodiscard]] constexpr auto block_initial_size() const noexcept -> size_type
+		{
+			return pool_.block_initial_size();
+		}
+
+		/**
+		 * @note Only affect the block created after modification
+		 */
+		constexpr auto reset_block_initial_size(const size_type capacity) noexcept -> void
+		{
+			pool_.reset_block_initial_size(capacity);
+		}
+	};
+
+	namespace pmr
+	{
+		template<
+			typename CharType = char,
+			bool IsNullTerminate = true,
+			typename CharTrait = std::char_traits<CharType>,
+			typename Hash = std::hash<std::basic_string_view<CharType, CharTrait>>
+		>
+		using InternedStringPool = string::InternedStringPool<CharType, IsNullTerminate, CharTrait, Hash, std::pmr::polymorphic_allocator<CharType>>;
+	}
+}
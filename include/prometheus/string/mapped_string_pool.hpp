@@ -0,0 +1,181 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#pragma once
+
+#include <string>
+#include <span>
+#include <optional>
+#include <filesystem>
+#include <format>
+#include <cstring>
+#include <type_traits>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/string/string_pool.hpp>
+#include <prometheus/platform/mapped_file.hpp>
+#include <prometheus/platform/os.hpp>
+
+namespace prometheus::string
+{
+	/**
+	 * @brief A read-only string pool that maps a file written by `StringPool::serialize` (or `InternedStringPool::serialize`),
+	 * the strings are served directly from the mapped memory without copying.
+	 */
+	template<typename CharType = char, bool IsNullTerminate = true, typename CharTrait = std::char_traits<CharType>>
+	class MappedStringPool
+	{
+	public:
+		using view_type = std::basic_string_view<CharType, CharTrait>;
+		using value_type = view_type::value_type;
+		using size_type = view_type::size_type;
+
+	private:
+		using header_type = string_pool_detail::serialized_header;
+		using string_type = string_pool_detail::serialized_string;
+
+		platform::MappedFile file_;
+
+		std::span<const string_type> strings_;
+		std::span<const value_type> characters_;
+
+		MappedStringPool(platform::MappedFile&& file, const std::span<const string_type> strings, const std::span<const value_type> characters) noexcept
+			: file_{std::move(file)},
+			  strings_{strings},
+			  characters_{characters} {}
+
+		template<typename Exception>
+		[[nodiscard]] static auto fail(const std::filesystem::path& path, const std::string_view reason)
+			noexcept(std::is_same_v<Exception, void>) -> std::conditional_t<std::is_same_v<Exception, void>, std::optional<MappedStringPool>, MappedStringPool>
+		{
+			if constexpr (std::is_same_v<Exception, void>)
+			{
+				std::ignore = path;
+				std::ignore = reason;
+				return std::nullopt;
+			}
+			else
+			{
+				platform::panic<Exception>(std::format("Can not open string pool [{}]: {}", path.string(), reason));
+			}
+		}
+
+	public:
+		/**
+		 * @brief Map the file, and check that it is a valid string pool of this type.
+		 */
+		template<typename Exception = void>
+			requires(std::is_same_v<Exception, void> or std::is_base_of_v<platform::IException, Exception>)
+		[[nodiscard]] static auto open(const std::filesystem::path& path)
+			noexcept(std::is_same_v<Exception, void>) -> std::conditional_t<std::is_same_v<Exception, void>, std::optional<MappedStringPool>, MappedStringPool>
+		{
+			auto file = platform::MappedFile::open(path);
+			if (not file.has_value())
+			{
+				if constexpr (std::is_same_v<Exception, void>)
+				{
+					return std::nullopt;
+				}
+				else
+				{
+					// the reason (allocating) is only built if an exception is thrown
+					return MappedStringPool::fail<Exception>(path, platform::os_error_reason());
+				}
+			}
+
+			const auto bytes = file->bytes();
+
+			header_type header;
+			if (bytes.size() < sizeof(header))
+			{
+				return MappedStringPool::fail<Exception>(path, "the file is too small");
+			}
+			std::memcpy(&header, bytes.data(), sizeof(header));
+
+			if (header.magic != string_pool_detail::serialized_magic or header.version != string_pool_detail::serialized_version)
+			{
+				return MappedStringPool::fail<Exception>(path, "unknown format or byte order");
+			}
+
+			if (header.character_size != sizeof(value_type) or header.is_null_terminate != IsNullTerminate)
+			{
+				return MappedStringPool::fail<Exception>(path, "mismatched character type");
+			}
+
+			const auto table_size = bytes.size() - sizeof(header);
+			if (
+				header.string_count > table_size / sizeof(string_type) or
+				header.character_count != (table_size - header.string_count * sizeof(string_type)) / sizeof(value_type) or
+				(table_size - header.string_count * sizeof(string_type)) % sizeof(value_type) != 0
+			)
+			{
+				return MappedStringPool::fail<Exception>(path, "mismatched file size");
+			}
+
+			// The mapped memory is page aligned, and the header/table are 8 bytes aligned, so they can be accessed in place.
+			const std::span strings{
+					reinterpret_cast<const string_type*>(bytes.data() + sizeof(header)),
+					static_cast<std::size_t>(header.string_count)
+			};
+			const std::span characters{
+					reinterpret_cast<const value_type*>(bytes.data() + sizeof(header) + strings.size_bytes()),
+					static_cast<std::size_t>(header.character_count)
+			};
+
+			for (const auto& [offset, length]: strings)
+			{
+				// note: `length + IsNullTerminate` may wrap
+				if (
+					offset > characters.size() or
+					characters.size() - offset < IsNullTerminate or
+					length > characters.size() - offset - IsNullTerminate
+				)
+				{
+					return MappedStringPool::fail<Exception>(path, "string out of range");
+				}
+			}
+
+			return MappedStringPool{*std::move(file), strings, characters};
+		}
+
+		/**
+		 * @brief The number of strings in the offset table.
+		 */
+		[[nodiscard]] constexpr auto size() const noexcept -> size_type
+		{
+			return strings_.size();
+		}
+
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool
+		{
+			return strings_.empty();
+		}
+
+		/**
+		 * @brief The `index`-th string of the offset table (for an `InternedStringPool`, the string with id `index`).
+		 */
+		[[nodiscard]] constexpr auto view_of(const size_type index) const noexcept -> view_type
+		{
+			PROMETHEUS_PLATFORM_ASSUME(index < strings_.size());
+
+			const auto [offset, length] = strings_[index];
+			return {characters_.data() + offset, static_cast<size_type>(length)};
+		}
+
+		[[nodiscard]] constexpr auto operator[](const size_type index) const noexcept -> view_type
+		{
+			return this->view_of(index);
+		}
+
+		/**
+		 * @brief All the characters stored in the pool (including the null terminators, if any).
+		 */
+		[[nodiscard]] constexpr auto characters() const noexcept -> view_type
+		{
+			return {characters_.data(), characters_.size()};
+		}
+	};
+}
@@ -7,3 +7,6 @@
 
 #include <prometheus/string/charconv.hpp>
 #include <prometheus/string/string_pool.hpp>
+#include <prometheus/string/interned_string_pool.hpp>
+#include <prometheus/string/concurrent_string_pool.hpp>
+#include <prometheus/string/mapped_string_pool.hpp>
@@ -7,9 +7,18 @@
 
 #include <string>
 #include <vector>
+#include <array>
 #include <memory>
+#include <memory_resource>
 #include <algorithm>
+#include <numeric>
 #include <ranges>
+#include <bit>
+#include <limits>
+#include <utility>
+#include <span>
+#include <ostream>
+#include <cstdint>
 #include <type_traits>
 
 #include <prometheus/macro.hpp>
@@ -20,7 +29,38 @@ namespace prometheus::string
 {
 	namespace string_pool_detail
 	{
-		template<typename CharType = char, bool IsNullTerminate = true, typename CharTrait = std::char_traits<CharType>>
+		// The file format written by `StringPool::serialize` (native byte order):
+		// serialized_header | serialized_string * string_count | character * character_count
+		struct serialized_header
+		{
+			std::uint32_t magic;
+			std::uint16_t version;
+			std::uint8_t character_size;
+			std::uint8_t is_null_terminate;
+			std::uint64_t string_count;
+			std::uint64_t character_count;
+		};
+
+		// offset and length in characters
+		struct serialized_string
+		{
+			std::uint64_t offset;
+			std::uint64_t length;
+		};
+
+		// "PSPL"
+		constexpr std::uint32_t serialized_magic = 0x4c50'5350;
+		constexpr std::uint16_t serialized_version = 1;
+
+		static_assert(sizeof(serialized_header) == 24);
+		static_assert(sizeof(serialized_string) == 16);
+
+		template<
+			typename CharType = char,
+			bool IsNullTerminate = true,
+			typename CharTrait = std::char_traits<CharType>,
+			typename Allocator = std::allocator<CharType>
+		>
 		class StringBlock
 		{
 		public:
@@ -30,54 +70,152 @@ namespace prometheus::string
 			using value_type = view_type::value_type;
 			using size_type = view_type::size_type;
 
+			using allocator_type = Allocator;
+			using allocator_traits_type = std::allocator_traits<allocator_type>;
+
+			static_assert(std::is_same_v<typename allocator_traits_type::value_type, value_type>);
+
 			constexpr static CharType invalid_char{'\0'};
 
 		private:
-			std::unique_ptr<value_type[]> memory_;
+			using pointer = allocator_traits_type::pointer;
+
+			pointer memory_;
 			size_type capacity_;
 			size_type size_;
+			PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS allocator_type allocator_;
 
-		public:
-			constexpr explicit StringBlock(const size_type capacity) noexcept
-				: memory_{std::make_unique_for_overwrite<value_type[]>(capacity)},
-				  capacity_{capacity},
-				  size_{0} {}
+			[[nodiscard]] constexpr auto data() const noexcept -> value_type*
+			{
+				return std::to_address(memory_);
+			}
 
-			constexpr StringBlock(StringBlock&&) noexcept = default;
-			constexpr auto operator=(StringBlock&&) noexcept -> StringBlock& = default;
+			constexpr auto release() noexcept -> void
+			{
+				if (memory_ != nullptr)
+				{
+					allocator_traits_type::deallocate(allocator_, memory_, capacity_);
+					memory_ = nullptr;
+					capacity_ = 0;
+					size_ = 0;
+				}
+			}
 
-			// Allow blocks to copy constructs, and furthermore allow pools to copy constructs
-			constexpr StringBlock(const StringBlock& other) noexcept
-				: memory_{std::make_unique_for_overwrite<value_type[]>(other.capacity_)},
-				  capacity_{other.capacity_},
-				  size_{other.size_}
+			constexpr auto steal(StringBlock& other) noexcept -> void
 			{
-				std::ranges::uninitialized_copy_n(
-					other.memory_.get(),
-					other.size_,
-					memory_.get(),
-					memory_.get() + other.size_
-				);
+				memory_ = std::exchange(other.memory_, nullptr);
+				capacity_ = std::exchange(other.capacity_, 0);
+				size_ = std::exchange(other.size_, 0);
 			}
 
-			// Allow blocks to copy constructs, and furthermore allow pools to copy constructs
-			constexpr auto operator=(const StringBlock& other) noexcept -> StringBlock&
+			constexpr auto copy(const StringBlock& other) -> void
 			{
-				memory_ = std::make_unique_for_overwrite<value_type[]>(other.capacity_);
+				memory_ = allocator_traits_type::allocate(allocator_, other.capacity_);
 				capacity_ = other.capacity_;
 				size_ = other.size_;
 
 				std::ranges::uninitialized_copy_n(
-					other.memory_.get(),
+					other.data(),
 					other.size_,
-					memory_.get(),
-					memory_.get() + other.size_
+					this->data(),
+					this->data() + other.size_
 				);
+			}
+
+		public:
+			constexpr explicit StringBlock(const size_type capacity, const allocator_type& allocator = allocator_type{})
+				: memory_{nullptr},
+				  capacity_{capacity},
+				  size_{0},
+				  allocator_{allocator}
+			{
+				memory_ = allocator_traits_type::allocate(allocator_, capacity_);
+			}
 
+			constexpr StringBlock(StringBlock&& other) noexcept
+				: memory_{nullptr},
+				  capacity_{0},
+				  size_{0},
+				  allocator_{std::move(other.allocator_)}
+			{
+				this->steal(other);
+			}
+
+			constexpr auto operator=(StringBlock&& other) noexcept(
+				allocator_traits_type::propagate_on_container_move_assignment::value or
+				allocator_traits_type::is_always_equal::value
+			) -> StringBlock&
+			{
+				if (this == &other)
+				{
+					return *this;
+				}
+
+				this->release();
+
+				if constexpr (allocator_traits_type::propagate_on_container_move_assignment::value)
+				{
+					allocator_ = std::move(other.allocator_);
+					this->steal(other);
+				}
+				else
+				{
+					if (allocator_ == other.allocator_)
+					{
+						this->steal(other);
+					}
+					else
+					{
+						// the memory of the other block cannot be released by our allocator
+						this->copy(other);
+					}
+				}
+
+				return *this;
+			}
+
+			// Allow blocks to copy constructs, and furthermore allow pools to copy constructs
+			constexpr StringBlock(const StringBlock& other)
+				: StringBlock{other, allocator_traits_type::select_on_container_copy_construction(other.allocator_)} {}
+
+			// Copy the block into the memory of `allocator`
+			constexpr StringBlock(const StringBlock& other, const allocator_type& allocator)
+				: memory_{nullptr},
+				  capacity_{0},
+				  size_{0},
+				  allocator_{allocator}
+			{
+				this->copy(other);
+			}
+
+			// Allow blocks to copy constructs, and furthermore allow pools to copy constructs
+			constexpr auto operator=(const StringBlock& other) -> StringBlock&
+			{
+				if (this == &other)
+				{
+					return *this;
+				}
+
+				this->release();
+
+				if constexpr (allocator_traits_type::propagate_on_container_copy_assignment::value)
+				{
+					allocator_ = other.allocator_;
+				}
+
+				this->copy(other);
 				return *this;
 			}
 
-			constexpr ~StringBlock() noexcept = default;
+			constexpr ~StringBlock() noexcept
+			{
+				this->release();
+			}
+
+			[[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type
+			{
+				return allocator_;
+			}
 
 			[[nodiscard]] constexpr static auto length_of(const view_type string) noexcept -> size_type
 			{
@@ -99,7 +237,7 @@ namespace prometheus::string
 					return &invalid_char;
 				}
 
-				const auto dest = memory_.get() + size_;
+				const auto dest = this->data() + size_;
 				std::ranges::copy(string, dest);
 
 				if constexpr (is_null_terminate)
@@ -126,6 +264,38 @@ namespace prometheus::string
 				return capacity_ - size_;
 			}
 
+			[[nodiscard]] constexpr auto capacity() const noexcept -> size_type
+			{
+				return capacity_;
+			}
+
+			[[nodiscard]] constexpr auto size() const noexcept -> size_type
+			{
+				return size_;
+			}
+
+			/**
+			 * @brief All the characters stored in the block (including the null terminators, if any).
+			 */
+			[[nodiscard]] constexpr auto view() const noexcept -> view_type
+			{
+				return {this->data(), size_};
+			}
+
+			/**
+			 * @brief Append all the characters stored in the other block, and return where they start.
+			 */
+			[[nodiscard]] constexpr auto append_contents(const StringBlock& other) noexcept -> const value_type*
+			{
+				PROMETHEUS_PLATFORM_ASSUME(this->storable(other.size_), "There are not enough space for the block.");
+
+				const auto dest = this->data() + size_;
+				std::ranges::copy(other.view(), dest);
+
+				size_ += other.size_;
+				return dest;
+			}
+
 			[[nodiscard]] constexpr auto more_available_space_than(const StringBlock& other) const noexcept -> bool
 			{
 				// preserving equivalent elements original order
@@ -138,15 +308,37 @@ namespace prometheus::string
 				swap(lhs.memory_, rhs.memory_);
 				swap(lhs.capacity_, rhs.capacity_);
 				swap(lhs.size_, rhs.size_);
+				if constexpr (allocator_traits_type::propagate_on_container_swap::value)
+				{
+					swap(lhs.allocator_, rhs.allocator_);
+				}
 			}
 		};
 	}
 
 
-	template<typename CharType = char, bool IsNullTerminate = true, typename CharTrait = std::char_traits<CharType>>
+	/**
+	 * @brief A pool of strings, the added strings are never moved, so the returned views stay valid for the lifetime of the pool.
+	 *
+	 * Strings are appended to the current (most recently created) block first.
+	 * All other blocks are indexed by the size class of their available space (`std::bit_width(available_space)`),
+	 * all blocks in the size class `c` have [2^(c-1), 2^c) characters available.
+	 * A string of length `n` fits into every block of a size class greater than `std::bit_width(n)`,
+	 * so looking up a block is a bit scan over the non-empty size classes and updating the index after `add` is a swap-and-pop,
+	 * both of them are O(1) and the blocks are never moved.
+	 *
+	 * The memory of the strings is allocated by `Allocator` (e.g. `std::pmr::polymorphic_allocator`, see `pmr::StringPool`),
+	 * all blocks of a pool are allocated by the allocator of the pool.
+	 */
+	template<
+		typename CharType = char,
+		bool IsNullTerminate = true,
+		typename CharTrait = std::char_traits<CharType>,
+		typename Allocator = std::allocator<CharType>
+	>
 	class StringPool
 	{
-		using block_type = string_pool_detail::StringBlock<CharType, IsNullTerminate, CharTrait>;
+		using block_type = string_pool_detail::StringBlock<CharType, IsNullTerminate, CharTrait, Allocator>;
 		using pool_type = std::vector<block_type>;
 
 	public:
@@ -154,92 +346,336 @@ namespace prometheus::string
 		using value_type = block_type::value_type;
 		using size_type = block_type::size_type;
 
+		using allocator_type = block_type::allocator_type;
+		using allocator_traits_type = block_type::allocator_traits_type;
+
 		constexpr static size_type default_block_initial_size = 8192;
 
 	private:
+		using block_index_type = pool_type::size_type;
+
+		constexpr static block_index_type invalid_block = std::numeric_limits<block_index_type>::max();
+
+		using size_class_mask_type = std::uint64_t;
+		constexpr static size_type size_class_count = std::numeric_limits<size_class_mask_type>::digits;
+
+		struct block_location
+		{
+			size_type size_class;
+			// index in the bucket
+			size_type position;
+		};
+
+		using bucket_type = std::vector<block_index_type>;
+		using buckets_type = std::array<bucket_type, size_class_count>;
+		using locations_type = std::vector<block_location>;
+
 		pool_type pool_;
 		size_type block_initial_size_;
+		PROMETHEUS_COMPILER_NO_UNIQUE_ADDRESS allocator_type allocator_;
+
+		// the block that strings are appended to first, it is not in the index
+		block_index_type current_block_;
+
+		// size class => blocks
+		buckets_type buckets_;
+		// block => location in buckets_
+		locations_type locations_;
+		// bit `c` is set <=> buckets_[c] is not empty
+		size_class_mask_type size_class_mask_;
 
-		using block_iterator = pool_type::iterator;
+		[[nodiscard]] constexpr static auto size_class_of(const size_type size) noexcept -> size_type
+		{
+			// the last size class holds all the (huge) blocks that do not fit anywhere else
+			return std::ranges::min(static_cast<size_type>(std::bit_width(size)), size_class_count - 1);
+		}
+
+		constexpr auto index_insert(const block_index_type block) -> void
+		{
+			const auto size_class = StringPool::size_class_of(pool_[block].available_space());
+			auto& bucket = buckets_[size_class];
+
+			locations_[block] = {.size_class = size_class, .position = bucket.size()};
+			bucket.push_back(block);
+			size_class_mask_ |= size_class_mask_type{1} << size_class;
+		}
 
-		[[nodiscard]] constexpr auto find_first_possible_storable_block(const size_type length) noexcept -> block_iterator
+		constexpr auto index_erase(const block_index_type block) noexcept -> void
 		{
-			if (pool_.size() > 2 && not std::ranges::prev(pool_.end(), 2)->storable(length))
+			const auto [size_class, position] = locations_[block];
+			auto& bucket = buckets_[size_class];
+
+			PROMETHEUS_PLATFORM_ASSUME(position < bucket.size() and bucket[position] == block);
+
+			// swap and pop
+			const auto last = bucket.back();
+			bucket[position] = last;
+			locations_[last].position = position;
+			bucket.pop_back();
+
+			if (bucket.empty())
 			{
-				return std::ranges::prev(pool_.end());
+				size_class_mask_ &= ~(size_class_mask_type{1} << size_class);
 			}
-			return pool_.begin();
 		}
 
-		[[nodiscard]] constexpr auto find_storable_block(const size_type length) noexcept -> block_iterator
+		constexpr auto index_update(const block_index_type block) -> void
 		{
-			return std::ranges::partition_point(
-				this->find_first_possible_storable_block(length),
-				pool_.end(),
-				[length](const auto& block) noexcept -> bool
-				{
-					return not block.storable(length);
-				}
-			);
+			if (StringPool::size_class_of(pool_[block].available_space()) != locations_[block].size_class)
+			{
+				this->index_erase(block);
+				this->index_insert(block);
+			}
+		}
+
+		constexpr auto clear() noexcept -> void
+		{
+			pool_.clear();
+			current_block_ = invalid_block;
+			this->index_clear();
+		}
+
+		// Take over the blocks (and the index) of the other pool, the memory of the other pool must be releasable by our allocator.
+		constexpr auto steal(StringPool& other) noexcept -> void
+		{
+			pool_ = std::move(other.pool_);
+			current_block_ = std::exchange(other.current_block_, invalid_block);
+			buckets_ = std::move(other.buckets_);
+			locations_ = std::move(other.locations_);
+			size_class_mask_ = std::exchange(other.size_class_mask_, 0);
+
+			other.clear();
+		}
+
+		constexpr auto index_clear() noexcept -> void
+		{
+			for (auto& bucket: buckets_)
+			{
+				bucket.clear();
+			}
+			locations_.clear();
+			size_class_mask_ = 0;
+		}
+
+		// Returns `invalid_block` if there is no indexed block can store the string.
+		[[nodiscard]] constexpr auto find_storable_block(const size_type length) const noexcept -> block_index_type
+		{
+			const auto size_class = StringPool::size_class_of(length);
+
+			// Every block in a greater size class can store the string, take the block from the smallest one.
+			// note: `size_class_mask_type{2} << (size_class_count - 1)` wraps to 0, and all bits are masked out
+			if (const auto greater = size_class_mask_ & ~((size_class_mask_type{2} << size_class) - 1);
+				greater != 0)
+			{
+				return buckets_[static_cast<size_type>(std::countr_zero(greater))].back();
+			}
+
+			// The blocks in the same size class may or may not be able to store the string, only the last one is checked.
+			if (const auto& bucket = buckets_[size_class];
+				not bucket.empty() and pool_[bucket.back()].storable(length))
+			{
+				return bucket.back();
+			}
+
+			return invalid_block;
 		}
 
-		[[nodiscard]] constexpr auto create_storable_block(const size_type length) -> block_iterator
+		[[nodiscard]] constexpr auto create_storable_block(const size_type length) -> block_index_type
 		{
-			pool_.emplace_back(std::ranges::max(block_initial_size_, length + IsNullTerminate));
-			return std::ranges::prev(pool_.end());
+			const auto block = pool_.size();
+
+			pool_.emplace_back(std::ranges::max(block_initial_size_, length), allocator_);
+			locations_.emplace_back();
+
+			// retire the current block
+			if (current_block_ != invalid_block)
+			{
+				this->index_insert(current_block_);
+			}
+			current_block_ = block;
+
+			return block;
 		}
 
-		[[nodiscard]] constexpr auto find_or_create_block(const size_type length) -> block_iterator
+		[[nodiscard]] constexpr auto find_or_create_block(const size_type length) -> block_index_type
 		{
+			if (current_block_ != invalid_block and pool_[current_block_].storable(length))
+			{
+				return current_block_;
+			}
+
 			if (const auto block = this->find_storable_block(length);
-				block != pool_.end())
+				block != invalid_block)
 			{
 				return block;
 			}
+
 			return this->create_storable_block(length);
 		}
 
-		constexpr auto shake_it(block_iterator block) -> void
+		// block index sorted by the address of its memory
+		[[nodiscard]] constexpr auto blocks_by_address() const -> std::vector<block_index_type>
 		{
-			if (
-				block == pool_.begin() ||
-				block->more_available_space_than(*std::ranges::prev(block))
-			)
-			{
-				return;
-			}
+			std::vector<block_index_type> blocks(pool_.size());
+			std::iota(blocks.begin(), blocks.end(), block_index_type{0});
+			std::ranges::sort(
+				blocks,
+				std::ranges::less{},
+				[this](const block_index_type block) noexcept -> const value_type*
+				{
+					return pool_[block].view().data();
+				}
+			);
 
-			if (const auto it =
-						std::ranges::upper_bound(
-							pool_.begin(),
-							block,
-							block->available_space(),
-							std::ranges::less{},
-							[](const auto& b) noexcept -> size_type
-							{
-								return b.available_space();
-							});
-				it != block)
+			return blocks;
+		}
+
+		// Returns the block (and the offset in the block) where the string is stored.
+		[[nodiscard]] constexpr auto locate(const std::vector<block_index_type>& blocks, const view_type string) const noexcept -> std::pair<block_index_type, size_type>
+		{
+			const auto it = std::ranges::upper_bound(
+				blocks,
+				string.data(),
+				std::ranges::less{},
+				[this](const block_index_type block) noexcept -> const value_type*
+				{
+					return pool_[block].view().data();
+				}
+			);
+			PROMETHEUS_PLATFORM_ASSUME(it != blocks.begin(), "The string is not in the pool.");
+
+			const auto block = *std::ranges::prev(it);
+			const auto view = pool_[block].view();
+			PROMETHEUS_PLATFORM_ASSUME(
+				string.data() + string.size() <= view.data() + view.size(),
+				"The string is not in the pool."
+			);
+
+			return {block, static_cast<size_type>(string.data() - view.data())};
+		}
+
+		// The offset of each block when all blocks are stored contiguously
+		[[nodiscard]] constexpr auto offset_of_blocks() const -> std::vector<size_type>
+		{
+			std::vector<size_type> offsets{};
+			offsets.reserve(pool_.size());
+
+			size_type offset = 0;
+			for (const auto& block: pool_)
 			{
-				std::ranges::rotate(it, block, std::ranges::next(block));
+				offsets.push_back(offset);
+				offset += block.size();
 			}
+
+			return offsets;
 		}
 
-		[[nodiscard]] constexpr auto append_string_into_block(const view_type string, block_iterator block) -> view_type
+		[[nodiscard]] constexpr auto append_string_into_block(const view_type string, const block_index_type block) -> view_type
 		{
-			const auto view = block->append(string);
+			const auto view = pool_[block].append(string);
 
-			this->shake_it(block);
+			if (block != current_block_)
+			{
+				this->index_update(block);
+			}
 			return view;
 		}
 
 	public:
-		constexpr explicit StringPool(size_type block_initial_size = default_block_initial_size) noexcept(std::is_nothrow_default_constructible_v<pool_type>)
-			: block_initial_size_(block_initial_size) {}
+		constexpr explicit StringPool(
+			const size_type block_initial_size = default_block_initial_size,
+			const allocator_type& allocator = allocator_type{}
+		) noexcept(std::is_nothrow_default_constructible_v<pool_type>)
+			: block_initial_size_{block_initial_size},
+			  allocator_{allocator},
+			  current_block_{invalid_block},
+			  buckets_{},
+			  size_class_mask_{0} {}
+
+		constexpr explicit StringPool(const allocator_type& allocator) noexcept(std::is_nothrow_default_constructible_v<pool_type>)
+			: StringPool{default_block_initial_size, allocator} {}
+
+		constexpr StringPool(const StringPool& other)
+			: StringPool{other.block_initial_size_, allocator_traits_type::select_on_container_copy_construction(other.allocator_)}
+		{
+			this->join(other);
+		}
+
+		constexpr StringPool(StringPool&& other) noexcept
+			: pool_{std::move(other.pool_)},
+			  block_initial_size_{other.block_initial_size_},
+			  allocator_{std::move(other.allocator_)},
+			  current_block_{std::exchange(other.current_block_, invalid_block)},
+			  buckets_{std::move(other.buckets_)},
+			  locations_{std::move(other.locations_)},
+			  size_class_mask_{std::exchange(other.size_class_mask_, 0)}
+		{
+			other.clear();
+		}
+
+		constexpr auto operator=(const StringPool& other) -> StringPool&
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+
+			this->clear();
+
+			if constexpr (allocator_traits_type::propagate_on_container_copy_assignment::value)
+			{
+				allocator_ = other.allocator_;
+			}
+			block_initial_size_ = other.block_initial_size_;
+
+			this->join(other);
+			return *this;
+		}
+
+		constexpr auto operator=(StringPool&& other) noexcept(
+			allocator_traits_type::propagate_on_container_move_assignment::value or
+			allocator_traits_type::is_always_equal::value
+		) -> StringPool&
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+
+			block_initial_size_ = other.block_initial_size_;
+
+			if constexpr (allocator_traits_type::propagate_on_container_move_assignment::value)
+			{
+				allocator_ = std::move(other.allocator_);
+				this->steal(other);
+			}
+			else if constexpr (allocator_traits_type::is_always_equal::value)
+			{
+				this->steal(other);
+			}
+			else
+			{
+				if (allocator_ == other.allocator_)
+				{
+					this->steal(other);
+				}
+				else
+				{
+					// the memory of the other pool cannot be released by our allocator, copy the blocks
+					this->clear();
+					this->join(std::move(other));
+				}
+			}
+
+			return *this;
+		}
+
+		constexpr ~StringPool() noexcept = default;
 
 		template<typename... Pools>
 			requires (std::same_as<StringPool, std::remove_cvref_t<Pools>> and ...)
 		constexpr explicit StringPool(Pools&&... pools)
+			: StringPool{}
 		{
 			this->join(std::forward<Pools>(pools)...);
 		}
@@ -249,8 +685,9 @@ namespace prometheus::string
 		constexpr auto join(Pools&&... pools) -> void
 		{
 			pool_.reserve(pool_.size() + (pools.pool_.size() + ...));
+			locations_.reserve(pool_.capacity());
 
-			const auto f = [this]<typename Pool>(Pool&& pool) noexcept -> void
+			const auto f = [this]<typename Pool>(Pool&& pool) -> void
 			{
 				// silence warning
 				auto&& p = std::forward<Pool>(pool);
@@ -258,35 +695,93 @@ namespace prometheus::string
 				const auto size = pool_.size();
 				if constexpr (std::is_rvalue_reference_v<Pool&&>)
 				{
-					pool_.insert(pool_.end(), std::make_move_iterator(p.pool_.begin()), std::make_move_iterator(p.pool_.end()));
-					p.pool_.clear();
+					if (allocator_traits_type::is_always_equal::value or allocator_ == p.allocator_)
+					{
+						pool_.insert(pool_.end(), std::make_move_iterator(p.pool_.begin()), std::make_move_iterator(p.pool_.end()));
+					}
+					else
+					{
+						// the memory of the other pool cannot be released by our allocator
+						for (const auto& block: p.pool_)
+						{
+							pool_.emplace_back(block, allocator_);
+						}
+					}
+					p.clear();
 				}
 				else
 				{
-#if __has_cpp_attribute(cpp_lib_containers_ranges) and cpp_lib_containers_ranges >= 202202L
-					pool_.insert_range(pool_.end(), p.pool_);
-#else
-					pool_.insert(pool_.end(), p.pool_.begin(), p.pool_.end());
-#endif
+					for (const auto& block: p.pool_)
+					{
+						pool_.emplace_back(block, allocator_);
+					}
 				}
 
-				std::ranges::inplace_merge(
-					pool_,
-					std::ranges::next(pool_.begin(), size),
-					[](const auto& a, const auto& b) noexcept -> bool
-					{
-						return not a.more_available_space_than(b);
-					});
+				// the blocks of the other pool (including its current block) are all indexed
+				locations_.resize(pool_.size());
+				for (auto block = size; block < pool_.size(); ++block)
+				{
+					this->index_insert(block);
+				}
 			};
 			(f.operator()(std::forward<Pools>(pools)), ...);
 		}
 
+		/**
+		 * @brief Make sure that strings occupying a total of `bytes` bytes (including the null terminators, if any, the same unit as `memory_usage()`)
+		 * can be added without creating a new block.
+		 * @note If the current block does not have enough space, a new block is created,
+		 * the space left in the previous block can still be used by the strings added later.
+		 */
+		constexpr auto reserve(const size_type bytes) -> void
+		{
+			// in characters, rounded up
+			const auto length = (bytes + sizeof(value_type) - 1) / sizeof(value_type);
+
+			if (current_block_ != invalid_block and pool_[current_block_].storable(length))
+			{
+				return;
+			}
+
+			std::ignore = this->create_storable_block(length);
+		}
+
 		/**
 		 * @brief Add a string to the pool, and then you can freely use the added string.
 		 */
 		[[nodiscard]] constexpr auto add(const view_type string) -> view_type
 		{
-			return this->append_string_into_block(string, this->find_or_create_block(string.size()));
+			// the length of the string in the block (including the null terminator, if any)
+			return this->append_string_into_block(string, this->find_or_create_block(block_type::length_of(string)));
+		}
+
+		/**
+		 * @brief Add all the strings to the pool, and write the added strings to `out`.
+		 * @note If `strings` is a forward range, all the strings are packed contiguously into one block.
+		 */
+		template<std::ranges::input_range Range, std::output_iterator<view_type> Out>
+			requires std::convertible_to<std::ranges::range_reference_t<Range>, view_type>
+		constexpr auto add_range(Range&& strings, Out out) -> Out
+		{
+			if constexpr (std::ranges::forward_range<Range>)
+			{
+				size_type length = 0;
+				// the reference may be a prvalue (e.g. `std::string`), keep it alive while the view is in use
+				for (auto&& string: strings)
+				{
+					length += block_type::length_of(view_type{string});
+				}
+
+				this->reserve(length * sizeof(value_type));
+			}
+
+			for (auto&& string: strings)
+			{
+				*out = this->add(view_type{string});
+				++out;
+			}
+
+			return out;
 		}
 
 		[[nodiscard]] constexpr auto size() const noexcept -> size_type
@@ -294,6 +789,125 @@ namespace prometheus::string
 			return pool_.size();
 		}
 
+		[[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type
+		{
+			return allocator_;
+		}
+
+		/**
+		 * @brief Write all blocks (contiguously) and an offset table of `strings` (which must have been added to this pool) to `out`.
+		 * @note The format is described by `string_pool_detail::serialized_header`, use `MappedStringPool` to read it.
+		 */
+		auto serialize(std::ostream& out, const std::span<const view_type> strings) const -> void
+		{
+			const auto block_offsets = this->offset_of_blocks();
+			const auto blocks = this->blocks_by_address();
+
+			const auto character_count = pool_.empty() ? 0 : block_offsets.back() + pool_.back().size();
+
+			const string_pool_detail::serialized_header header
+			{
+					.magic = string_pool_detail::serialized_magic,
+					.version = string_pool_detail::serialized_version,
+					.character_size = static_cast<std::uint8_t>(sizeof(value_type)),
+					.is_null_terminate = static_cast<std::uint8_t>(IsNullTerminate),
+					.string_count = static_cast<std::uint64_t>(strings.size()),
+					.character_count = static_cast<std::uint64_t>(character_count)
+			};
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+			for (const auto string: strings)
+			{
+				const auto [block, offset] = this->locate(blocks, string);
+
+				const string_pool_detail::serialized_string entry
+				{
+						.offset = static_cast<std::uint64_t>(block_offsets[block] + offset),
+						.length = static_cast<std::uint64_t>(string.size())
+				};
+				out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+			}
+
+			for (const auto& block: pool_)
+			{
+				const auto view = block.view();
+				out.write(reinterpret_cast<const char*>(view.data()), static_cast<std::streamsize>(view.size() * sizeof(value_type)));
+			}
+		}
+
+		/**
+		 * @brief Repack all blocks into a single (full) block.
+		 * @note All views returned before are invalidated, except for `strings` (which must have been added to this pool),
+		 * they are updated to refer to the repacked block.
+		 */
+		constexpr auto compact(const std::span<view_type> strings = {}) -> void
+		{
+			if (pool_.size() <= 1)
+			{
+				return;
+			}
+
+			const auto block_offsets = this->offset_of_blocks();
+
+			block_type compacted{block_offsets.back() + pool_.back().size(), allocator_};
+			for (const auto& block: pool_)
+			{
+				std::ignore = compacted.append_contents(block);
+			}
+
+			const auto blocks = this->blocks_by_address();
+			const auto data = compacted.view().data();
+			for (auto& string: strings)
+			{
+				const auto [block, offset] = this->locate(blocks, string);
+				string = {data + block_offsets[block] + offset, string.size()};
+			}
+
+			this->clear();
+			pool_.push_back(std::move(compacted));
+			locations_.emplace_back();
+			current_block_ = 0;
+		}
+
+		/**
+		 * @brief The number of bytes allocated for the strings.
+		 */
+		[[nodiscard]] constexpr auto memory_usage() const noexcept -> size_type
+		{
+			size_type capacity = 0;
+			for (const auto& block: pool_)
+			{
+				capacity += block.capacity();
+			}
+
+			return capacity * sizeof(value_type);
+		}
+
+		/**
+		 * @brief The ratio of the space left in the blocks other than the current block to the total space of all blocks, in [0, 1].
+		 * @note The space left in the current block is not counted, it will be used by the next strings.
+		 */
+		[[nodiscard]] constexpr auto fragmentation() const noexcept -> double
+		{
+			size_type capacity = 0;
+			size_type available = 0;
+			for (block_index_type block = 0; block < pool_.size(); ++block)
+			{
+				capacity += pool_[block].capacity();
+				if (block != current_block_)
+				{
+					available += pool_[block].available_space();
+				}
+			}
+
+			if (capacity == 0)
+			{
+				return 0;
+			}
+
+			return static_cast<double>(available) / static_cast<double>(capacity);
+		}
+
 		[[nodiscard]] constexpr auto block_initial_size() const noexcept -> size_type
 		{
 			return block_initial_size_;
@@ -307,4 +921,10 @@ namespace prometheus::string
 			block_initial_size_ = capacity;
 		}
 	};
+
+	namespace pmr
+	{
+		template<typename CharType = char, bool IsNullTerminate = true, typename CharTrait = std::char_traits<CharType>>
+		using StringPool = string::StringPool<CharType, IsNullTerminate, CharTrait, std::pmr::polymorphic_allocator<CharType>>;
+	}
 }
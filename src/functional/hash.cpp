@@ -0,0 +1,220 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <prometheus/functional/hash.hpp>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/platform/cpu.hpp>
+
+#if defined(PROMETHEUS_ARCH_X64) || defined(PROMETHEUS_ARCH_X86)
+
+#ifdef PROMETHEUS_PLATFORM_WINDOWS
+
+#include <intrin.h>
+
+#else
+
+#include <immintrin.h>
+
+#endif
+
+#define PROMETHEUS_FUNCTIONAL_HASH_X86
+
+#endif
+
+namespace
+{
+	using namespace prometheus;
+
+	using functional::hash_detail::accumulator_type;
+
+	using kernel_type = auto (*)(accumulator_type& accumulator, const char* p, std::size_t stripes, std::size_t stripe_in_block) noexcept -> void;
+
+	// =========================================================
+	// SCALAR
+	// =========================================================
+
+	auto scalar_accumulate(accumulator_type& accumulator, const char* p, const std::size_t stripes, const std::size_t stripe_in_block) noexcept -> void
+	{
+		functional::hash_detail::accumulate_scalar(accumulator, p, stripes, stripe_in_block);
+	}
+
+#if defined(PROMETHEUS_FUNCTIONAL_HASH_X86)
+	using functional::hash_detail::stripe_secret;
+	using functional::hash_detail::stripe_size;
+	using functional::hash_detail::stripes_per_block;
+	using functional::hash_detail::prime_32;
+	using functional::hash_detail::stripe_secret_offset;
+	using functional::hash_detail::scramble_secret_offset;
+
+	// =========================================================
+	// SSE4.2
+	// =========================================================
+
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	auto sse_accumulate_stripe(__m128i* accumulator, const char* p, const std::uint64_t* secret) noexcept -> void
+	{
+		for (std::size_t i = 0; i < stripe_size / sizeof(__m128i); ++i)
+		{
+			const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + i);
+			const auto key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+			const auto data_key = _mm_xor_si128(data, key);
+			// (data_key & 0xffff'ffff) * (data_key >> 32)
+			const auto product = _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+			// accumulator[i ^ 1] += data
+			const auto sum = _mm_add_epi64(accumulator[i], _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			accumulator[i] = _mm_add_epi64(product, sum);
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	auto sse_scramble(__m128i* accumulator) noexcept -> void
+	{
+		const auto prime = _mm_set1_epi32(static_cast<int>(prime_32));
+
+		for (std::size_t i = 0; i < stripe_size / sizeof(__m128i); ++i)
+		{
+			const auto key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripe_secret.data() + scramble_secret_offset) + i);
+			const auto a = _mm_xor_si128(_mm_xor_si128(accumulator[i], _mm_srli_epi64(accumulator[i], 47)), key);
+
+			// 64-bit * 32-bit
+			const auto low = _mm_mul_epu32(a, prime);
+			const auto high = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+			accumulator[i] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	auto sse_accumulate(accumulator_type& accumulator, const char* p, const std::size_t stripes, std::size_t stripe_in_block) noexcept -> void
+	{
+		__m128i a[stripe_size / sizeof(__m128i)];
+		std::memcpy(a, accumulator.data(), sizeof(a));
+
+		for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+		{
+			sse_accumulate_stripe(a, p + stripe * stripe_size, stripe_secret.data() + stripe_secret_offset + stripe_in_block);
+
+			if (++stripe_in_block == stripes_per_block)
+			{
+				sse_scramble(a);
+				stripe_in_block = 0;
+			}
+		}
+
+		std::memcpy(accumulator.data(), a, sizeof(a));
+	}
+
+	// =========================================================
+	// AVX2
+	// =========================================================
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	auto avx2_accumulate_stripe(__m256i* accumulator, const char* p, const std::uint64_t* secret) noexcept -> void
+	{
+		for (std::size_t i = 0; i < stripe_size / sizeof(__m256i); ++i)
+		{
+			const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p) + i);
+			const auto key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+			const auto data_key = _mm256_xor_si256(data, key);
+			// (data_key & 0xffff'ffff) * (data_key >> 32)
+			const auto product = _mm256_mul_epu32(data_key, _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+			// accumulator[i ^ 1] += data
+			const auto sum = _mm256_add_epi64(accumulator[i], _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			accumulator[i] = _mm256_add_epi64(product, sum);
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	auto avx2_scramble(__m256i* accumulator) noexcept -> void
+	{
+		const auto prime = _mm256_set1_epi32(static_cast<int>(prime_32));
+
+		for (std::size_t i = 0; i < stripe_size / sizeof(__m256i); ++i)
+		{
+			const auto key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe_secret.data() + scramble_secret_offset) + i);
+			const auto a = _mm256_xor_si256(_mm256_xor_si256(accumulator[i], _mm256_srli_epi64(accumulator[i], 47)), key);
+
+			// 64-bit * 32-bit
+			const auto low = _mm256_mul_epu32(a, prime);
+			const auto high = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+			accumulator[i] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	auto avx2_accumulate(accumulator_type& accumulator, const char* p, const std::size_t stripes, std::size_t stripe_in_block) noexcept -> void
+	{
+		__m256i a[stripe_size / sizeof(__m256i)];
+		std::memcpy(a, accumulator.data(), sizeof(a));
+
+		for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+		{
+			avx2_accumulate_stripe(a, p + stripe * stripe_size, stripe_secret.data() + stripe_secret_offset + stripe_in_block);
+
+			if (++stripe_in_block == stripes_per_block)
+			{
+				avx2_scramble(a);
+				stripe_in_block = 0;
+			}
+		}
+
+		std::memcpy(accumulator.data(), a, sizeof(a));
+	}
+#endif
+
+	[[nodiscard]] auto select_kernel() noexcept -> kernel_type
+	{
+#if defined(PROMETHEUS_FUNCTIONAL_HASH_X86)
+		using platform::InstructionSet;
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX2))
+		{
+			return avx2_accumulate;
+		}
+
+		if (platform::is_instruction_set_supported(InstructionSet::SSE42))
+		{
+			return sse_accumulate;
+		}
+#endif
+
+		return scalar_accumulate;
+	}
+
+	[[nodiscard]] auto kernel() noexcept -> kernel_type
+	{
+		static const auto k = select_kernel();
+		return k;
+	}
+}
+
+namespace prometheus::functional::hash_detail
+{
+	auto accumulate_vectorized(accumulator_type& accumulator, const char* p, const std::size_t stripes, const std::size_t stripe_in_block) noexcept -> void
+	{
+		kernel()(accumulator, p, stripes, stripe_in_block);
+	}
+
+	auto accumulate_sse(accumulator_type& accumulator, const char* p, const std::size_t stripes, const std::size_t stripe_in_block) noexcept -> void
+	{
+#if defined(PROMETHEUS_FUNCTIONAL_HASH_X86)
+		sse_accumulate(accumulator, p, stripes, stripe_in_block);
+#else
+		scalar_accumulate(accumulator, p, stripes, stripe_in_block);
+#endif
+	}
+
+	auto accumulate_avx2(accumulator_type& accumulator, const char* p, const std::size_t stripes, const std::size_t stripe_in_block) noexcept -> void
+	{
+#if defined(PROMETHEUS_FUNCTIONAL_HASH_X86)
+		avx2_accumulate(accumulator, p, stripes, stripe_in_block);
+#else
+		scalar_accumulate(accumulator, p, stripes, stripe_in_block);
+#endif
+	}
+}
@@ -0,0 +1,350 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+#include <prometheus/numeric/random_engine.hpp>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/platform/cpu.hpp>
+
+#if defined(PROMETHEUS_ARCH_X64) || defined(PROMETHEUS_ARCH_X86)
+
+#define PROMETHEUS_NUMERIC_RANDOM_ENGINE_X86
+
+#if defined(PROMETHEUS_COMPILER_MSVC)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+
+#endif
+
+namespace
+{
+	using namespace prometheus;
+
+	// The kernels are the same (portable) code as `generate_lanes`, `LaneWord` is vectorized by the compiler for the target of the kernel.
+	// (The loop is spelled out in every kernel, a call to `generate_lanes` would not be inlined and compiled for the target.)
+
+	template<typename LaneEngine>
+	using kernel_type = auto (*)(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, std::size_t steps) noexcept -> void;
+
+	// =========================================================
+	// SCALAR
+	// =========================================================
+
+	template<typename LaneEngine>
+	auto scalar_generate(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, const std::size_t steps) noexcept -> void
+	{
+		numeric::random_engine_detail::generate_lanes<LaneEngine>(state, out, steps);
+	}
+
+#if defined(PROMETHEUS_NUMERIC_RANDOM_ENGINE_X86)
+	// =========================================================
+	// AVX2
+	// =========================================================
+
+	template<typename LaneEngine>
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	auto avx2_generate(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, const std::size_t steps) noexcept -> void
+	{
+		auto s = state;
+
+		for (std::size_t step = 0; step < steps; ++step)
+		{
+			const auto result = LaneEngine::step(s);
+			std::memcpy(out + step * LaneEngine::lane_count, &result.value, sizeof(result.value));
+		}
+
+		state = s;
+	}
+
+	// =========================================================
+	// AVX-512
+	// =========================================================
+
+	template<typename LaneEngine>
+	PROMETHEUS_COMPILER_TARGET("avx512f,avx512dq")
+	auto avx512_generate(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, const std::size_t steps) noexcept -> void
+	{
+		auto s = state;
+
+		for (std::size_t step = 0; step < steps; ++step)
+		{
+			const auto result = LaneEngine::step(s);
+			std::memcpy(out + step * LaneEngine::lane_count, &result.value, sizeof(result.value));
+		}
+
+		state = s;
+	}
+#endif
+
+	template<typename LaneEngine>
+	[[nodiscard]] auto select_kernel() noexcept -> kernel_type<LaneEngine>
+	{
+#if defined(PROMETHEUS_NUMERIC_RANDOM_ENGINE_X86)
+		using platform::InstructionSet;
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX512F | InstructionSet::AVX512DQ))
+		{
+			return avx512_generate<LaneEngine>;
+		}
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX2))
+		{
+			return avx2_generate<LaneEngine>;
+		}
+#endif
+
+		return scalar_generate<LaneEngine>;
+	}
+
+	template<typename LaneEngine>
+	[[nodiscard]] auto kernel() noexcept -> kernel_type<LaneEngine>
+	{
+		static const auto k = select_kernel<LaneEngine>();
+		return k;
+	}
+}
+
+namespace
+{
+	namespace philox = numeric::random_engine_detail::philox;
+
+	// =========================================================
+	// PHILOX
+	// =========================================================
+
+	using philox_kernel_type = auto (*)(const philox::key_type& key, std::uint64_t stream, std::uint64_t first_block, philox::word_type* out, std::size_t blocks) noexcept -> void;
+
+	auto philox_scalar_generate(const philox::key_type& key, const std::uint64_t stream, const std::uint64_t first_block, philox::word_type* out, const std::size_t blocks) noexcept -> void
+	{
+		philox::generate(key, stream, first_block, out, blocks);
+	}
+
+#if defined(PROMETHEUS_NUMERIC_RANDOM_ENGINE_X86)
+	// Each vector holds the same counter word of N blocks (N = 32-bit lanes), the 32 x 32 => 64 multiplications are done for the even and the odd lanes,
+	// then the 4 vectors are transposed to the output order (4 words of block 0, 4 words of block 1, ...).
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	auto philox_avx2_generate(const philox::key_type& key, const std::uint64_t stream, const std::uint64_t first_block, philox::word_type* out, const std::size_t blocks) noexcept -> void
+	{
+		constexpr std::size_t lanes = 8;
+
+		const auto multiplier_0 = _mm256_set1_epi32(static_cast<int>(philox::multiplier_0));
+		const auto multiplier_1 = _mm256_set1_epi32(static_cast<int>(philox::multiplier_1));
+		const auto stream_low = _mm256_set1_epi32(static_cast<int>(static_cast<philox::word_type>(stream)));
+		const auto stream_high = _mm256_set1_epi32(static_cast<int>(static_cast<philox::word_type>(stream >> 32)));
+
+		std::size_t block = 0;
+		for (; block + lanes <= blocks; block += lanes)
+		{
+			alignas(32) std::array<philox::word_type, lanes> index_low; // NOLINT(cppcoreguidelines-pro-type-member-init)
+			alignas(32) std::array<philox::word_type, lanes> index_high; // NOLINT(cppcoreguidelines-pro-type-member-init)
+			for (std::size_t lane = 0; lane < lanes; ++lane)
+			{
+				const auto index = first_block + block + lane;
+				index_low[lane] = static_cast<philox::word_type>(index);
+				index_high[lane] = static_cast<philox::word_type>(index >> 32);
+			}
+
+			auto c0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(index_low.data()));
+			auto c1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(index_high.data()));
+			auto c2 = stream_low;
+			auto c3 = stream_high;
+
+			auto k = key;
+			for (std::size_t round = 0; round < philox::rounds; ++round)
+			{
+				if (round != 0)
+				{
+					k[0] += philox::weyl_0;
+					k[1] += philox::weyl_1;
+				}
+
+				const auto product_0_even = _mm256_mul_epu32(c0, multiplier_0);
+				const auto product_0_odd = _mm256_mul_epu32(_mm256_srli_epi64(c0, 32), multiplier_0);
+				const auto product_1_even = _mm256_mul_epu32(c2, multiplier_1);
+				const auto product_1_odd = _mm256_mul_epu32(_mm256_srli_epi64(c2, 32), multiplier_1);
+
+				const auto low_0 = _mm256_blend_epi32(product_0_even, _mm256_slli_epi64(product_0_odd, 32), 0b1010'1010);
+				const auto high_0 = _mm256_blend_epi32(_mm256_srli_epi64(product_0_even, 32), product_0_odd, 0b1010'1010);
+				const auto low_1 = _mm256_blend_epi32(product_1_even, _mm256_slli_epi64(product_1_odd, 32), 0b1010'1010);
+				const auto high_1 = _mm256_blend_epi32(_mm256_srli_epi64(product_1_even, 32), product_1_odd, 0b1010'1010);
+
+				const auto new_c0 = _mm256_xor_si256(_mm256_xor_si256(high_1, c1), _mm256_set1_epi32(static_cast<int>(k[0])));
+				const auto new_c2 = _mm256_xor_si256(_mm256_xor_si256(high_0, c3), _mm256_set1_epi32(static_cast<int>(k[1])));
+				c0 = new_c0;
+				c1 = low_1;
+				c2 = new_c2;
+				c3 = low_0;
+			}
+
+			// [c0 c1 c0 c1 | ...] => [block 0 | block 4], [block 1 | block 5], [block 2 | block 6], [block 3 | block 7]
+			const auto t0 = _mm256_unpacklo_epi32(c0, c1);
+			const auto t1 = _mm256_unpackhi_epi32(c0, c1);
+			const auto t2 = _mm256_unpacklo_epi32(c2, c3);
+			const auto t3 = _mm256_unpackhi_epi32(c2, c3);
+			const auto u0 = _mm256_unpacklo_epi64(t0, t2);
+			const auto u1 = _mm256_unpackhi_epi64(t0, t2);
+			const auto u2 = _mm256_unpacklo_epi64(t1, t3);
+			const auto u3 = _mm256_unpackhi_epi64(t1, t3);
+
+			auto* dest = reinterpret_cast<__m256i*>(out + block * philox::block_type{}.size());
+			_mm256_storeu_si256(dest + 0, _mm256_permute2x128_si256(u0, u1, 0x20));
+			_mm256_storeu_si256(dest + 1, _mm256_permute2x128_si256(u2, u3, 0x20));
+			_mm256_storeu_si256(dest + 2, _mm256_permute2x128_si256(u0, u1, 0x31));
+			_mm256_storeu_si256(dest + 3, _mm256_permute2x128_si256(u2, u3, 0x31));
+		}
+
+		philox::generate(key, stream, first_block + block, out + block * philox::block_type{}.size(), blocks - block);
+	}
+
+	PROMETHEUS_COMPILER_DISABLE_WARNING_PUSH
+	// GCC 12: the AVX-512 intrinsics start from `_mm512_undefined_epi32()`, https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105593
+	PROMETHEUS_COMPILER_DISABLE_GNU_WARNING(-Wmaybe-uninitialized)
+
+	PROMETHEUS_COMPILER_TARGET("avx512f")
+	auto philox_avx512_generate(const philox::key_type& key, const std::uint64_t stream, const std::uint64_t first_block, philox::word_type* out, const std::size_t blocks) noexcept -> void
+	{
+		constexpr std::size_t lanes = 16;
+
+		const auto multiplier_0 = _mm512_set1_epi32(static_cast<int>(philox::multiplier_0));
+		const auto multiplier_1 = _mm512_set1_epi32(static_cast<int>(philox::multiplier_1));
+		const auto stream_low = _mm512_set1_epi32(static_cast<int>(static_cast<philox::word_type>(stream)));
+		const auto stream_high = _mm512_set1_epi32(static_cast<int>(static_cast<philox::word_type>(stream >> 32)));
+
+		// the indices of the words of (a, b) => [a.0 b.0 a.1 b.1 ...] (the first / the second half of a and b)
+		const auto interleave_32_low = _mm512_set_epi32(23, 7, 22, 6, 21, 5, 20, 4, 19, 3, 18, 2, 17, 1, 16, 0);
+		const auto interleave_32_high = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12, 27, 11, 26, 10, 25, 9, 24, 8);
+		const auto interleave_64_low = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+		const auto interleave_64_high = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+
+		std::size_t block = 0;
+		for (; block + lanes <= blocks; block += lanes)
+		{
+			alignas(64) std::array<philox::word_type, lanes> index_low; // NOLINT(cppcoreguidelines-pro-type-member-init)
+			alignas(64) std::array<philox::word_type, lanes> index_high; // NOLINT(cppcoreguidelines-pro-type-member-init)
+			for (std::size_t lane = 0; lane < lanes; ++lane)
+			{
+				const auto index = first_block + block + lane;
+				index_low[lane] = static_cast<philox::word_type>(index);
+				index_high[lane] = static_cast<philox::word_type>(index >> 32);
+			}
+
+			auto c0 = _mm512_load_si512(index_low.data());
+			auto c1 = _mm512_load_si512(index_high.data());
+			auto c2 = stream_low;
+			auto c3 = stream_high;
+
+			auto k = key;
+			for (std::size_t round = 0; round < philox::rounds; ++round)
+			{
+				if (round != 0)
+				{
+					k[0] += philox::weyl_0;
+					k[1] += philox::weyl_1;
+				}
+
+				const auto product_0_even = _mm512_mul_epu32(c0, multiplier_0);
+				const auto product_0_odd = _mm512_mul_epu32(_mm512_srli_epi64(c0, 32), multiplier_0);
+				const auto product_1_even = _mm512_mul_epu32(c2, multiplier_1);
+				const auto product_1_odd = _mm512_mul_epu32(_mm512_srli_epi64(c2, 32), multiplier_1);
+
+				const auto low_0 = _mm512_mask_blend_epi32(0xaaaa, product_0_even, _mm512_slli_epi64(product_0_odd, 32));
+				const auto high_0 = _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(product_0_even, 32), product_0_odd);
+				const auto low_1 = _mm512_mask_blend_epi32(0xaaaa, product_1_even, _mm512_slli_epi64(product_1_odd, 32));
+				const auto high_1 = _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(product_1_even, 32), product_1_odd);
+
+				const auto new_c0 = _mm512_xor_si512(_mm512_xor_si512(high_1, c1), _mm512_set1_epi32(static_cast<int>(k[0])));
+				const auto new_c2 = _mm512_xor_si512(_mm512_xor_si512(high_0, c3), _mm512_set1_epi32(static_cast<int>(k[1])));
+				c0 = new_c0;
+				c1 = low_1;
+				c2 = new_c2;
+				c3 = low_0;
+			}
+
+			// [c0.0 c1.0 c0.1 c1.1 ...] / [c2.0 c3.0 c2.1 c3.1 ...] => [c0.0 c1.0 c2.0 c3.0 c0.1 c1.1 c2.1 c3.1 ...]
+			const auto c01_low = _mm512_permutex2var_epi32(c0, interleave_32_low, c1);
+			const auto c01_high = _mm512_permutex2var_epi32(c0, interleave_32_high, c1);
+			const auto c23_low = _mm512_permutex2var_epi32(c2, interleave_32_low, c3);
+			const auto c23_high = _mm512_permutex2var_epi32(c2, interleave_32_high, c3);
+
+			auto* dest = out + block * philox::block_type{}.size();
+			_mm512_storeu_si512(dest + 0 * lanes, _mm512_permutex2var_epi64(c01_low, interleave_64_low, c23_low));
+			_mm512_storeu_si512(dest + 1 * lanes, _mm512_permutex2var_epi64(c01_low, interleave_64_high, c23_low));
+			_mm512_storeu_si512(dest + 2 * lanes, _mm512_permutex2var_epi64(c01_high, interleave_64_low, c23_high));
+			_mm512_storeu_si512(dest + 3 * lanes, _mm512_permutex2var_epi64(c01_high, interleave_64_high, c23_high));
+		}
+
+		philox::generate(key, stream, first_block + block, out + block * philox::block_type{}.size(), blocks - block);
+	}
+
+	PROMETHEUS_COMPILER_DISABLE_WARNING_POP
+#endif
+
+	[[nodiscard]] auto philox_select_kernel() noexcept -> philox_kernel_type
+	{
+#if defined(PROMETHEUS_NUMERIC_RANDOM_ENGINE_X86)
+		using platform::InstructionSet;
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX512F))
+		{
+			return philox_avx512_generate;
+		}
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX2))
+		{
+			return philox_avx2_generate;
+		}
+#endif
+
+		return philox_scalar_generate;
+	}
+
+	[[nodiscard]] auto philox_kernel() noexcept -> philox_kernel_type
+	{
+		static const auto k = philox_select_kernel();
+		return k;
+	}
+}
+
+namespace prometheus::numeric::random_engine_detail
+{
+	auto philox::generate_vectorized(const key_type& key, const bit64_type stream, const bit64_type first_block, word_type* out, const std::size_t blocks) noexcept -> void
+	{
+		philox_kernel()(key, stream, first_block, out, blocks);
+	}
+
+	template<typename LaneEngine>
+	auto generate_lanes_vectorized(typename LaneEngine::state_type& state, typename LaneEngine::result_type* out, const std::size_t steps) noexcept -> void
+	{
+		kernel<LaneEngine>()(state, out, steps);
+	}
+
+#define PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(engine) \
+	template auto generate_lanes_vectorized<RandomEngineLanes<engine, 4>>(RandomEngineLanes<engine, 4>::state_type&, engine::result_type*, std::size_t) noexcept -> void; \
+	template auto generate_lanes_vectorized<RandomEngineLanes<engine, 8>>(RandomEngineLanes<engine, 8>::state_type&, engine::result_type*, std::size_t) noexcept -> void; \
+	template auto generate_lanes_vectorized<RandomEngineLanes<engine, 16>>(RandomEngineLanes<engine, 16>::state_type&, engine::result_type*, std::size_t) noexcept -> void
+
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_128_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_128_plus_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_128_star_star);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xrsr_128_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xrsr_128_plus_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xrsr_128_star_star);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_256_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_256_plus_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_256_star_star);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_512_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_512_plus_plus);
+	PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES(random_engine_xsr_512_star_star);
+
+#undef PROMETHEUS_NUMERIC_RANDOM_ENGINE_LANES
+}
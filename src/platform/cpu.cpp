@@ -87,8 +87,9 @@ namespace
 		result.ecx = static_cast<std::uint32_t>(registers[2]);
 		result.edx = static_cast<std::uint32_t>(registers[3]);
 
-#elif defined(PROMETHEUS_COMPILER_GCC) || defined(PROMETHEUS_COMPILER_CLANG)
+#elif defined(PROMETHEUS_PLATFORM_LINUX) || defined(PROMETHEUS_PLATFORM_DARWIN)
 
+		// the same condition as the inclusion of <cpuid.h>, not a compiler macro (PROMETHEUS_COMPILER_GCC was never defined)
 		__cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
 
 #else
@@ -111,16 +112,13 @@ namespace
 
 		return _xgetbv(0);
 
-#elif defined(PROMETHEUS_COMPILER_GCC) || defined(PROMETHEUS_COMPILER_CLANG)
+#else
 
+		// note: never report 0 here, otherwise no AVX/AVX-512 instruction set is ever detected (and no vectorized kernel is ever selected)
 		std::uint32_t eax, edx;
 		asm volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
 		return (static_cast<std::uint64_t>(edx) << 32) | eax;
 
-#else
-
-		return 0; // Not supported
-
 #endif
 	}
 
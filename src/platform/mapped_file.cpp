@@ -0,0 +1,149 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <prometheus/platform/mapped_file.hpp>
+
+#include <utility>
+
+#include <prometheus/macro.hpp>
+
+#ifdef PROMETHEUS_PLATFORM_WINDOWS
+
+#include <Windows.h>
+
+#elif defined(PROMETHEUS_PLATFORM_LINUX) || defined(PROMETHEUS_PLATFORM_DARWIN)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#else
+
+#error "fixme"
+
+#endif
+
+namespace prometheus::platform
+{
+	auto MappedFile::open(const std::filesystem::path& path) noexcept -> std::optional<MappedFile>
+	{
+#ifdef PROMETHEUS_PLATFORM_WINDOWS
+
+		const auto file = CreateFileW(
+			path.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			nullptr
+		);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return std::nullopt;
+		}
+
+		LARGE_INTEGER file_size;
+		if (GetFileSizeEx(file, &file_size) == FALSE)
+		{
+			CloseHandle(file);
+			return std::nullopt;
+		}
+
+		if (file_size.QuadPart == 0)
+		{
+			// an empty file cannot be mapped
+			CloseHandle(file);
+			return MappedFile{nullptr, 0, nullptr};
+		}
+
+		const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		// the mapping object keeps the file open
+		CloseHandle(file);
+		if (mapping == nullptr)
+		{
+			return std::nullopt;
+		}
+
+		const auto* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr)
+		{
+			CloseHandle(mapping);
+			return std::nullopt;
+		}
+
+		return MappedFile{static_cast<const std::byte*>(data), static_cast<size_type>(file_size.QuadPart), mapping};
+
+#else
+
+		const auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (file == -1)
+		{
+			return std::nullopt;
+		}
+
+		struct stat file_stat{};
+		if (fstat(file, &file_stat) == -1)
+		{
+			close(file);
+			return std::nullopt;
+		}
+
+		if (file_stat.st_size == 0)
+		{
+			// an empty file cannot be mapped
+			close(file);
+			return MappedFile{nullptr, 0, nullptr};
+		}
+
+		const auto size = static_cast<size_type>(file_stat.st_size);
+		const auto* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+		// the mapping keeps the file open
+		close(file);
+		if (data == MAP_FAILED)
+		{
+			return std::nullopt;
+		}
+
+		return MappedFile{static_cast<const std::byte*>(data), size, nullptr};
+
+#endif
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: data_{std::exchange(other.data_, nullptr)},
+		  size_{std::exchange(other.size_, 0)},
+		  mapping_{std::exchange(other.mapping_, nullptr)} {}
+
+	auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+	{
+		// the previous mapping is released by `other`
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		std::swap(mapping_, other.mapping_);
+
+		return *this;
+	}
+
+	MappedFile::~MappedFile() noexcept
+	{
+		if (data_ == nullptr)
+		{
+			return;
+		}
+
+#ifdef PROMETHEUS_PLATFORM_WINDOWS
+
+		UnmapViewOfFile(data_);
+		CloseHandle(mapping_);
+
+#else
+
+		munmap(const_cast<std::byte*>(data_), size_);
+
+#endif
+	}
+}
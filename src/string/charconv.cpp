@@ -0,0 +1,2932 @@
+// This file is part of prometheus
+// Copyright (C) 2022-2025 Life4gal <life4gal@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <prometheus/string/charconv.hpp>
+
+#include <cstring>
+#include <bit>
+
+#include <prometheus/macro.hpp>
+
+#include <prometheus/platform/cpu.hpp>
+
+#if defined(PROMETHEUS_ARCH_X64) || defined(PROMETHEUS_ARCH_X86)
+
+#ifdef PROMETHEUS_PLATFORM_WINDOWS
+
+#include <intrin.h>
+
+#else
+
+#include <immintrin.h>
+
+#endif
+
+#define PROMETHEUS_STRING_CHARCONV_X86
+
+#endif
+
+namespace
+{
+	using namespace prometheus;
+
+	using string::charconv_detail::CharacterCategory;
+
+	struct kernel_type
+	{
+		auto (*is_all_of)(CharacterCategory category, const char* source, std::size_t size) noexcept -> bool;
+		auto (*to_upper)(const char* source, std::size_t size, char* dest) noexcept -> void;
+		auto (*to_lower)(const char* source, std::size_t size, char* dest) noexcept -> void;
+	};
+
+	// =========================================================
+	// SCALAR
+	// =========================================================
+
+	// the exact (locale-aware) semantics, used for the chunks that contain non-ASCII characters
+
+	[[nodiscard]] auto scalar_is_all_of(const CharacterCategory category, const char* source, const std::size_t size) noexcept -> bool
+	{
+		const std::basic_string_view view{source, size};
+
+		switch (category)
+		{
+			case CharacterCategory::UPPER:
+			{
+				return std::ranges::all_of(view, static_cast<auto (*)(char c) noexcept -> bool>(string::is_upper));
+			}
+			case CharacterCategory::LOWER:
+			{
+				return std::ranges::all_of(view, static_cast<auto (*)(char c) noexcept -> bool>(string::is_lower));
+			}
+			case CharacterCategory::ALPHA:
+			{
+				return std::ranges::all_of(view, static_cast<auto (*)(char c) noexcept -> bool>(string::is_alpha));
+			}
+			case CharacterCategory::DIGIT:
+			{
+				return std::ranges::all_of(view, static_cast<auto (*)(char c) noexcept -> bool>(string::is_digit));
+			}
+			case CharacterCategory::ALPHA_DIGIT:
+			{
+				return std::ranges::all_of(view, static_cast<auto (*)(char c) noexcept -> bool>(string::is_alpha_digit));
+			}
+			default:
+			{
+				PROMETHEUS_COMPILER_UNREACHABLE();
+			}
+		}
+	}
+
+	template<bool ToUpper>
+	auto scalar_convert(const char* source, const std::size_t size, char* dest) noexcept -> void
+	{
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			if constexpr (ToUpper)
+			{
+				dest[i] = string::to_upper(source[i]);
+			}
+			else
+			{
+				dest[i] = string::to_lower(source[i]);
+			}
+		}
+	}
+
+	// =========================================================
+	// SWAR
+	// =========================================================
+
+	constexpr std::uint64_t swar_ones = 0x0101'0101'0101'0101;
+	constexpr std::uint64_t swar_high = 0x8080'8080'8080'8080;
+
+	// The high bit of each byte of the result is set if the byte is in [lo, hi], all bytes of `x` must be ASCII (no carry between bytes).
+	[[nodiscard]] constexpr auto swar_in_range(const std::uint64_t x, const char lo, const char hi) noexcept -> std::uint64_t
+	{
+		const auto ge = (x + static_cast<std::uint64_t>(0x80 - lo) * swar_ones) & swar_high;
+		const auto gt = (x + static_cast<std::uint64_t>(0x7f - hi) * swar_ones) & swar_high;
+
+		return ge & ~gt;
+	}
+
+	[[nodiscard]] constexpr auto swar_category(const CharacterCategory category, const std::uint64_t x) noexcept -> std::uint64_t
+	{
+		switch (category)
+		{
+			case CharacterCategory::UPPER:
+			{
+				return swar_in_range(x, 'A', 'Z');
+			}
+			case CharacterCategory::LOWER:
+			{
+				return swar_in_range(x, 'a', 'z');
+			}
+			case CharacterCategory::ALPHA:
+			{
+				return swar_in_range(x | (swar_ones * 0x20), 'a', 'z');
+			}
+			case CharacterCategory::DIGIT:
+			{
+				return swar_in_range(x, '0', '9');
+			}
+			case CharacterCategory::ALPHA_DIGIT:
+			{
+				return swar_in_range(x | (swar_ones * 0x20), 'a', 'z') | swar_in_range(x, '0', '9');
+			}
+			default:
+			{
+				PROMETHEUS_COMPILER_UNREACHABLE();
+			}
+		}
+	}
+
+	// The high bits of the first `size` bytes (in memory order).
+	[[nodiscard]] constexpr auto swar_valid(const std::size_t size) noexcept -> std::uint64_t
+	{
+		if (size == sizeof(std::uint64_t))
+		{
+			return swar_high;
+		}
+
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			return swar_high >> (8 * (sizeof(std::uint64_t) - size));
+		}
+		else
+		{
+			return swar_high << (8 * (sizeof(std::uint64_t) - size));
+		}
+	}
+
+	[[nodiscard]] auto swar_is_all_of(const CharacterCategory category, const char* source, std::size_t size) noexcept -> bool
+	{
+		while (size != 0)
+		{
+			const auto n = std::ranges::min(size, sizeof(std::uint64_t));
+
+			// the remaining bytes are zero (ASCII)
+			std::uint64_t x = 0;
+			std::memcpy(&x, source, n);
+
+			if (x & swar_high)
+			{
+				if (not scalar_is_all_of(category, source, n))
+				{
+					return false;
+				}
+			}
+			else if (const auto valid = swar_valid(n); (swar_category(category, x) & valid) != valid)
+			{
+				return false;
+			}
+
+			source += n;
+			size -= n;
+		}
+
+		return true;
+	}
+
+	template<bool ToUpper>
+	auto swar_convert(const char* source, std::size_t size, char* dest) noexcept -> void
+	{
+		while (size != 0)
+		{
+			const auto n = std::ranges::min(size, sizeof(std::uint64_t));
+
+			std::uint64_t x = 0;
+			std::memcpy(&x, source, n);
+
+			if (x & swar_high)
+			{
+				scalar_convert<ToUpper>(source, n, dest);
+			}
+			else
+			{
+				const auto in = ToUpper ? swar_in_range(x, 'a', 'z') : swar_in_range(x, 'A', 'Z');
+				// 0x80 >> 2 => 0x20
+				x ^= in >> 2;
+
+				std::memcpy(dest, &x, n);
+			}
+
+			source += n;
+			dest += n;
+			size -= n;
+		}
+	}
+
+	constexpr kernel_type scalar_kernel{
+			.is_all_of = scalar_is_all_of,
+			.to_upper = scalar_convert<true>,
+			.to_lower = scalar_convert<false>
+	};
+
+	constexpr kernel_type swar_kernel{
+			.is_all_of = swar_is_all_of,
+			.to_upper = swar_convert<true>,
+			.to_lower = swar_convert<false>
+	};
+
+#if defined(PROMETHEUS_STRING_CHARCONV_X86)
+	// =========================================================
+	// SSE4.2
+	// =========================================================
+
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	[[nodiscard]] auto sse_in_range(const __m128i x, const char lo, const char hi) noexcept -> __m128i
+	{
+		// the non-ASCII characters are negative, so they are never in range
+		return _mm_and_si128(
+			_mm_cmpgt_epi8(x, _mm_set1_epi8(static_cast<char>(lo - 1))),
+			_mm_cmplt_epi8(x, _mm_set1_epi8(static_cast<char>(hi + 1)))
+		);
+	}
+
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	[[nodiscard]] auto sse_category(const CharacterCategory category, const __m128i x) noexcept -> __m128i
+	{
+		switch (category)
+		{
+			case CharacterCategory::UPPER:
+			{
+				return sse_in_range(x, 'A', 'Z');
+			}
+			case CharacterCategory::LOWER:
+			{
+				return sse_in_range(x, 'a', 'z');
+			}
+			case CharacterCategory::ALPHA:
+			{
+				return sse_in_range(_mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z');
+			}
+			case CharacterCategory::DIGIT:
+			{
+				return sse_in_range(x, '0', '9');
+			}
+			case CharacterCategory::ALPHA_DIGIT:
+			{
+				return _mm_or_si128(sse_in_range(_mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z'), sse_in_range(x, '0', '9'));
+			}
+			default:
+			{
+				PROMETHEUS_COMPILER_UNREACHABLE();
+			}
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	[[nodiscard]] auto sse_is_all_of(const CharacterCategory category, const char* source, std::size_t size) noexcept -> bool
+	{
+		constexpr std::size_t width = sizeof(__m128i);
+
+		for (; size >= width; source += width, size -= width)
+		{
+			const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+			if (_mm_movemask_epi8(x) != 0)
+			{
+				if (not scalar_is_all_of(category, source, width))
+				{
+					return false;
+				}
+			}
+			else if (_mm_movemask_epi8(sse_category(category, x)) != 0xffff)
+			{
+				return false;
+			}
+		}
+
+		return swar_is_all_of(category, source, size);
+	}
+
+	template<bool ToUpper>
+	PROMETHEUS_COMPILER_TARGET("sse4.2")
+	auto sse_convert(const char* source, std::size_t size, char* dest) noexcept -> void
+	{
+		constexpr std::size_t width = sizeof(__m128i);
+
+		for (; size >= width; source += width, dest += width, size -= width)
+		{
+			const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+			if (_mm_movemask_epi8(x) != 0)
+			{
+				scalar_convert<ToUpper>(source, width, dest);
+			}
+			else
+			{
+				const auto in = ToUpper ? sse_in_range(x, 'a', 'z') : sse_in_range(x, 'A', 'Z');
+				const auto y = _mm_xor_si128(x, _mm_and_si128(in, _mm_set1_epi8(0x20)));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest), y);
+			}
+		}
+
+		swar_convert<ToUpper>(source, size, dest);
+	}
+
+	constexpr kernel_type sse_kernel{
+			.is_all_of = sse_is_all_of,
+			.to_upper = sse_convert<true>,
+			.to_lower = sse_convert<false>
+	};
+
+	// =========================================================
+	// AVX2
+	// =========================================================
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	[[nodiscard]] auto avx2_in_range(const __m256i x, const char lo, const char hi) noexcept -> __m256i
+	{
+		// the non-ASCII characters are negative, so they are never in range
+		return _mm256_and_si256(
+			_mm256_cmpgt_epi8(x, _mm256_set1_epi8(static_cast<char>(lo - 1))),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), x)
+		);
+	}
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	[[nodiscard]] auto avx2_category(const CharacterCategory category, const __m256i x) noexcept -> __m256i
+	{
+		switch (category)
+		{
+			case CharacterCategory::UPPER:
+			{
+				return avx2_in_range(x, 'A', 'Z');
+			}
+			case CharacterCategory::LOWER:
+			{
+				return avx2_in_range(x, 'a', 'z');
+			}
+			case CharacterCategory::ALPHA:
+			{
+				return avx2_in_range(_mm256_or_si256(x, _mm256_set1_epi8(0x20)), 'a', 'z');
+			}
+			case CharacterCategory::DIGIT:
+			{
+				return avx2_in_range(x, '0', '9');
+			}
+			case CharacterCategory::ALPHA_DIGIT:
+			{
+				return _mm256_or_si256(avx2_in_range(_mm256_or_si256(x, _mm256_set1_epi8(0x20)), 'a', 'z'), avx2_in_range(x, '0', '9'));
+			}
+			default:
+			{
+				PROMETHEUS_COMPILER_UNREACHABLE();
+			}
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	[[nodiscard]] auto avx2_is_all_of(const CharacterCategory category, const char* source, std::size_t size) noexcept -> bool
+	{
+		constexpr std::size_t width = sizeof(__m256i);
+
+		for (; size >= width; source += width, size -= width)
+		{
+			const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+
+			if (_mm256_movemask_epi8(x) != 0)
+			{
+				if (not scalar_is_all_of(category, source, width))
+				{
+					return false;
+				}
+			}
+			else if (_mm256_movemask_epi8(avx2_category(category, x)) != -1)
+			{
+				return false;
+			}
+		}
+
+		return sse_is_all_of(category, source, size);
+	}
+
+	template<bool ToUpper>
+	PROMETHEUS_COMPILER_TARGET("avx2")
+	auto avx2_convert(const char* source, std::size_t size, char* dest) noexcept -> void
+	{
+		constexpr std::size_t width = sizeof(__m256i);
+
+		for (; size >= width; source += width, dest += width, size -= width)
+		{
+			const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+
+			if (_mm256_movemask_epi8(x) != 0)
+			{
+				scalar_convert<ToUpper>(source, width, dest);
+			}
+			else
+			{
+				const auto in = ToUpper ? avx2_in_range(x, 'a', 'z') : avx2_in_range(x, 'A', 'Z');
+				const auto y = _mm256_xor_si256(x, _mm256_and_si256(in, _mm256_set1_epi8(0x20)));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), y);
+			}
+		}
+
+		sse_convert<ToUpper>(source, size, dest);
+	}
+
+	constexpr kernel_type avx2_kernel{
+			.is_all_of = avx2_is_all_of,
+			.to_upper = avx2_convert<true>,
+			.to_lower = avx2_convert<false>
+	};
+
+	// =========================================================
+	// AVX-512BW
+	// =========================================================
+
+	PROMETHEUS_COMPILER_TARGET("avx512f,avx512bw")
+	[[nodiscard]] auto avx512_in_range(const __m512i x, const char lo, const char hi) noexcept -> __mmask64
+	{
+		// the non-ASCII characters are negative, so they are never in range
+		return _mm512_cmpge_epi8_mask(x, _mm512_set1_epi8(lo)) & _mm512_cmple_epi8_mask(x, _mm512_set1_epi8(hi));
+	}
+
+	PROMETHEUS_COMPILER_TARGET("avx512f,avx512bw")
+	[[nodiscard]] auto avx512_category(const CharacterCategory category, const __m512i x) noexcept -> __mmask64
+	{
+		switch (category)
+		{
+			case CharacterCategory::UPPER:
+			{
+				return avx512_in_range(x, 'A', 'Z');
+			}
+			case CharacterCategory::LOWER:
+			{
+				return avx512_in_range(x, 'a', 'z');
+			}
+			case CharacterCategory::ALPHA:
+			{
+				return avx512_in_range(_mm512_or_si512(x, _mm512_set1_epi8(0x20)), 'a', 'z');
+			}
+			case CharacterCategory::DIGIT:
+			{
+				return avx512_in_range(x, '0', '9');
+			}
+			case CharacterCategory::ALPHA_DIGIT:
+			{
+				return avx512_in_range(_mm512_or_si512(x, _mm512_set1_epi8(0x20)), 'a', 'z') | avx512_in_range(x, '0', '9');
+			}
+			default:
+			{
+				PROMETHEUS_COMPILER_UNREACHABLE();
+			}
+		}
+	}
+
+	PROMETHEUS_COMPILER_TARGET("avx512f,avx512bw")
+	[[nodiscard]] auto avx512_is_all_of(const CharacterCategory category, const char* source, std::size_t size) noexcept -> bool
+	{
+		constexpr std::size_t width = sizeof(__m512i);
+
+		while (size != 0)
+		{
+			const auto n = std::ranges::min(size, width);
+			// the tail is loaded with a mask, the masked-out bytes are zero (ASCII)
+			const auto valid = n == width ? ~__mmask64{0} : (__mmask64{1} << n) - 1;
+
+			const auto x = _mm512_maskz_loadu_epi8(valid, source);
+
+			if (_mm512_movepi8_mask(x) != 0)
+			{
+				if (not scalar_is_all_of(category, source, n))
+				{
+					return false;
+				}
+			}
+			else if ((avx512_category(category, x) & valid) != valid)
+			{
+				return false;
+			}
+
+			source += n;
+			size -= n;
+		}
+
+		return true;
+	}
+
+	template<bool ToUpper>
+	PROMETHEUS_COMPILER_TARGET("avx512f,avx512bw")
+	auto avx512_convert(const char* source, std::size_t size, char* dest) noexcept -> void
+	{
+		constexpr std::size_t width = sizeof(__m512i);
+
+		while (size != 0)
+		{
+			const auto n = std::ranges::min(size, width);
+			const auto valid = n == width ? ~__mmask64{0} : (__mmask64{1} << n) - 1;
+
+			const auto x = _mm512_maskz_loadu_epi8(valid, source);
+
+			if (_mm512_movepi8_mask(x) != 0)
+			{
+				scalar_convert<ToUpper>(source, n, dest);
+			}
+			else
+			{
+				const auto in = ToUpper ? avx512_in_range(x, 'a', 'z') : avx512_in_range(x, 'A', 'Z');
+				const auto y = _mm512_xor_si512(x, _mm512_maskz_mov_epi8(in, _mm512_set1_epi8(0x20)));
+
+				_mm512_mask_storeu_epi8(dest, valid, y);
+			}
+
+			source += n;
+			dest += n;
+			size -= n;
+		}
+	}
+
+	constexpr kernel_type avx512_kernel{
+			.is_all_of = avx512_is_all_of,
+			.to_upper = avx512_convert<true>,
+			.to_lower = avx512_convert<false>
+	};
+#endif
+
+	[[nodiscard]] auto select_kernel() noexcept -> const kernel_type&
+	{
+#if defined(PROMETHEUS_STRING_CHARCONV_X86)
+		using platform::InstructionSet;
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX512F | InstructionSet::AVX512BW))
+		{
+			return avx512_kernel;
+		}
+
+		if (platform::is_instruction_set_supported(InstructionSet::AVX2))
+		{
+			return avx2_kernel;
+		}
+
+		if (platform::is_instruction_set_supported(InstructionSet::SSE42))
+		{
+			return sse_kernel;
+		}
+#endif
+
+		return swar_kernel;
+	}
+
+	[[nodiscard]] auto kernel() noexcept -> const kernel_type&
+	{
+		static const auto& k = select_kernel();
+		return k;
+	}
+
+	[[nodiscard]] auto kernel_of(const string::charconv_detail::Kernel kernel) noexcept -> const kernel_type&
+	{
+		using string::charconv_detail::Kernel;
+
+		switch (kernel)
+		{
+			case Kernel::SCALAR:
+			{
+				return scalar_kernel;
+			}
+#if defined(PROMETHEUS_STRING_CHARCONV_X86)
+			case Kernel::SSE42:
+			{
+				return sse_kernel;
+			}
+			case Kernel::AVX2:
+			{
+				return avx2_kernel;
+			}
+			case Kernel::AVX512BW:
+			{
+				return avx512_kernel;
+			}
+#endif
+			default:
+			{
+				return swar_kernel;
+			}
+		}
+	}
+}
+
+namespace
+{
+	using namespace prometheus;
+
+	// =========================================================
+	// FLOATING POINT
+	// =========================================================
+
+	struct uint128_type
+	{
+		std::uint64_t low;
+		std::uint64_t high;
+	};
+
+	[[nodiscard]] auto multiply(const std::uint64_t a, const std::uint64_t b) noexcept -> uint128_type
+	{
+#if defined(__SIZEOF_INT128__)
+		__extension__ using uint128_t = unsigned __int128;
+
+		const auto result = static_cast<uint128_t>(a) * b;
+		return {.low = static_cast<std::uint64_t>(result), .high = static_cast<std::uint64_t>(result >> 64)};
+#elif defined(PROMETHEUS_COMPILER_MSVC) and defined(PROMETHEUS_ARCH_X64)
+		std::uint64_t high;
+		const auto low = _umul128(a, b, &high);
+		return {.low = low, .high = high};
+#else
+		const auto a_low = a & 0xffff'ffff;
+		const auto a_high = a >> 32;
+		const auto b_low = b & 0xffff'ffff;
+		const auto b_high = b >> 32;
+
+		const auto ll = a_low * b_low;
+		const auto lh = a_low * b_high;
+		const auto hl = a_high * b_low;
+		const auto hh = a_high * b_high;
+
+		const auto middle = (ll >> 32) + (lh & 0xffff'ffff) + (hl & 0xffff'ffff);
+		return {.low = (middle << 32) | (ll & 0xffff'ffff), .high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32)};
+#endif
+	}
+
+	[[nodiscard]] auto multiply_high(const std::uint64_t a, const std::uint64_t b) noexcept -> std::uint64_t
+	{
+		return multiply(a, b).high;
+	}
+
+	template<typename T>
+	struct binary_format;
+
+	template<>
+	struct binary_format<float>
+	{
+		using bits_type = std::uint32_t;
+
+		constexpr static int mantissa_explicit_bits = 23;
+		constexpr static int minimum_exponent = -127;
+		constexpr static int infinite_power = 0xff;
+
+		// Eisel-Lemire
+		constexpr static int smallest_power_of_ten = -65;
+		constexpr static int largest_power_of_ten = 38;
+		constexpr static int min_exponent_round_to_even = -17;
+		constexpr static int max_exponent_round_to_even = 10;
+
+		// Clinger
+		constexpr static int max_exponent_fast_path = 10;
+		constexpr static std::uint64_t max_mantissa_fast_path = std::uint64_t{2} << mantissa_explicit_bits;
+		constexpr static std::array<float, 11> power_of_10{1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+		// Schubfach
+		constexpr static int q_min = -149;
+		constexpr static bits_type c_min = bits_type{1} << mantissa_explicit_bits;
+	};
+
+	template<>
+	struct binary_format<double>
+	{
+		using bits_type = std::uint64_t;
+
+		constexpr static int mantissa_explicit_bits = 52;
+		constexpr static int minimum_exponent = -1023;
+		constexpr static int infinite_power = 0x7ff;
+
+		// Eisel-Lemire
+		constexpr static int smallest_power_of_ten = -342;
+		constexpr static int largest_power_of_ten = 308;
+		constexpr static int min_exponent_round_to_even = -4;
+		constexpr static int max_exponent_round_to_even = 23;
+
+		// Clinger
+		constexpr static int max_exponent_fast_path = 22;
+		constexpr static std::uint64_t max_mantissa_fast_path = std::uint64_t{2} << mantissa_explicit_bits;
+		constexpr static std::array<double, 23> power_of_10{
+				1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+				1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		// Schubfach
+		constexpr static int q_min = -1074;
+		constexpr static bits_type c_min = bits_type{1} << mantissa_explicit_bits;
+	};
+
+	// =========================================================
+	// FLOATING POINT (PARSE)
+	// =========================================================
+
+	// The 128 most significant bits of 5^q (q in [-342, 308]), rounded up if q < 0 and truncated otherwise.
+	// see https://arxiv.org/abs/2101.11408
+	extern const uint128_type power_of_5_128[651];
+
+	// `mantissa * 10^exponent`
+	struct decimal_type
+	{
+		std::uint64_t mantissa;
+		std::int64_t exponent;
+		bool negative;
+		// more than 19 significant digits, `mantissa` is the first 19 digits
+		bool truncated;
+	};
+
+	[[nodiscard]] constexpr auto is_digit(const char c) noexcept -> bool
+	{
+		return static_cast<unsigned char>(c - '0') < 10;
+	}
+
+	// `mantissa = mantissa * 10^n + digits`, `it` is moved past the digits
+	auto parse_digits(const char*& it, const char* end, std::uint64_t& mantissa) noexcept -> void
+	{
+		using namespace string::charconv_detail;
+
+		while (end - it >= 8)
+		{
+			const auto chunk = load_8_characters(it, end);
+
+			// all of them are in ['0', '9']
+			if (((chunk & 0xf0f0'f0f0'f0f0'f0f0) | (((chunk + 0x0606'0606'0606'0606) & 0xf0f0'f0f0'f0f0'f0f0) >> 4)) != 0x3333'3333'3333'3333)
+			{
+				break;
+			}
+
+			mantissa = mantissa * 100'000'000 + parse_8_digits(chunk, 8);
+			it += 8;
+		}
+
+		while (it != end and is_digit(*it))
+		{
+			mantissa = mantissa * 10 + static_cast<std::uint64_t>(*it - '0');
+			it += 1;
+		}
+	}
+
+	// `[-]digits[.digits][(e|E)[+|-]digits]` (at least one digit in the significand), returns nullptr if it does not match
+	[[nodiscard]] auto parse_decimal(const char* begin, const char* end, decimal_type& decimal) noexcept -> const char*
+	{
+		auto it = begin;
+
+		decimal.negative = it != end and *it == '-';
+		it += decimal.negative;
+
+		const auto digits_begin = it;
+
+		// the value is wrong if there are more than 19 digits, it is recalculated below
+		std::uint64_t mantissa = 0;
+		parse_digits(it, end, mantissa);
+		const auto integer_end = it;
+		auto digit_count = integer_end - digits_begin;
+
+		std::int64_t exponent = 0;
+		const char* fraction_begin = it;
+		const char* fraction_end = it;
+		if (it != end and *it == '.')
+		{
+			it += 1;
+			fraction_begin = it;
+			parse_digits(it, end, mantissa);
+			fraction_end = it;
+			exponent = fraction_begin - fraction_end;
+			digit_count -= exponent;
+		}
+
+		if (digit_count == 0)
+		{
+			return nullptr;
+		}
+
+		std::int64_t explicit_exponent = 0;
+		if (it != end and (*it == 'e' or *it == 'E'))
+		{
+			// `1e` / `1e+` => `1`
+			auto p = it + 1;
+
+			const auto negative = p != end and *p == '-';
+			if (p != end and (*p == '-' or *p == '+'))
+			{
+				p += 1;
+			}
+
+			if (p != end and is_digit(*p))
+			{
+				while (p != end and is_digit(*p))
+				{
+					// large enough to overflow/underflow any floating point type
+					if (explicit_exponent < 0x1000'0000)
+					{
+						explicit_exponent = explicit_exponent * 10 + (*p - '0');
+					}
+					p += 1;
+				}
+
+				if (negative)
+				{
+					explicit_exponent = -explicit_exponent;
+				}
+				it = p;
+			}
+		}
+		exponent += explicit_exponent;
+
+		decimal.truncated = false;
+		if (digit_count > 19)
+		{
+			// the leading zeros are not significant
+			for (auto p = digits_begin; p != it and (*p == '0' or *p == '.'); ++p)
+			{
+				digit_count -= *p == '0';
+			}
+
+			if (digit_count > 19)
+			{
+				constexpr std::uint64_t min_19_digits = 1'000'000'000'000'000'000;
+
+				decimal.truncated = true;
+
+				mantissa = 0;
+				auto p = digits_begin;
+				while (mantissa < min_19_digits and p != integer_end)
+				{
+					mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+					p += 1;
+				}
+
+				if (mantissa >= min_19_digits)
+				{
+					exponent = (integer_end - p) + explicit_exponent;
+				}
+				else
+				{
+					p = fraction_begin;
+					while (mantissa < min_19_digits and p != fraction_end)
+					{
+						mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+						p += 1;
+					}
+					exponent = (fraction_begin - p) + explicit_exponent;
+				}
+			}
+		}
+
+		decimal.mantissa = mantissa;
+		decimal.exponent = exponent;
+		return it;
+	}
+
+	// `inf`, `infinity`, `nan`, `nan(n-char-sequence)` (case insensitive)
+	template<std::floating_point T>
+	[[nodiscard]] auto parse_infinity_or_nan(const char* begin, const char* end, T& value) noexcept -> std::from_chars_result
+	{
+		const auto starts_with = [end](const char* it, const std::string_view lower) noexcept -> bool
+		{
+			if (static_cast<std::size_t>(end - it) < lower.size())
+			{
+				return false;
+			}
+
+			return std::ranges::equal(
+				lower,
+				std::basic_string_view{it, lower.size()},
+				[](const char l, const char c) noexcept -> bool { return l == (c | 0x20); }
+			);
+		};
+
+		auto it = begin;
+
+		const auto negative = it != end and *it == '-';
+		it += negative;
+
+		if (starts_with(it, "inf"))
+		{
+			it += starts_with(it, "infinity") ? 8 : 3;
+			value = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+			return {.ptr = it, .ec = {}};
+		}
+
+		if (starts_with(it, "nan"))
+		{
+			it += 3;
+			if (it != end and *it == '(')
+			{
+				auto p = it + 1;
+				while (p != end and (is_digit(*p) or ((*p | 0x20) >= 'a' and (*p | 0x20) <= 'z') or *p == '_'))
+				{
+					p += 1;
+				}
+
+				if (p != end and *p == ')')
+				{
+					it = p + 1;
+				}
+			}
+
+			value = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+			return {.ptr = it, .ec = {}};
+		}
+
+		return {.ptr = begin, .ec = std::errc::invalid_argument};
+	}
+
+	// `mantissa * 2^power2` (`power2` is biased, `mantissa` does not contain the implicit bit), `power2 == -1` if the result is unknown
+	struct adjusted_mantissa_type
+	{
+		std::uint64_t mantissa;
+		int power2;
+
+		[[nodiscard]] constexpr auto operator==(const adjusted_mantissa_type&) const noexcept -> bool = default;
+	};
+
+	// Eisel-Lemire, `w * 10^q` rounded to nearest (ties to even)
+	// see https://arxiv.org/abs/2101.11408 and https://arxiv.org/abs/2212.06644 (no fallback is needed if `w` is exact)
+	template<std::floating_point T>
+	[[nodiscard]] auto compute_float(const std::int64_t q, std::uint64_t w) noexcept -> adjusted_mantissa_type
+	{
+		using format = binary_format<T>;
+
+		if (w == 0 or q < format::smallest_power_of_ten)
+		{
+			return {.mantissa = 0, .power2 = 0};
+		}
+
+		if (q > format::largest_power_of_ten)
+		{
+			return {.mantissa = 0, .power2 = format::infinite_power};
+		}
+
+		const auto leading_zeros = std::countl_zero(w);
+		w <<= leading_zeros;
+
+		// we only need `mantissa_explicit_bits + 3` bits of the product, the second product is only needed when they are all ones
+		const auto& power = power_of_5_128[static_cast<std::size_t>(q - binary_format<double>::smallest_power_of_ten)];
+		auto product = multiply(w, power.high);
+
+		constexpr auto precision_mask = ~std::uint64_t{0} >> (format::mantissa_explicit_bits + 3);
+		if ((product.high & precision_mask) == precision_mask)
+		{
+			const auto second = multiply(w, power.low);
+
+			product.low += second.high;
+			product.high += second.high > product.low;
+		}
+
+		const auto upper_bit = static_cast<int>(product.high >> 63);
+		const auto shift = upper_bit + 64 - format::mantissa_explicit_bits - 3;
+
+		adjusted_mantissa_type result{
+				.mantissa = product.high >> shift,
+				// floor(log2(10^q)) + 63
+				.power2 = static_cast<int>((((152'170 + 65'536) * q) >> 16) + 63) + upper_bit - leading_zeros - format::minimum_exponent
+		};
+
+		// subnormal
+		if (result.power2 <= 0)
+		{
+			if (-result.power2 + 1 >= 64)
+			{
+				return {.mantissa = 0, .power2 = 0};
+			}
+
+			result.mantissa >>= -result.power2 + 1;
+			result.mantissa += result.mantissa & 1;
+			result.mantissa >>= 1;
+
+			// rounded up to the smallest normal
+			result.power2 = result.mantissa < (std::uint64_t{1} << format::mantissa_explicit_bits) ? 0 : 1;
+			return result;
+		}
+
+		// exactly halfway between two floating point values => round to even (the product is exact for these q)
+		if (
+			product.low <= 1 and
+			q >= format::min_exponent_round_to_even and q <= format::max_exponent_round_to_even and
+			(result.mantissa & 3) == 1 and
+			(result.mantissa << shift) == product.high
+		)
+		{
+			result.mantissa &= ~std::uint64_t{1};
+		}
+
+		result.mantissa += result.mantissa & 1;
+		result.mantissa >>= 1;
+
+		if (result.mantissa >= (std::uint64_t{2} << format::mantissa_explicit_bits))
+		{
+			result.mantissa = std::uint64_t{1} << format::mantissa_explicit_bits;
+			result.power2 += 1;
+		}
+
+		result.mantissa &= ~(std::uint64_t{1} << format::mantissa_explicit_bits);
+		if (result.power2 >= format::infinite_power)
+		{
+			return {.mantissa = 0, .power2 = format::infinite_power};
+		}
+
+		return result;
+	}
+
+	template<std::floating_point T>
+	[[nodiscard]] auto parse_floating_point(const char* begin, const char* end, T& value) noexcept -> std::from_chars_result
+	{
+		using format = binary_format<T>;
+		using bits_type = typename format::bits_type;
+
+		decimal_type decimal;
+		const auto last = parse_decimal(begin, end, decimal);
+		if (last == nullptr)
+		{
+			return parse_infinity_or_nan(begin, end, value);
+		}
+
+		// Clinger, both `mantissa` and `10^exponent` are exact, so is the (correctly rounded) result
+		// note: this assumes the default (round to nearest) floating point environment
+		if (
+			not decimal.truncated and
+			decimal.mantissa <= format::max_mantissa_fast_path and
+			decimal.exponent >= -format::max_exponent_fast_path and decimal.exponent <= format::max_exponent_fast_path
+		)
+		{
+			auto result = static_cast<T>(decimal.mantissa);
+			if (decimal.exponent < 0)
+			{
+				result /= format::power_of_10[static_cast<std::size_t>(-decimal.exponent)];
+			}
+			else
+			{
+				result *= format::power_of_10[static_cast<std::size_t>(decimal.exponent)];
+			}
+
+			value = decimal.negative ? -result : result;
+			return {.ptr = last, .ec = {}};
+		}
+
+		auto adjusted = compute_float<T>(decimal.exponent, decimal.mantissa);
+		if (decimal.truncated and adjusted != compute_float<T>(decimal.exponent, decimal.mantissa + 1))
+		{
+			// the digits after the 19th significant digit decide the rounding (rare), let the standard library do the exact work
+			return std::from_chars(begin, end, value);
+		}
+
+		if (adjusted.power2 == format::infinite_power or (adjusted.power2 == 0 and adjusted.mantissa == 0 and decimal.mantissa != 0))
+		{
+			return {.ptr = last, .ec = std::errc::result_out_of_range};
+		}
+
+		const auto bits =
+				static_cast<bits_type>(adjusted.mantissa) |
+				(static_cast<bits_type>(adjusted.power2) << format::mantissa_explicit_bits) |
+				(static_cast<bits_type>(decimal.negative) << (sizeof(bits_type) * 8 - 1));
+
+		value = std::bit_cast<T>(bits);
+		return {.ptr = last, .ec = {}};
+	}
+
+	// =========================================================
+	// FLOATING POINT (FORMAT)
+	// =========================================================
+
+	// g = floor(β) + 1, 10^-k = β * 2^r, 2^125 <= β < 2^126 (k in [-324, 292]), {.low = g mod 2^63, .high = floor(g / 2^63)}
+	// see https://github.com/c4f7fcce9cb06515/Schubfach
+	extern const uint128_type schubfach_g[617];
+
+	constexpr int schubfach_k_min = -324;
+
+	// floor(q * log10(2))
+	[[nodiscard]] constexpr auto floor_log10_pow2(const int q) noexcept -> int
+	{
+		return static_cast<int>((q * std::int64_t{661'971'961'083}) >> 41);
+	}
+
+	// floor(q * log10(2) + log10(3/4))
+	[[nodiscard]] constexpr auto floor_log10_three_quarters_pow2(const int q) noexcept -> int
+	{
+		return static_cast<int>((q * std::int64_t{661'971'961'083} - 274'743'187'321) >> 41);
+	}
+
+	// floor(e * log2(10))
+	[[nodiscard]] constexpr auto floor_log2_pow10(const int e) noexcept -> int
+	{
+		return static_cast<int>((e * std::int64_t{913'124'641'741}) >> 38);
+	}
+
+	// round to odd of `g * cp`
+	[[nodiscard]] auto round_to_odd(const uint128_type g, const std::uint64_t cp) noexcept -> std::uint64_t
+	{
+		constexpr auto mask_63 = (std::uint64_t{1} << 63) - 1;
+
+		const auto x1 = multiply_high(g.low, cp);
+		const auto y0 = g.high * cp;
+		const auto y1 = multiply_high(g.high, cp);
+
+		const auto z = (y0 >> 1) + x1;
+		const auto vbp = y1 + (z >> 63);
+
+		return vbp | (((z & mask_63) + mask_63) >> 63);
+	}
+
+	[[nodiscard]] auto round_to_odd(const std::uint64_t g, const std::uint64_t cp) noexcept -> std::uint32_t
+	{
+		constexpr auto mask_32 = (std::uint64_t{1} << 32) - 1;
+
+		const auto x1 = multiply_high(g, cp);
+		const auto vbp = x1 >> 31;
+
+		return static_cast<std::uint32_t>(vbp | (((x1 & mask_32) + mask_32) >> 32));
+	}
+
+	// `significand * 10^exponent`
+	struct shortest_decimal_type
+	{
+		std::uint64_t significand;
+		int exponent;
+	};
+
+	// Schubfach, the shortest decimal in the rounding interval of `c * 2^q` (the closest one if there are several, ties to even)
+	template<std::floating_point T>
+	[[nodiscard]] auto to_decimal(const int q, const typename binary_format<T>::bits_type c) noexcept -> shortest_decimal_type
+	{
+		using format = binary_format<T>;
+		using bits_type = typename format::bits_type;
+
+		const auto out = static_cast<bits_type>(c & 1);
+		const auto cb = static_cast<std::uint64_t>(c) << 2;
+		const auto cbr = cb + 2;
+
+		std::uint64_t cbl;
+		int k;
+		if (c != format::c_min or q == format::q_min)
+		{
+			cbl = cb - 2;
+			k = floor_log10_pow2(q);
+		}
+		else
+		{
+			// the lower boundary is closer
+			cbl = cb - 1;
+			k = floor_log10_three_quarters_pow2(q);
+		}
+
+		const auto& g = schubfach_g[k - schubfach_k_min];
+
+		bits_type vb;
+		bits_type vbl;
+		bits_type vbr;
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const auto h = q + floor_log2_pow10(-k) + 2;
+
+			vb = round_to_odd(g, cb << h);
+			vbl = round_to_odd(g, cbl << h);
+			vbr = round_to_odd(g, cbr << h);
+		}
+		else
+		{
+			const auto h = q + floor_log2_pow10(-k) + 33;
+
+			vb = round_to_odd(g.high + 1, cb << h);
+			vbl = round_to_odd(g.high + 1, cbl << h);
+			vbr = round_to_odd(g.high + 1, cbr << h);
+		}
+
+		const bits_type s = vb >> 2;
+
+		// one digit less (Java requires at least 2 digits, `std::to_chars` does not)
+		if (s >= 10)
+		{
+			const bits_type sp10 = 10 * (s / 10);
+			const bits_type tp10 = sp10 + 10;
+
+			const auto upin = vbl + out <= sp10 << 2;
+			const auto wpin = (tp10 << 2) + out <= vbr;
+			if (upin != wpin)
+			{
+				return {.significand = upin ? sp10 : tp10, .exponent = k};
+			}
+		}
+
+		const bits_type t = s + 1;
+
+		const auto uin = vbl + out <= s << 2;
+		const auto win = (t << 2) + out <= vbr;
+		if (uin != win)
+		{
+			return {.significand = uin ? s : t, .exponent = k};
+		}
+
+		// both are in the interval, the closest one
+		const auto cmp = static_cast<std::make_signed_t<bits_type>>(vb - ((s + t) << 1));
+		return {.significand = cmp < 0 or (cmp == 0 and (s & 1) == 0) ? s : t, .exponent = k};
+	}
+
+	template<std::floating_point T>
+	[[nodiscard]] auto to_shortest_decimal(const typename binary_format<T>::bits_type bits) noexcept -> shortest_decimal_type
+	{
+		using format = binary_format<T>;
+		using bits_type = typename format::bits_type;
+
+		constexpr auto mantissa_mask = format::c_min - 1;
+		constexpr auto precision = format::mantissa_explicit_bits + 1;
+
+		const auto t = bits & mantissa_mask;
+		const auto bq = static_cast<int>(bits >> format::mantissa_explicit_bits) & format::infinite_power;
+
+		if (bq != 0)
+		{
+			const auto mq = -format::q_min + 1 - bq;
+			const auto c = format::c_min | t;
+
+			// an integer
+			if (mq > 0 and mq < precision)
+			{
+				if (const bits_type f = c >> mq; f << mq == c)
+				{
+					return {.significand = f, .exponent = 0};
+				}
+			}
+
+			return to_decimal<T>(-mq, c);
+		}
+
+		// subnormal (not zero)
+		return to_decimal<T>(format::q_min, t);
+	}
+
+	constexpr char digit_pairs[] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+	constexpr auto power_of_10_64 = []() noexcept -> std::array<std::uint64_t, 20>
+	{
+		std::array<std::uint64_t, 20> result{};
+
+		std::uint64_t value = 1;
+		for (auto& power: result)
+		{
+			power = value;
+			value *= 10;
+		}
+
+		return result;
+	}();
+
+	[[nodiscard]] constexpr auto count_digits(const std::uint64_t value) noexcept -> int
+	{
+		// floor(log10(2^bit_width)), it is either the number of digits or one less
+		const auto guess = static_cast<int>((std::bit_width(value | 1) * 1233) >> 12);
+		return guess + (value >= power_of_10_64[static_cast<std::size_t>(guess)]);
+	}
+
+	// writes the `count` digits of `value` to `[dest, dest + count)`
+	auto write_digits(char* dest, const int count, std::uint64_t value) noexcept -> void
+	{
+		auto it = dest + count;
+
+		// 8 digits at a time, the divisions of each 8 digits are done in 32 bits
+		while (value >= 100'000'000)
+		{
+			auto low = static_cast<std::uint32_t>(value % 100'000'000);
+			value /= 100'000'000;
+
+			for (int i = 0; i < 4; ++i)
+			{
+				it -= 2;
+				std::memcpy(it, digit_pairs + low % 100 * 2, 2);
+				low /= 100;
+			}
+		}
+
+		auto high = static_cast<std::uint32_t>(value);
+		while (high >= 100)
+		{
+			it -= 2;
+			std::memcpy(it, digit_pairs + high % 100 * 2, 2);
+			high /= 100;
+		}
+
+		if (high >= 10)
+		{
+			it -= 2;
+			std::memcpy(it, digit_pairs + high * 2, 2);
+		}
+		else
+		{
+			it -= 1;
+			*it = static_cast<char>('0' + high);
+		}
+	}
+
+	// `significand * 2^exponent`
+	struct binary_type
+	{
+		std::uint64_t significand;
+		int exponent;
+	};
+
+	// the exact digits of `significand * 2^exponent` (an integer less than 2^128), returns the end of the digits
+	auto write_integer(char* dest, const binary_type binary) noexcept -> char*
+	{
+		constexpr std::uint64_t chunk_base = 1'000'000'000;
+		constexpr int chunk_digits = 9;
+
+		uint128_type value{};
+		if (binary.exponent <= 0)
+		{
+			value.low = binary.significand >> -binary.exponent;
+		}
+		else
+		{
+			value.low = binary.significand << binary.exponent;
+			value.high = binary.significand >> (64 - binary.exponent);
+		}
+
+		// most significant first
+		std::uint32_t limbs[4]{
+				static_cast<std::uint32_t>(value.high >> 32),
+				static_cast<std::uint32_t>(value.high),
+				static_cast<std::uint32_t>(value.low >> 32),
+				static_cast<std::uint32_t>(value.low)
+		};
+
+		// least significant first
+		std::uint64_t chunks[5];
+		int chunk_count = 0;
+		for (bool zero = false; not zero; chunk_count += 1)
+		{
+			std::uint64_t remainder = 0;
+
+			zero = true;
+			for (auto& limb: limbs)
+			{
+				const auto current = (remainder << 32) | limb;
+				limb = static_cast<std::uint32_t>(current / chunk_base);
+				remainder = current % chunk_base;
+
+				zero &= limb == 0;
+			}
+
+			chunks[chunk_count] = remainder;
+		}
+
+		auto it = dest;
+		for (auto i = chunk_count - 1; i >= 0; --i)
+		{
+			const auto digits = count_digits(chunks[i]);
+			if (i != chunk_count - 1)
+			{
+				std::memset(it, '0', chunk_digits - digits);
+				it += chunk_digits - digits;
+			}
+
+			write_digits(it, digits, chunks[i]);
+			it += digits;
+		}
+
+		return it;
+	}
+
+	// `significand * 10^exponent`, fixed or scientific notation, whichever is shorter (fixed if they are the same length), as `std::to_chars(begin, end, value)` does
+	// `binary` is the exact value, the fixed notation of an integer prints all its digits instead of padding `significand` with zeros
+	[[nodiscard]] auto write_decimal(char* begin, char* end, const bool negative, const binary_type binary, shortest_decimal_type decimal) noexcept -> std::to_chars_result
+	{
+		// remove the trailing zeros, there are at most 7 after the first step
+		while (decimal.significand % 100'000'000 == 0)
+		{
+			decimal.significand /= 100'000'000;
+			decimal.exponent += 8;
+		}
+		for (const auto n: {4, 2, 1})
+		{
+			if (const auto power = power_of_10_64[static_cast<std::size_t>(n)]; decimal.significand % power == 0)
+			{
+				decimal.significand /= power;
+				decimal.exponent += n;
+			}
+		}
+
+		const auto digits = count_digits(decimal.significand);
+		const auto exponent = decimal.exponent;
+		const auto scientific_exponent = exponent + digits - 1;
+
+		const auto scientific_length =
+				// d[.ddd]
+				digits + (digits > 1) +
+				// e+dd[d]
+				2 + (scientific_exponent >= 100 or scientific_exponent <= -100 ? 3 : 2);
+		const auto fixed_length =
+				exponent >= 0
+					// ddd000
+					? digits + exponent
+					: scientific_exponent >= 0
+					// dd.ddd
+					? digits + 1
+					// 0.000ddd
+					: 2 - exponent;
+
+		const auto length = static_cast<std::ptrdiff_t>(negative) + std::ranges::min(fixed_length, scientific_length);
+		if (end - begin < length)
+		{
+			return {.ptr = end, .ec = std::errc::value_too_large};
+		}
+
+		auto it = begin;
+		if (negative)
+		{
+			*it = '-';
+			it += 1;
+		}
+
+		if (fixed_length <= scientific_length)
+		{
+			if (exponent > 0)
+			{
+				it = write_integer(it, binary);
+			}
+			else if (exponent == 0)
+			{
+				write_digits(it, digits, decimal.significand);
+				it += digits;
+			}
+			else if (scientific_exponent >= 0)
+			{
+				// the integer part, then move it one character forward and insert the point
+				write_digits(it + 1, digits, decimal.significand);
+				std::memmove(it, it + 1, static_cast<std::size_t>(scientific_exponent + 1));
+				it[scientific_exponent + 1] = '.';
+				it += digits + 1;
+			}
+			else
+			{
+				const auto zeros = -scientific_exponent - 1;
+
+				it[0] = '0';
+				it[1] = '.';
+				std::memset(it + 2, '0', static_cast<std::size_t>(zeros));
+				it += 2 + zeros;
+
+				write_digits(it, digits, decimal.significand);
+				it += digits;
+			}
+		}
+		else
+		{
+			// d.ddd
+			write_digits(it + 1, digits, decimal.significand);
+			it[0] = it[1];
+			if (digits > 1)
+			{
+				it[1] = '.';
+				it += digits + 1;
+			}
+			else
+			{
+				it += 1;
+			}
+
+			it[0] = 'e';
+			it[1] = scientific_exponent < 0 ? '-' : '+';
+			it += 2;
+
+			// at least 2 digits
+			const auto e = static_cast<std::size_t>(scientific_exponent < 0 ? -scientific_exponent : scientific_exponent);
+			if (e >= 100)
+			{
+				*it = static_cast<char>('0' + e / 100);
+				it += 1;
+			}
+			std::memcpy(it, digit_pairs + e % 100 * 2, 2);
+			it += 2;
+		}
+
+		return {.ptr = it, .ec = {}};
+	}
+
+	template<std::floating_point T>
+	[[nodiscard]] auto format_floating_point(char* begin, char* end, const T value) noexcept -> std::to_chars_result
+	{
+		using format = binary_format<T>;
+		using bits_type = typename format::bits_type;
+
+		const auto bits = std::bit_cast<bits_type>(value);
+		const auto negative = (bits >> (sizeof(bits_type) * 8 - 1)) != 0;
+		const auto magnitude = bits & ~(bits_type{1} << (sizeof(bits_type) * 8 - 1));
+
+		const auto write = [&](const std::string_view string) noexcept -> std::to_chars_result
+		{
+			const auto length = static_cast<std::ptrdiff_t>(negative) + static_cast<std::ptrdiff_t>(string.size());
+			if (end - begin < length)
+			{
+				return {.ptr = end, .ec = std::errc::value_too_large};
+			}
+
+			auto it = begin;
+			if (negative)
+			{
+				*it = '-';
+				it += 1;
+			}
+			std::ranges::copy(string, it);
+			return {.ptr = it + string.size(), .ec = {}};
+		};
+
+		if (magnitude == 0)
+		{
+			return write("0");
+		}
+
+		if ((magnitude >> format::mantissa_explicit_bits) == format::infinite_power)
+		{
+			return write((magnitude & (format::c_min - 1)) == 0 ? "inf" : "nan");
+		}
+
+		const auto biased_exponent = static_cast<int>(magnitude >> format::mantissa_explicit_bits);
+		const auto mantissa = magnitude & (format::c_min - 1);
+		const binary_type binary{
+				.significand = biased_exponent == 0 ? mantissa : format::c_min | mantissa,
+				.exponent = (biased_exponent == 0 ? 1 : biased_exponent) + format::q_min - 1
+		};
+
+		return write_decimal(begin, end, negative, binary, to_shortest_decimal<T>(magnitude));
+	}
+}
+
+namespace prometheus::string::charconv_detail
+{
+	auto is_all_of(const CharacterCategory category, const std::basic_string_view<char> string) noexcept -> bool
+	{
+		return kernel().is_all_of(category, string.data(), string.size());
+	}
+
+	auto to_upper(const std::basic_string_view<char> string, char* dest) noexcept -> void
+	{
+		kernel().to_upper(string.data(), string.size(), dest);
+	}
+
+	auto to_lower(const std::basic_string_view<char> string, char* dest) noexcept -> void
+	{
+		kernel().to_lower(string.data(), string.size(), dest);
+	}
+
+	auto is_all_of(const Kernel kernel, const CharacterCategory category, const std::basic_string_view<char> string) noexcept -> bool
+	{
+		return kernel_of(kernel).is_all_of(category, string.data(), string.size());
+	}
+
+	auto to_upper(const Kernel kernel, const std::basic_string_view<char> string, char* dest) noexcept -> void
+	{
+		kernel_of(kernel).to_upper(string.data(), string.size(), dest);
+	}
+
+	auto to_lower(const Kernel kernel, const std::basic_string_view<char> string, char* dest) noexcept -> void
+	{
+		kernel_of(kernel).to_lower(string.data(), string.size(), dest);
+	}
+
+	auto to_title(const std::basic_string_view<char> string, char* dest, bool first) noexcept -> bool
+	{
+		constexpr std::size_t chunk_size = 64;
+
+		const auto& k = kernel();
+
+		const auto* source = string.data();
+		const auto size = string.size();
+
+		// The whole chunk is converted to lower case by the kernel, and then the first character of each word
+		// (even if it is a space) is converted to upper case from the original character (`dest` may be `source`).
+		for (std::size_t offset = 0; offset < size; offset += chunk_size)
+		{
+			const auto n = std::ranges::min(chunk_size, size - offset);
+
+			char original[chunk_size];
+			std::memcpy(original, source + offset, n);
+
+			k.to_lower(original, n, dest + offset);
+
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				if (first)
+				{
+					const auto c = original[i];
+					dest[offset + i] = c >= 'a' and c <= 'z' ? static_cast<char>(c - 'a' + 'A') : prometheus::string::to_upper(c);
+					first = false;
+				}
+				else if (original[i] == ' ')
+				{
+					first = true;
+				}
+			}
+		}
+
+		return first;
+	}
+
+	auto from_chars(const char* begin, const char* end, float& value) noexcept -> std::from_chars_result
+	{
+		return parse_floating_point(begin, end, value);
+	}
+
+	auto from_chars(const char* begin, const char* end, double& value) noexcept -> std::from_chars_result
+	{
+		return parse_floating_point(begin, end, value);
+	}
+
+	auto to_chars(char* begin, char* end, const float value) noexcept -> std::to_chars_result
+	{
+		return format_floating_point(begin, end, value);
+	}
+
+	auto to_chars(char* begin, char* end, const double value) noexcept -> std::to_chars_result
+	{
+		return format_floating_point(begin, end, value);
+	}
+}
+
+namespace
+{
+	// =========================================================
+	// FLOATING POINT (TABLES)
+	// =========================================================
+
+	const uint128_type power_of_5_128[651]{
+			{.low = 0x113faa2906a13b3f, .high = 0xeef453d6923bd65a},
+			{.low = 0x4ac7ca59a424c507, .high = 0x9558b4661b6565f8},
+			{.low = 0x5d79bcf00d2df649, .high = 0xbaaee17fa23ebf76},
+			{.low = 0xf4d82c2c107973dc, .high = 0xe95a99df8ace6f53},
+			{.low = 0x79071b9b8a4be869, .high = 0x91d8a02bb6c10594},
+			{.low = 0x9748e2826cdee284, .high = 0xb64ec836a47146f9},
+			{.low = 0xfd1b1b2308169b25, .high = 0xe3e27a444d8d98b7},
+			{.low = 0xfe30f0f5e50e20f7, .high = 0x8e6d8c6ab0787f72},
+			{.low = 0xbdbd2d335e51a935, .high = 0xb208ef855c969f4f},
+			{.low = 0xad2c788035e61382, .high = 0xde8b2b66b3bc4723},
+			{.low = 0x4c3bcb5021afcc31, .high = 0x8b16fb203055ac76},
+			{.low = 0xdf4abe242a1bbf3d, .high = 0xaddcb9e83c6b1793},
+			{.low = 0xd71d6dad34a2af0d, .high = 0xd953e8624b85dd78},
+			{.low = 0x8672648c40e5ad68, .high = 0x87d4713d6f33aa6b},
+			{.low = 0x680efdaf511f18c2, .high = 0xa9c98d8ccb009506},
+			{.low = 0x0212bd1b2566def2, .high = 0xd43bf0effdc0ba48},
+			{.low = 0x014bb630f7604b57, .high = 0x84a57695fe98746d},
+			{.low = 0x419ea3bd35385e2d, .high = 0xa5ced43b7e3e9188},
+			{.low = 0x52064cac828675b9, .high = 0xcf42894a5dce35ea},
+			{.low = 0x7343efebd1940993, .high = 0x818995ce7aa0e1b2},
+			{.low = 0x1014ebe6c5f90bf8, .high = 0xa1ebfb4219491a1f},
+			{.low = 0xd41a26e077774ef6, .high = 0xca66fa129f9b60a6},
+			{.low = 0x8920b098955522b4, .high = 0xfd00b897478238d0},
+			{.low = 0x55b46e5f5d5535b0, .high = 0x9e20735e8cb16382},
+			{.low = 0xeb2189f734aa831d, .high = 0xc5a890362fddbc62},
+			{.low = 0xa5e9ec7501d523e4, .high = 0xf712b443bbd52b7b},
+			{.low = 0x47b233c92125366e, .high = 0x9a6bb0aa55653b2d},
+			{.low = 0x999ec0bb696e840a, .high = 0xc1069cd4eabe89f8},
+			{.low = 0xc00670ea43ca250d, .high = 0xf148440a256e2c76},
+			{.low = 0x380406926a5e5728, .high = 0x96cd2a865764dbca},
+			{.low = 0xc605083704f5ecf2, .high = 0xbc807527ed3e12bc},
+			{.low = 0xf7864a44c633682e, .high = 0xeba09271e88d976b},
+			{.low = 0x7ab3ee6afbe0211d, .high = 0x93445b8731587ea3},
+			{.low = 0x5960ea05bad82964, .high = 0xb8157268fdae9e4c},
+			{.low = 0x6fb92487298e33bd, .high = 0xe61acf033d1a45df},
+			{.low = 0xa5d3b6d479f8e056, .high = 0x8fd0c16206306bab},
+			{.low = 0x8f48a4899877186c, .high = 0xb3c4f1ba87bc8696},
+			{.low = 0x331acdabfe94de87, .high = 0xe0b62e2929aba83c},
+			{.low = 0x9ff0c08b7f1d0b14, .high = 0x8c71dcd9ba0b4925},
+			{.low = 0x07ecf0ae5ee44dd9, .high = 0xaf8e5410288e1b6f},
+			{.low = 0xc9e82cd9f69d6150, .high = 0xdb71e91432b1a24a},
+			{.low = 0xbe311c083a225cd2, .high = 0x892731ac9faf056e},
+			{.low = 0x6dbd630a48aaf406, .high = 0xab70fe17c79ac6ca},
+			{.low = 0x092cbbccdad5b108, .high = 0xd64d3d9db981787d},
+			{.low = 0x25bbf56008c58ea5, .high = 0x85f0468293f0eb4e},
+			{.low = 0xaf2af2b80af6f24e, .high = 0xa76c582338ed2621},
+			{.low = 0x1af5af660db4aee1, .high = 0xd1476e2c07286faa},
+			{.low = 0x50d98d9fc890ed4d, .high = 0x82cca4db847945ca},
+			{.low = 0xe50ff107bab528a0, .high = 0xa37fce126597973c},
+			{.low = 0x1e53ed49a96272c8, .high = 0xcc5fc196fefd7d0c},
+			{.low = 0x25e8e89c13bb0f7a, .high = 0xff77b1fcbebcdc4f},
+			{.low = 0x77b191618c54e9ac, .high = 0x9faacf3df73609b1},
+			{.low = 0xd59df5b9ef6a2417, .high = 0xc795830d75038c1d},
+			{.low = 0x4b0573286b44ad1d, .high = 0xf97ae3d0d2446f25},
+			{.low = 0x4ee367f9430aec32, .high = 0x9becce62836ac577},
+			{.low = 0x229c41f793cda73f, .high = 0xc2e801fb244576d5},
+			{.low = 0x6b43527578c1110f, .high = 0xf3a20279ed56d48a},
+			{.low = 0x830a13896b78aaa9, .high = 0x9845418c345644d6},
+			{.low = 0x23cc986bc656d553, .high = 0xbe5691ef416bd60c},
+			{.low = 0x2cbfbe86b7ec8aa8, .high = 0xedec366b11c6cb8f},
+			{.low = 0x7bf7d71432f3d6a9, .high = 0x94b3a202eb1c3f39},
+			{.low = 0xdaf5ccd93fb0cc53, .high = 0xb9e08a83a5e34f07},
+			{.low = 0xd1b3400f8f9cff68, .high = 0xe858ad248f5c22c9},
+			{.low = 0x23100809b9c21fa1, .high = 0x91376c36d99995be},
+			{.low = 0xabd40a0c2832a78a, .high = 0xb58547448ffffb2d},
+			{.low = 0x16c90c8f323f516c, .high = 0xe2e69915b3fff9f9},
+			{.low = 0xae3da7d97f6792e3, .high = 0x8dd01fad907ffc3b},
+			{.low = 0x99cd11cfdf41779c, .high = 0xb1442798f49ffb4a},
+			{.low = 0x40405643d711d583, .high = 0xdd95317f31c7fa1d},
+			{.low = 0x482835ea666b2572, .high = 0x8a7d3eef7f1cfc52},
+			{.low = 0xda3243650005eecf, .high = 0xad1c8eab5ee43b66},
+			{.low = 0x90bed43e40076a82, .high = 0xd863b256369d4a40},
+			{.low = 0x5a7744a6e804a291, .high = 0x873e4f75e2224e68},
+			{.low = 0x711515d0a205cb36, .high = 0xa90de3535aaae202},
+			{.low = 0x0d5a5b44ca873e03, .high = 0xd3515c2831559a83},
+			{.low = 0xe858790afe9486c2, .high = 0x8412d9991ed58091},
+			{.low = 0x626e974dbe39a872, .high = 0xa5178fff668ae0b6},
+			{.low = 0xfb0a3d212dc8128f, .high = 0xce5d73ff402d98e3},
+			{.low = 0x7ce66634bc9d0b99, .high = 0x80fa687f881c7f8e},
+			{.low = 0x1c1fffc1ebc44e80, .high = 0xa139029f6a239f72},
+			{.low = 0xa327ffb266b56220, .high = 0xc987434744ac874e},
+			{.low = 0x4bf1ff9f0062baa8, .high = 0xfbe9141915d7a922},
+			{.low = 0x6f773fc3603db4a9, .high = 0x9d71ac8fada6c9b5},
+			{.low = 0xcb550fb4384d21d3, .high = 0xc4ce17b399107c22},
+			{.low = 0x7e2a53a146606a48, .high = 0xf6019da07f549b2b},
+			{.low = 0x2eda7444cbfc426d, .high = 0x99c102844f94e0fb},
+			{.low = 0xfa911155fefb5308, .high = 0xc0314325637a1939},
+			{.low = 0x793555ab7eba27ca, .high = 0xf03d93eebc589f88},
+			{.low = 0x4bc1558b2f3458de, .high = 0x96267c7535b763b5},
+			{.low = 0x9eb1aaedfb016f16, .high = 0xbbb01b9283253ca2},
+			{.low = 0x465e15a979c1cadc, .high = 0xea9c227723ee8bcb},
+			{.low = 0x0bfacd89ec191ec9, .high = 0x92a1958a7675175f},
+			{.low = 0xcef980ec671f667b, .high = 0xb749faed14125d36},
+			{.low = 0x82b7e12780e7401a, .high = 0xe51c79a85916f484},
+			{.low = 0xd1b2ecb8b0908810, .high = 0x8f31cc0937ae58d2},
+			{.low = 0x861fa7e6dcb4aa15, .high = 0xb2fe3f0b8599ef07},
+			{.low = 0x67a791e093e1d49a, .high = 0xdfbdcece67006ac9},
+			{.low = 0xe0c8bb2c5c6d24e0, .high = 0x8bd6a141006042bd},
+			{.low = 0x58fae9f773886e18, .high = 0xaecc49914078536d},
+			{.low = 0xaf39a475506a899e, .high = 0xda7f5bf590966848},
+			{.low = 0x6d8406c952429603, .high = 0x888f99797a5e012d},
+			{.low = 0xc8e5087ba6d33b83, .high = 0xaab37fd7d8f58178},
+			{.low = 0xfb1e4a9a90880a64, .high = 0xd5605fcdcf32e1d6},
+			{.low = 0x5cf2eea09a55067f, .high = 0x855c3be0a17fcd26},
+			{.low = 0xf42faa48c0ea481e, .high = 0xa6b34ad8c9dfc06f},
+			{.low = 0xf13b94daf124da26, .high = 0xd0601d8efc57b08b},
+			{.low = 0x76c53d08d6b70858, .high = 0x823c12795db6ce57},
+			{.low = 0x54768c4b0c64ca6e, .high = 0xa2cb1717b52481ed},
+			{.low = 0xa9942f5dcf7dfd09, .high = 0xcb7ddcdda26da268},
+			{.low = 0xd3f93b35435d7c4c, .high = 0xfe5d54150b090b02},
+			{.low = 0xc47bc5014a1a6daf, .high = 0x9efa548d26e5a6e1},
+			{.low = 0x359ab6419ca1091b, .high = 0xc6b8e9b0709f109a},
+			{.low = 0xc30163d203c94b62, .high = 0xf867241c8cc6d4c0},
+			{.low = 0x79e0de63425dcf1d, .high = 0x9b407691d7fc44f8},
+			{.low = 0x985915fc12f542e4, .high = 0xc21094364dfb5636},
+			{.low = 0x3e6f5b7b17b2939d, .high = 0xf294b943e17a2bc4},
+			{.low = 0xa705992ceecf9c42, .high = 0x979cf3ca6cec5b5a},
+			{.low = 0x50c6ff782a838353, .high = 0xbd8430bd08277231},
+			{.low = 0xa4f8bf5635246428, .high = 0xece53cec4a314ebd},
+			{.low = 0x871b7795e136be99, .high = 0x940f4613ae5ed136},
+			{.low = 0x28e2557b59846e3f, .high = 0xb913179899f68584},
+			{.low = 0x331aeada2fe589cf, .high = 0xe757dd7ec07426e5},
+			{.low = 0x3ff0d2c85def7621, .high = 0x9096ea6f3848984f},
+			{.low = 0x0fed077a756b53a9, .high = 0xb4bca50b065abe63},
+			{.low = 0xd3e8495912c62894, .high = 0xe1ebce4dc7f16dfb},
+			{.low = 0x64712dd7abbbd95c, .high = 0x8d3360f09cf6e4bd},
+			{.low = 0xbd8d794d96aacfb3, .high = 0xb080392cc4349dec},
+			{.low = 0xecf0d7a0fc5583a0, .high = 0xdca04777f541c567},
+			{.low = 0xf41686c49db57244, .high = 0x89e42caaf9491b60},
+			{.low = 0x311c2875c522ced5, .high = 0xac5d37d5b79b6239},
+			{.low = 0x7d633293366b828b, .high = 0xd77485cb25823ac7},
+			{.low = 0xae5dff9c02033197, .high = 0x86a8d39ef77164bc},
+			{.low = 0xd9f57f830283fdfc, .high = 0xa8530886b54dbdeb},
+			{.low = 0xd072df63c324fd7b, .high = 0xd267caa862a12d66},
+			{.low = 0x4247cb9e59f71e6d, .high = 0x8380dea93da4bc60},
+			{.low = 0x52d9be85f074e608, .high = 0xa46116538d0deb78},
+			{.low = 0x67902e276c921f8b, .high = 0xcd795be870516656},
+			{.low = 0x00ba1cd8a3db53b6, .high = 0x806bd9714632dff6},
+			{.low = 0x80e8a40eccd228a4, .high = 0xa086cfcd97bf97f3},
+			{.low = 0x6122cd128006b2cd, .high = 0xc8a883c0fdaf7df0},
+			{.low = 0x796b805720085f81, .high = 0xfad2a4b13d1b5d6c},
+			{.low = 0xcbe3303674053bb0, .high = 0x9cc3a6eec6311a63},
+			{.low = 0xbedbfc4411068a9c, .high = 0xc3f490aa77bd60fc},
+			{.low = 0xee92fb5515482d44, .high = 0xf4f1b4d515acb93b},
+			{.low = 0x751bdd152d4d1c4a, .high = 0x991711052d8bf3c5},
+			{.low = 0xd262d45a78a0635d, .high = 0xbf5cd54678eef0b6},
+			{.low = 0x86fb897116c87c34, .high = 0xef340a98172aace4},
+			{.low = 0xd45d35e6ae3d4da0, .high = 0x9580869f0e7aac0e},
+			{.low = 0x8974836059cca109, .high = 0xbae0a846d2195712},
+			{.low = 0x2bd1a438703fc94b, .high = 0xe998d258869facd7},
+			{.low = 0x7b6306a34627ddcf, .high = 0x91ff83775423cc06},
+			{.low = 0x1a3bc84c17b1d542, .high = 0xb67f6455292cbf08},
+			{.low = 0x20caba5f1d9e4a93, .high = 0xe41f3d6a7377eeca},
+			{.low = 0x547eb47b7282ee9c, .high = 0x8e938662882af53e},
+			{.low = 0xe99e619a4f23aa43, .high = 0xb23867fb2a35b28d},
+			{.low = 0x6405fa00e2ec94d4, .high = 0xdec681f9f4c31f31},
+			{.low = 0xde83bc408dd3dd04, .high = 0x8b3c113c38f9f37e},
+			{.low = 0x9624ab50b148d445, .high = 0xae0b158b4738705e},
+			{.low = 0x3badd624dd9b0957, .high = 0xd98ddaee19068c76},
+			{.low = 0xe54ca5d70a80e5d6, .high = 0x87f8a8d4cfa417c9},
+			{.low = 0x5e9fcf4ccd211f4c, .high = 0xa9f6d30a038d1dbc},
+			{.low = 0x7647c3200069671f, .high = 0xd47487cc8470652b},
+			{.low = 0x29ecd9f40041e073, .high = 0x84c8d4dfd2c63f3b},
+			{.low = 0xf468107100525890, .high = 0xa5fb0a17c777cf09},
+			{.low = 0x7182148d4066eeb4, .high = 0xcf79cc9db955c2cc},
+			{.low = 0xc6f14cd848405530, .high = 0x81ac1fe293d599bf},
+			{.low = 0xb8ada00e5a506a7c, .high = 0xa21727db38cb002f},
+			{.low = 0xa6d90811f0e4851c, .high = 0xca9cf1d206fdc03b},
+			{.low = 0x908f4a166d1da663, .high = 0xfd442e4688bd304a},
+			{.low = 0x9a598e4e043287fe, .high = 0x9e4a9cec15763e2e},
+			{.low = 0x40eff1e1853f29fd, .high = 0xc5dd44271ad3cdba},
+			{.low = 0xd12bee59e68ef47c, .high = 0xf7549530e188c128},
+			{.low = 0x82bb74f8301958ce, .high = 0x9a94dd3e8cf578b9},
+			{.low = 0xe36a52363c1faf01, .high = 0xc13a148e3032d6e7},
+			{.low = 0xdc44e6c3cb279ac1, .high = 0xf18899b1bc3f8ca1},
+			{.low = 0x29ab103a5ef8c0b9, .high = 0x96f5600f15a7b7e5},
+			{.low = 0x7415d448f6b6f0e7, .high = 0xbcb2b812db11a5de},
+			{.low = 0x111b495b3464ad21, .high = 0xebdf661791d60f56},
+			{.low = 0xcab10dd900beec34, .high = 0x936b9fcebb25c995},
+			{.low = 0x3d5d514f40eea742, .high = 0xb84687c269ef3bfb},
+			{.low = 0x0cb4a5a3112a5112, .high = 0xe65829b3046b0afa},
+			{.low = 0x47f0e785eaba72ab, .high = 0x8ff71a0fe2c2e6dc},
+			{.low = 0x59ed216765690f56, .high = 0xb3f4e093db73a093},
+			{.low = 0x306869c13ec3532c, .high = 0xe0f218b8d25088b8},
+			{.low = 0x1e414218c73a13fb, .high = 0x8c974f7383725573},
+			{.low = 0xe5d1929ef90898fa, .high = 0xafbd2350644eeacf},
+			{.low = 0xdf45f746b74abf39, .high = 0xdbac6c247d62a583},
+			{.low = 0x6b8bba8c328eb783, .high = 0x894bc396ce5da772},
+			{.low = 0x066ea92f3f326564, .high = 0xab9eb47c81f5114f},
+			{.low = 0xc80a537b0efefebd, .high = 0xd686619ba27255a2},
+			{.low = 0xbd06742ce95f5f36, .high = 0x8613fd0145877585},
+			{.low = 0x2c48113823b73704, .high = 0xa798fc4196e952e7},
+			{.low = 0xf75a15862ca504c5, .high = 0xd17f3b51fca3a7a0},
+			{.low = 0x9a984d73dbe722fb, .high = 0x82ef85133de648c4},
+			{.low = 0xc13e60d0d2e0ebba, .high = 0xa3ab66580d5fdaf5},
+			{.low = 0x318df905079926a8, .high = 0xcc963fee10b7d1b3},
+			{.low = 0xfdf17746497f7052, .high = 0xffbbcfe994e5c61f},
+			{.low = 0xfeb6ea8bedefa633, .high = 0x9fd561f1fd0f9bd3},
+			{.low = 0xfe64a52ee96b8fc0, .high = 0xc7caba6e7c5382c8},
+			{.low = 0x3dfdce7aa3c673b0, .high = 0xf9bd690a1b68637b},
+			{.low = 0x06bea10ca65c084e, .high = 0x9c1661a651213e2d},
+			{.low = 0x486e494fcff30a62, .high = 0xc31bfa0fe5698db8},
+			{.low = 0x5a89dba3c3efccfa, .high = 0xf3e2f893dec3f126},
+			{.low = 0xf89629465a75e01c, .high = 0x986ddb5c6b3a76b7},
+			{.low = 0xf6bbb397f1135823, .high = 0xbe89523386091465},
+			{.low = 0x746aa07ded582e2c, .high = 0xee2ba6c0678b597f},
+			{.low = 0xa8c2a44eb4571cdc, .high = 0x94db483840b717ef},
+			{.low = 0x92f34d62616ce413, .high = 0xba121a4650e4ddeb},
+			{.low = 0x77b020baf9c81d17, .high = 0xe896a0d7e51e1566},
+			{.low = 0x0ace1474dc1d122e, .high = 0x915e2486ef32cd60},
+			{.low = 0x0d819992132456ba, .high = 0xb5b5ada8aaff80b8},
+			{.low = 0x10e1fff697ed6c69, .high = 0xe3231912d5bf60e6},
+			{.low = 0xca8d3ffa1ef463c1, .high = 0x8df5efabc5979c8f},
+			{.low = 0xbd308ff8a6b17cb2, .high = 0xb1736b96b6fd83b3},
+			{.low = 0xac7cb3f6d05ddbde, .high = 0xddd0467c64bce4a0},
+			{.low = 0x6bcdf07a423aa96b, .high = 0x8aa22c0dbef60ee4},
+			{.low = 0x86c16c98d2c953c6, .high = 0xad4ab7112eb3929d},
+			{.low = 0xe871c7bf077ba8b7, .high = 0xd89d64d57a607744},
+			{.low = 0x11471cd764ad4972, .high = 0x87625f056c7c4a8b},
+			{.low = 0xd598e40d3dd89bcf, .high = 0xa93af6c6c79b5d2d},
+			{.low = 0x4aff1d108d4ec2c3, .high = 0xd389b47879823479},
+			{.low = 0xcedf722a585139ba, .high = 0x843610cb4bf160cb},
+			{.low = 0xc2974eb4ee658828, .high = 0xa54394fe1eedb8fe},
+			{.low = 0x733d226229feea32, .high = 0xce947a3da6a9273e},
+			{.low = 0x0806357d5a3f525f, .high = 0x811ccc668829b887},
+			{.low = 0xca07c2dcb0cf26f7, .high = 0xa163ff802a3426a8},
+			{.low = 0xfc89b393dd02f0b5, .high = 0xc9bcff6034c13052},
+			{.low = 0xbbac2078d443ace2, .high = 0xfc2c3f3841f17c67},
+			{.low = 0xd54b944b84aa4c0d, .high = 0x9d9ba7832936edc0},
+			{.low = 0x0a9e795e65d4df11, .high = 0xc5029163f384a931},
+			{.low = 0x4d4617b5ff4a16d5, .high = 0xf64335bcf065d37d},
+			{.low = 0x504bced1bf8e4e45, .high = 0x99ea0196163fa42e},
+			{.low = 0xe45ec2862f71e1d6, .high = 0xc06481fb9bcf8d39},
+			{.low = 0x5d767327bb4e5a4c, .high = 0xf07da27a82c37088},
+			{.low = 0x3a6a07f8d510f86f, .high = 0x964e858c91ba2655},
+			{.low = 0x890489f70a55368b, .high = 0xbbe226efb628afea},
+			{.low = 0x2b45ac74ccea842e, .high = 0xeadab0aba3b2dbe5},
+			{.low = 0x3b0b8bc90012929d, .high = 0x92c8ae6b464fc96f},
+			{.low = 0x09ce6ebb40173744, .high = 0xb77ada0617e3bbcb},
+			{.low = 0xcc420a6a101d0515, .high = 0xe55990879ddcaabd},
+			{.low = 0x9fa946824a12232d, .high = 0x8f57fa54c2a9eab6},
+			{.low = 0x47939822dc96abf9, .high = 0xb32df8e9f3546564},
+			{.low = 0x59787e2b93bc56f7, .high = 0xdff9772470297ebd},
+			{.low = 0x57eb4edb3c55b65a, .high = 0x8bfbea76c619ef36},
+			{.low = 0xede622920b6b23f1, .high = 0xaefae51477a06b03},
+			{.low = 0xe95fab368e45eced, .high = 0xdab99e59958885c4},
+			{.low = 0x11dbcb0218ebb414, .high = 0x88b402f7fd75539b},
+			{.low = 0xd652bdc29f26a119, .high = 0xaae103b5fcd2a881},
+			{.low = 0x4be76d3346f0495f, .high = 0xd59944a37c0752a2},
+			{.low = 0x6f70a4400c562ddb, .high = 0x857fcae62d8493a5},
+			{.low = 0xcb4ccd500f6bb952, .high = 0xa6dfbd9fb8e5b88e},
+			{.low = 0x7e2000a41346a7a7, .high = 0xd097ad07a71f26b2},
+			{.low = 0x8ed400668c0c28c8, .high = 0x825ecc24c873782f},
+			{.low = 0x728900802f0f32fa, .high = 0xa2f67f2dfa90563b},
+			{.low = 0x4f2b40a03ad2ffb9, .high = 0xcbb41ef979346bca},
+			{.low = 0xe2f610c84987bfa8, .high = 0xfea126b7d78186bc},
+			{.low = 0x0dd9ca7d2df4d7c9, .high = 0x9f24b832e6b0f436},
+			{.low = 0x91503d1c79720dbb, .high = 0xc6ede63fa05d3143},
+			{.low = 0x75a44c6397ce912a, .high = 0xf8a95fcf88747d94},
+			{.low = 0xc986afbe3ee11aba, .high = 0x9b69dbe1b548ce7c},
+			{.low = 0xfbe85badce996168, .high = 0xc24452da229b021b},
+			{.low = 0xfae27299423fb9c3, .high = 0xf2d56790ab41c2a2},
+			{.low = 0xdccd879fc967d41a, .high = 0x97c560ba6b0919a5},
+			{.low = 0x5400e987bbc1c920, .high = 0xbdb6b8e905cb600f},
+			{.low = 0x290123e9aab23b68, .high = 0xed246723473e3813},
+			{.low = 0xf9a0b6720aaf6521, .high = 0x9436c0760c86e30b},
+			{.low = 0xf808e40e8d5b3e69, .high = 0xb94470938fa89bce},
+			{.low = 0xb60b1d1230b20e04, .high = 0xe7958cb87392c2c2},
+			{.low = 0xb1c6f22b5e6f48c2, .high = 0x90bd77f3483bb9b9},
+			{.low = 0x1e38aeb6360b1af3, .high = 0xb4ecd5f01a4aa828},
+			{.low = 0x25c6da63c38de1b0, .high = 0xe2280b6c20dd5232},
+			{.low = 0x579c487e5a38ad0e, .high = 0x8d590723948a535f},
+			{.low = 0x2d835a9df0c6d851, .high = 0xb0af48ec79ace837},
+			{.low = 0xf8e431456cf88e65, .high = 0xdcdb1b2798182244},
+			{.low = 0x1b8e9ecb641b58ff, .high = 0x8a08f0f8bf0f156b},
+			{.low = 0xe272467e3d222f3f, .high = 0xac8b2d36eed2dac5},
+			{.low = 0x5b0ed81dcc6abb0f, .high = 0xd7adf884aa879177},
+			{.low = 0x98e947129fc2b4e9, .high = 0x86ccbb52ea94baea},
+			{.low = 0x3f2398d747b36224, .high = 0xa87fea27a539e9a5},
+			{.low = 0x8eec7f0d19a03aad, .high = 0xd29fe4b18e88640e},
+			{.low = 0x1953cf68300424ac, .high = 0x83a3eeeef9153e89},
+			{.low = 0x5fa8c3423c052dd7, .high = 0xa48ceaaab75a8e2b},
+			{.low = 0x3792f412cb06794d, .high = 0xcdb02555653131b6},
+			{.low = 0xe2bbd88bbee40bd0, .high = 0x808e17555f3ebf11},
+			{.low = 0x5b6aceaeae9d0ec4, .high = 0xa0b19d2ab70e6ed6},
+			{.low = 0xf245825a5a445275, .high = 0xc8de047564d20a8b},
+			{.low = 0xeed6e2f0f0d56712, .high = 0xfb158592be068d2e},
+			{.low = 0x55464dd69685606b, .high = 0x9ced737bb6c4183d},
+			{.low = 0xaa97e14c3c26b886, .high = 0xc428d05aa4751e4c},
+			{.low = 0xd53dd99f4b3066a8, .high = 0xf53304714d9265df},
+			{.low = 0xe546a8038efe4029, .high = 0x993fe2c6d07b7fab},
+			{.low = 0xde98520472bdd033, .high = 0xbf8fdb78849a5f96},
+			{.low = 0x963e66858f6d4440, .high = 0xef73d256a5c0f77c},
+			{.low = 0xdde7001379a44aa8, .high = 0x95a8637627989aad},
+			{.low = 0x5560c018580d5d52, .high = 0xbb127c53b17ec159},
+			{.low = 0xaab8f01e6e10b4a6, .high = 0xe9d71b689dde71af},
+			{.low = 0xcab3961304ca70e8, .high = 0x9226712162ab070d},
+			{.low = 0x3d607b97c5fd0d22, .high = 0xb6b00d69bb55c8d1},
+			{.low = 0x8cb89a7db77c506a, .high = 0xe45c10c42a2b3b05},
+			{.low = 0x77f3608e92adb242, .high = 0x8eb98a7a9a5b04e3},
+			{.low = 0x55f038b237591ed3, .high = 0xb267ed1940f1c61c},
+			{.low = 0x6b6c46dec52f6688, .high = 0xdf01e85f912e37a3},
+			{.low = 0x2323ac4b3b3da015, .high = 0x8b61313bbabce2c6},
+			{.low = 0xabec975e0a0d081a, .high = 0xae397d8aa96c1b77},
+			{.low = 0x96e7bd358c904a21, .high = 0xd9c7dced53c72255},
+			{.low = 0x7e50d64177da2e54, .high = 0x881cea14545c7575},
+			{.low = 0xdde50bd1d5d0b9e9, .high = 0xaa242499697392d2},
+			{.low = 0x955e4ec64b44e864, .high = 0xd4ad2dbfc3d07787},
+			{.low = 0xbd5af13bef0b113e, .high = 0x84ec3c97da624ab4},
+			{.low = 0xecb1ad8aeacdd58e, .high = 0xa6274bbdd0fadd61},
+			{.low = 0x67de18eda5814af2, .high = 0xcfb11ead453994ba},
+			{.low = 0x80eacf948770ced7, .high = 0x81ceb32c4b43fcf4},
+			{.low = 0xa1258379a94d028d, .high = 0xa2425ff75e14fc31},
+			{.low = 0x096ee45813a04330, .high = 0xcad2f7f5359a3b3e},
+			{.low = 0x8bca9d6e188853fc, .high = 0xfd87b5f28300ca0d},
+			{.low = 0x775ea264cf55347e, .high = 0x9e74d1b791e07e48},
+			{.low = 0x95364afe032a819e, .high = 0xc612062576589dda},
+			{.low = 0x3a83ddbd83f52205, .high = 0xf79687aed3eec551},
+			{.low = 0xc4926a9672793543, .high = 0x9abe14cd44753b52},
+			{.low = 0x75b7053c0f178294, .high = 0xc16d9a0095928a27},
+			{.low = 0x5324c68b12dd6339, .high = 0xf1c90080baf72cb1},
+			{.low = 0xd3f6fc16ebca5e04, .high = 0x971da05074da7bee},
+			{.low = 0x88f4bb1ca6bcf585, .high = 0xbce5086492111aea},
+			{.low = 0x2b31e9e3d06c32e6, .high = 0xec1e4a7db69561a5},
+			{.low = 0x3aff322e62439fd0, .high = 0x9392ee8e921d5d07},
+			{.low = 0x09befeb9fad487c3, .high = 0xb877aa3236a4b449},
+			{.low = 0x4c2ebe687989a9b4, .high = 0xe69594bec44de15b},
+			{.low = 0x0f9d37014bf60a11, .high = 0x901d7cf73ab0acd9},
+			{.low = 0x538484c19ef38c95, .high = 0xb424dc35095cd80f},
+			{.low = 0x2865a5f206b06fba, .high = 0xe12e13424bb40e13},
+			{.low = 0xf93f87b7442e45d4, .high = 0x8cbccc096f5088cb},
+			{.low = 0xf78f69a51539d749, .high = 0xafebff0bcb24aafe},
+			{.low = 0xb573440e5a884d1c, .high = 0xdbe6fecebdedd5be},
+			{.low = 0x31680a88f8953031, .high = 0x89705f4136b4a597},
+			{.low = 0xfdc20d2b36ba7c3e, .high = 0xabcc77118461cefc},
+			{.low = 0x3d32907604691b4d, .high = 0xd6bf94d5e57a42bc},
+			{.low = 0xa63f9a49c2c1b110, .high = 0x8637bd05af6c69b5},
+			{.low = 0x0fcf80dc33721d54, .high = 0xa7c5ac471b478423},
+			{.low = 0xd3c36113404ea4a9, .high = 0xd1b71758e219652b},
+			{.low = 0x645a1cac083126ea, .high = 0x83126e978d4fdf3b},
+			{.low = 0x3d70a3d70a3d70a4, .high = 0xa3d70a3d70a3d70a},
+			{.low = 0xcccccccccccccccd, .high = 0xcccccccccccccccc},
+			{.low = 0x0000000000000000, .high = 0x8000000000000000},
+			{.low = 0x0000000000000000, .high = 0xa000000000000000},
+			{.low = 0x0000000000000000, .high = 0xc800000000000000},
+			{.low = 0x0000000000000000, .high = 0xfa00000000000000},
+			{.low = 0x0000000000000000, .high = 0x9c40000000000000},
+			{.low = 0x0000000000000000, .high = 0xc350000000000000},
+			{.low = 0x0000000000000000, .high = 0xf424000000000000},
+			{.low = 0x0000000000000000, .high = 0x9896800000000000},
+			{.low = 0x0000000000000000, .high = 0xbebc200000000000},
+			{.low = 0x0000000000000000, .high = 0xee6b280000000000},
+			{.low = 0x0000000000000000, .high = 0x9502f90000000000},
+			{.low = 0x0000000000000000, .high = 0xba43b74000000000},
+			{.low = 0x0000000000000000, .high = 0xe8d4a51000000000},
+			{.low = 0x0000000000000000, .high = 0x9184e72a00000000},
+			{.low = 0x0000000000000000, .high = 0xb5e620f480000000},
+			{.low = 0x0000000000000000, .high = 0xe35fa931a0000000},
+			{.low = 0x0000000000000000, .high = 0x8e1bc9bf04000000},
+			{.low = 0x0000000000000000, .high = 0xb1a2bc2ec5000000},
+			{.low = 0x0000000000000000, .high = 0xde0b6b3a76400000},
+			{.low = 0x0000000000000000, .high = 0x8ac7230489e80000},
+			{.low = 0x0000000000000000, .high = 0xad78ebc5ac620000},
+			{.low = 0x0000000000000000, .high = 0xd8d726b7177a8000},
+			{.low = 0x0000000000000000, .high = 0x878678326eac9000},
+			{.low = 0x0000000000000000, .high = 0xa968163f0a57b400},
+			{.low = 0x0000000000000000, .high = 0xd3c21bcecceda100},
+			{.low = 0x0000000000000000, .high = 0x84595161401484a0},
+			{.low = 0x0000000000000000, .high = 0xa56fa5b99019a5c8},
+			{.low = 0x0000000000000000, .high = 0xcecb8f27f4200f3a},
+			{.low = 0x4000000000000000, .high = 0x813f3978f8940984},
+			{.low = 0x5000000000000000, .high = 0xa18f07d736b90be5},
+			{.low = 0xa400000000000000, .high = 0xc9f2c9cd04674ede},
+			{.low = 0x4d00000000000000, .high = 0xfc6f7c4045812296},
+			{.low = 0xf020000000000000, .high = 0x9dc5ada82b70b59d},
+			{.low = 0x6c28000000000000, .high = 0xc5371912364ce305},
+			{.low = 0xc732000000000000, .high = 0xf684df56c3e01bc6},
+			{.low = 0x3c7f400000000000, .high = 0x9a130b963a6c115c},
+			{.low = 0x4b9f100000000000, .high = 0xc097ce7bc90715b3},
+			{.low = 0x1e86d40000000000, .high = 0xf0bdc21abb48db20},
+			{.low = 0x1314448000000000, .high = 0x96769950b50d88f4},
+			{.low = 0x17d955a000000000, .high = 0xbc143fa4e250eb31},
+			{.low = 0x5dcfab0800000000, .high = 0xeb194f8e1ae525fd},
+			{.low = 0x5aa1cae500000000, .high = 0x92efd1b8d0cf37be},
+			{.low = 0xf14a3d9e40000000, .high = 0xb7abc627050305ad},
+			{.low = 0x6d9ccd05d0000000, .high = 0xe596b7b0c643c719},
+			{.low = 0xe4820023a2000000, .high = 0x8f7e32ce7bea5c6f},
+			{.low = 0xdda2802c8a800000, .high = 0xb35dbf821ae4f38b},
+			{.low = 0xd50b2037ad200000, .high = 0xe0352f62a19e306e},
+			{.low = 0x4526f422cc340000, .high = 0x8c213d9da502de45},
+			{.low = 0x9670b12b7f410000, .high = 0xaf298d050e4395d6},
+			{.low = 0x3c0cdd765f114000, .high = 0xdaf3f04651d47b4c},
+			{.low = 0xa5880a69fb6ac800, .high = 0x88d8762bf324cd0f},
+			{.low = 0x8eea0d047a457a00, .high = 0xab0e93b6efee0053},
+			{.low = 0x72a4904598d6d880, .high = 0xd5d238a4abe98068},
+			{.low = 0x47a6da2b7f864750, .high = 0x85a36366eb71f041},
+			{.low = 0x999090b65f67d924, .high = 0xa70c3c40a64e6c51},
+			{.low = 0xfff4b4e3f741cf6d, .high = 0xd0cf4b50cfe20765},
+			{.low = 0xbff8f10e7a8921a4, .high = 0x82818f1281ed449f},
+			{.low = 0xaff72d52192b6a0d, .high = 0xa321f2d7226895c7},
+			{.low = 0x9bf4f8a69f764490, .high = 0xcbea6f8ceb02bb39},
+			{.low = 0x02f236d04753d5b4, .high = 0xfee50b7025c36a08},
+			{.low = 0x01d762422c946590, .high = 0x9f4f2726179a2245},
+			{.low = 0x424d3ad2b7b97ef5, .high = 0xc722f0ef9d80aad6},
+			{.low = 0xd2e0898765a7deb2, .high = 0xf8ebad2b84e0d58b},
+			{.low = 0x63cc55f49f88eb2f, .high = 0x9b934c3b330c8577},
+			{.low = 0x3cbf6b71c76b25fb, .high = 0xc2781f49ffcfa6d5},
+			{.low = 0x8bef464e3945ef7a, .high = 0xf316271c7fc3908a},
+			{.low = 0x97758bf0e3cbb5ac, .high = 0x97edd871cfda3a56},
+			{.low = 0x3d52eeed1cbea317, .high = 0xbde94e8e43d0c8ec},
+			{.low = 0x4ca7aaa863ee4bdd, .high = 0xed63a231d4c4fb27},
+			{.low = 0x8fe8caa93e74ef6a, .high = 0x945e455f24fb1cf8},
+			{.low = 0xb3e2fd538e122b44, .high = 0xb975d6b6ee39e436},
+			{.low = 0x60dbbca87196b616, .high = 0xe7d34c64a9c85d44},
+			{.low = 0xbc8955e946fe31cd, .high = 0x90e40fbeea1d3a4a},
+			{.low = 0x6babab6398bdbe41, .high = 0xb51d13aea4a488dd},
+			{.low = 0xc696963c7eed2dd1, .high = 0xe264589a4dcdab14},
+			{.low = 0xfc1e1de5cf543ca2, .high = 0x8d7eb76070a08aec},
+			{.low = 0x3b25a55f43294bcb, .high = 0xb0de65388cc8ada8},
+			{.low = 0x49ef0eb713f39ebe, .high = 0xdd15fe86affad912},
+			{.low = 0x6e3569326c784337, .high = 0x8a2dbf142dfcc7ab},
+			{.low = 0x49c2c37f07965404, .high = 0xacb92ed9397bf996},
+			{.low = 0xdc33745ec97be906, .high = 0xd7e77a8f87daf7fb},
+			{.low = 0x69a028bb3ded71a3, .high = 0x86f0ac99b4e8dafd},
+			{.low = 0xc40832ea0d68ce0c, .high = 0xa8acd7c0222311bc},
+			{.low = 0xf50a3fa490c30190, .high = 0xd2d80db02aabd62b},
+			{.low = 0x792667c6da79e0fa, .high = 0x83c7088e1aab65db},
+			{.low = 0x577001b891185938, .high = 0xa4b8cab1a1563f52},
+			{.low = 0xed4c0226b55e6f86, .high = 0xcde6fd5e09abcf26},
+			{.low = 0x544f8158315b05b4, .high = 0x80b05e5ac60b6178},
+			{.low = 0x696361ae3db1c721, .high = 0xa0dc75f1778e39d6},
+			{.low = 0x03bc3a19cd1e38e9, .high = 0xc913936dd571c84c},
+			{.low = 0x04ab48a04065c723, .high = 0xfb5878494ace3a5f},
+			{.low = 0x62eb0d64283f9c76, .high = 0x9d174b2dcec0e47b},
+			{.low = 0x3ba5d0bd324f8394, .high = 0xc45d1df942711d9a},
+			{.low = 0xca8f44ec7ee36479, .high = 0xf5746577930d6500},
+			{.low = 0x7e998b13cf4e1ecb, .high = 0x9968bf6abbe85f20},
+			{.low = 0x9e3fedd8c321a67e, .high = 0xbfc2ef456ae276e8},
+			{.low = 0xc5cfe94ef3ea101e, .high = 0xefb3ab16c59b14a2},
+			{.low = 0xbba1f1d158724a12, .high = 0x95d04aee3b80ece5},
+			{.low = 0x2a8a6e45ae8edc97, .high = 0xbb445da9ca61281f},
+			{.low = 0xf52d09d71a3293bd, .high = 0xea1575143cf97226},
+			{.low = 0x593c2626705f9c56, .high = 0x924d692ca61be758},
+			{.low = 0x6f8b2fb00c77836c, .high = 0xb6e0c377cfa2e12e},
+			{.low = 0x0b6dfb9c0f956447, .high = 0xe498f455c38b997a},
+			{.low = 0x4724bd4189bd5eac, .high = 0x8edf98b59a373fec},
+			{.low = 0x58edec91ec2cb657, .high = 0xb2977ee300c50fe7},
+			{.low = 0x2f2967b66737e3ed, .high = 0xdf3d5e9bc0f653e1},
+			{.low = 0xbd79e0d20082ee74, .high = 0x8b865b215899f46c},
+			{.low = 0xecd8590680a3aa11, .high = 0xae67f1e9aec07187},
+			{.low = 0xe80e6f4820cc9495, .high = 0xda01ee641a708de9},
+			{.low = 0x3109058d147fdcdd, .high = 0x884134fe908658b2},
+			{.low = 0xbd4b46f0599fd415, .high = 0xaa51823e34a7eede},
+			{.low = 0x6c9e18ac7007c91a, .high = 0xd4e5e2cdc1d1ea96},
+			{.low = 0x03e2cf6bc604ddb0, .high = 0x850fadc09923329e},
+			{.low = 0x84db8346b786151c, .high = 0xa6539930bf6bff45},
+			{.low = 0xe612641865679a63, .high = 0xcfe87f7cef46ff16},
+			{.low = 0x4fcb7e8f3f60c07e, .high = 0x81f14fae158c5f6e},
+			{.low = 0xe3be5e330f38f09d, .high = 0xa26da3999aef7749},
+			{.low = 0x5cadf5bfd3072cc5, .high = 0xcb090c8001ab551c},
+			{.low = 0x73d9732fc7c8f7f6, .high = 0xfdcb4fa002162a63},
+			{.low = 0x2867e7fddcdd9afa, .high = 0x9e9f11c4014dda7e},
+			{.low = 0xb281e1fd541501b8, .high = 0xc646d63501a1511d},
+			{.low = 0x1f225a7ca91a4226, .high = 0xf7d88bc24209a565},
+			{.low = 0x3375788de9b06958, .high = 0x9ae757596946075f},
+			{.low = 0x0052d6b1641c83ae, .high = 0xc1a12d2fc3978937},
+			{.low = 0xc0678c5dbd23a49a, .high = 0xf209787bb47d6b84},
+			{.low = 0xf840b7ba963646e0, .high = 0x9745eb4d50ce6332},
+			{.low = 0xb650e5a93bc3d898, .high = 0xbd176620a501fbff},
+			{.low = 0xa3e51f138ab4cebe, .high = 0xec5d3fa8ce427aff},
+			{.low = 0xc66f336c36b10137, .high = 0x93ba47c980e98cdf},
+			{.low = 0xb80b0047445d4184, .high = 0xb8a8d9bbe123f017},
+			{.low = 0xa60dc059157491e5, .high = 0xe6d3102ad96cec1d},
+			{.low = 0x87c89837ad68db2f, .high = 0x9043ea1ac7e41392},
+			{.low = 0x29babe4598c311fb, .high = 0xb454e4a179dd1877},
+			{.low = 0xf4296dd6fef3d67a, .high = 0xe16a1dc9d8545e94},
+			{.low = 0x1899e4a65f58660c, .high = 0x8ce2529e2734bb1d},
+			{.low = 0x5ec05dcff72e7f8f, .high = 0xb01ae745b101e9e4},
+			{.low = 0x76707543f4fa1f73, .high = 0xdc21a1171d42645d},
+			{.low = 0x6a06494a791c53a8, .high = 0x899504ae72497eba},
+			{.low = 0x0487db9d17636892, .high = 0xabfa45da0edbde69},
+			{.low = 0x45a9d2845d3c42b6, .high = 0xd6f8d7509292d603},
+			{.low = 0x0b8a2392ba45a9b2, .high = 0x865b86925b9bc5c2},
+			{.low = 0x8e6cac7768d7141e, .high = 0xa7f26836f282b732},
+			{.low = 0x3207d795430cd926, .high = 0xd1ef0244af2364ff},
+			{.low = 0x7f44e6bd49e807b8, .high = 0x8335616aed761f1f},
+			{.low = 0x5f16206c9c6209a6, .high = 0xa402b9c5a8d3a6e7},
+			{.low = 0x36dba887c37a8c0f, .high = 0xcd036837130890a1},
+			{.low = 0xc2494954da2c9789, .high = 0x802221226be55a64},
+			{.low = 0xf2db9baa10b7bd6c, .high = 0xa02aa96b06deb0fd},
+			{.low = 0x6f92829494e5acc7, .high = 0xc83553c5c8965d3d},
+			{.low = 0xcb772339ba1f17f9, .high = 0xfa42a8b73abbf48c},
+			{.low = 0xff2a760414536efb, .high = 0x9c69a97284b578d7},
+			{.low = 0xfef5138519684aba, .high = 0xc38413cf25e2d70d},
+			{.low = 0x7eb258665fc25d69, .high = 0xf46518c2ef5b8cd1},
+			{.low = 0xef2f773ffbd97a61, .high = 0x98bf2f79d5993802},
+			{.low = 0xaafb550ffacfd8fa, .high = 0xbeeefb584aff8603},
+			{.low = 0x95ba2a53f983cf38, .high = 0xeeaaba2e5dbf6784},
+			{.low = 0xdd945a747bf26183, .high = 0x952ab45cfa97a0b2},
+			{.low = 0x94f971119aeef9e4, .high = 0xba756174393d88df},
+			{.low = 0x7a37cd5601aab85d, .high = 0xe912b9d1478ceb17},
+			{.low = 0xac62e055c10ab33a, .high = 0x91abb422ccb812ee},
+			{.low = 0x577b986b314d6009, .high = 0xb616a12b7fe617aa},
+			{.low = 0xed5a7e85fda0b80b, .high = 0xe39c49765fdf9d94},
+			{.low = 0x14588f13be847307, .high = 0x8e41ade9fbebc27d},
+			{.low = 0x596eb2d8ae258fc8, .high = 0xb1d219647ae6b31c},
+			{.low = 0x6fca5f8ed9aef3bb, .high = 0xde469fbd99a05fe3},
+			{.low = 0x25de7bb9480d5854, .high = 0x8aec23d680043bee},
+			{.low = 0xaf561aa79a10ae6a, .high = 0xada72ccc20054ae9},
+			{.low = 0x1b2ba1518094da04, .high = 0xd910f7ff28069da4},
+			{.low = 0x90fb44d2f05d0842, .high = 0x87aa9aff79042286},
+			{.low = 0x353a1607ac744a53, .high = 0xa99541bf57452b28},
+			{.low = 0x42889b8997915ce8, .high = 0xd3fa922f2d1675f2},
+			{.low = 0x69956135febada11, .high = 0x847c9b5d7c2e09b7},
+			{.low = 0x43fab9837e699095, .high = 0xa59bc234db398c25},
+			{.low = 0x94f967e45e03f4bb, .high = 0xcf02b2c21207ef2e},
+			{.low = 0x1d1be0eebac278f5, .high = 0x8161afb94b44f57d},
+			{.low = 0x6462d92a69731732, .high = 0xa1ba1ba79e1632dc},
+			{.low = 0x7d7b8f7503cfdcfe, .high = 0xca28a291859bbf93},
+			{.low = 0x5cda735244c3d43e, .high = 0xfcb2cb35e702af78},
+			{.low = 0x3a0888136afa64a7, .high = 0x9defbf01b061adab},
+			{.low = 0x088aaa1845b8fdd0, .high = 0xc56baec21c7a1916},
+			{.low = 0x8aad549e57273d45, .high = 0xf6c69a72a3989f5b},
+			{.low = 0x36ac54e2f678864b, .high = 0x9a3c2087a63f6399},
+			{.low = 0x84576a1bb416a7dd, .high = 0xc0cb28a98fcf3c7f},
+			{.low = 0x656d44a2a11c51d5, .high = 0xf0fdf2d3f3c30b9f},
+			{.low = 0x9f644ae5a4b1b325, .high = 0x969eb7c47859e743},
+			{.low = 0x873d5d9f0dde1fee, .high = 0xbc4665b596706114},
+			{.low = 0xa90cb506d155a7ea, .high = 0xeb57ff22fc0c7959},
+			{.low = 0x09a7f12442d588f2, .high = 0x9316ff75dd87cbd8},
+			{.low = 0x0c11ed6d538aeb2f, .high = 0xb7dcbf5354e9bece},
+			{.low = 0x8f1668c8a86da5fa, .high = 0xe5d3ef282a242e81},
+			{.low = 0xf96e017d694487bc, .high = 0x8fa475791a569d10},
+			{.low = 0x37c981dcc395a9ac, .high = 0xb38d92d760ec4455},
+			{.low = 0x85bbe253f47b1417, .high = 0xe070f78d3927556a},
+			{.low = 0x93956d7478ccec8e, .high = 0x8c469ab843b89562},
+			{.low = 0x387ac8d1970027b2, .high = 0xaf58416654a6babb},
+			{.low = 0x06997b05fcc0319e, .high = 0xdb2e51bfe9d0696a},
+			{.low = 0x441fece3bdf81f03, .high = 0x88fcf317f22241e2},
+			{.low = 0xd527e81cad7626c3, .high = 0xab3c2fddeeaad25a},
+			{.low = 0x8a71e223d8d3b074, .high = 0xd60b3bd56a5586f1},
+			{.low = 0xf6872d5667844e49, .high = 0x85c7056562757456},
+			{.low = 0xb428f8ac016561db, .high = 0xa738c6bebb12d16c},
+			{.low = 0xe13336d701beba52, .high = 0xd106f86e69d785c7},
+			{.low = 0xecc0024661173473, .high = 0x82a45b450226b39c},
+			{.low = 0x27f002d7f95d0190, .high = 0xa34d721642b06084},
+			{.low = 0x31ec038df7b441f4, .high = 0xcc20ce9bd35c78a5},
+			{.low = 0x7e67047175a15271, .high = 0xff290242c83396ce},
+			{.low = 0x0f0062c6e984d386, .high = 0x9f79a169bd203e41},
+			{.low = 0x52c07b78a3e60868, .high = 0xc75809c42c684dd1},
+			{.low = 0xa7709a56ccdf8a82, .high = 0xf92e0c3537826145},
+			{.low = 0x88a66076400bb691, .high = 0x9bbcc7a142b17ccb},
+			{.low = 0x6acff893d00ea435, .high = 0xc2abf989935ddbfe},
+			{.low = 0x0583f6b8c4124d43, .high = 0xf356f7ebf83552fe},
+			{.low = 0xc3727a337a8b704a, .high = 0x98165af37b2153de},
+			{.low = 0x744f18c0592e4c5c, .high = 0xbe1bf1b059e9a8d6},
+			{.low = 0x1162def06f79df73, .high = 0xeda2ee1c7064130c},
+			{.low = 0x8addcb5645ac2ba8, .high = 0x9485d4d1c63e8be7},
+			{.low = 0x6d953e2bd7173692, .high = 0xb9a74a0637ce2ee1},
+			{.low = 0xc8fa8db6ccdd0437, .high = 0xe8111c87c5c1ba99},
+			{.low = 0x1d9c9892400a22a2, .high = 0x910ab1d4db9914a0},
+			{.low = 0x2503beb6d00cab4b, .high = 0xb54d5e4a127f59c8},
+			{.low = 0x2e44ae64840fd61d, .high = 0xe2a0b5dc971f303a},
+			{.low = 0x5ceaecfed289e5d2, .high = 0x8da471a9de737e24},
+			{.low = 0x7425a83e872c5f47, .high = 0xb10d8e1456105dad},
+			{.low = 0xd12f124e28f77719, .high = 0xdd50f1996b947518},
+			{.low = 0x82bd6b70d99aaa6f, .high = 0x8a5296ffe33cc92f},
+			{.low = 0x636cc64d1001550b, .high = 0xace73cbfdc0bfb7b},
+			{.low = 0x3c47f7e05401aa4e, .high = 0xd8210befd30efa5a},
+			{.low = 0x65acfaec34810a71, .high = 0x8714a775e3e95c78},
+			{.low = 0x7f1839a741a14d0d, .high = 0xa8d9d1535ce3b396},
+			{.low = 0x1ede48111209a050, .high = 0xd31045a8341ca07c},
+			{.low = 0x934aed0aab460432, .high = 0x83ea2b892091e44d},
+			{.low = 0xf81da84d5617853f, .high = 0xa4e4b66b68b65d60},
+			{.low = 0x36251260ab9d668e, .high = 0xce1de40642e3f4b9},
+			{.low = 0xc1d72b7c6b426019, .high = 0x80d2ae83e9ce78f3},
+			{.low = 0xb24cf65b8612f81f, .high = 0xa1075a24e4421730},
+			{.low = 0xdee033f26797b627, .high = 0xc94930ae1d529cfc},
+			{.low = 0x169840ef017da3b1, .high = 0xfb9b7cd9a4a7443c},
+			{.low = 0x8e1f289560ee864e, .high = 0x9d412e0806e88aa5},
+			{.low = 0xf1a6f2bab92a27e2, .high = 0xc491798a08a2ad4e},
+			{.low = 0xae10af696774b1db, .high = 0xf5b5d7ec8acb58a2},
+			{.low = 0xacca6da1e0a8ef29, .high = 0x9991a6f3d6bf1765},
+			{.low = 0x17fd090a58d32af3, .high = 0xbff610b0cc6edd3f},
+			{.low = 0xddfc4b4cef07f5b0, .high = 0xeff394dcff8a948e},
+			{.low = 0x4abdaf101564f98e, .high = 0x95f83d0a1fb69cd9},
+			{.low = 0x9d6d1ad41abe37f1, .high = 0xbb764c4ca7a4440f},
+			{.low = 0x84c86189216dc5ed, .high = 0xea53df5fd18d5513},
+			{.low = 0x32fd3cf5b4e49bb4, .high = 0x92746b9be2f8552c},
+			{.low = 0x3fbc8c33221dc2a1, .high = 0xb7118682dbb66a77},
+			{.low = 0x0fabaf3feaa5334a, .high = 0xe4d5e82392a40515},
+			{.low = 0x29cb4d87f2a7400e, .high = 0x8f05b1163ba6832d},
+			{.low = 0x743e20e9ef511012, .high = 0xb2c71d5bca9023f8},
+			{.low = 0x914da9246b255416, .high = 0xdf78e4b2bd342cf6},
+			{.low = 0x1ad089b6c2f7548e, .high = 0x8bab8eefb6409c1a},
+			{.low = 0xa184ac2473b529b1, .high = 0xae9672aba3d0c320},
+			{.low = 0xc9e5d72d90a2741e, .high = 0xda3c0f568cc4f3e8},
+			{.low = 0x7e2fa67c7a658892, .high = 0x8865899617fb1871},
+			{.low = 0xddbb901b98feeab7, .high = 0xaa7eebfb9df9de8d},
+			{.low = 0x552a74227f3ea565, .high = 0xd51ea6fa85785631},
+			{.low = 0xd53a88958f87275f, .high = 0x8533285c936b35de},
+			{.low = 0x8a892abaf368f137, .high = 0xa67ff273b8460356},
+			{.low = 0x2d2b7569b0432d85, .high = 0xd01fef10a657842c},
+			{.low = 0x9c3b29620e29fc73, .high = 0x8213f56a67f6b29b},
+			{.low = 0x8349f3ba91b47b8f, .high = 0xa298f2c501f45f42},
+			{.low = 0x241c70a936219a73, .high = 0xcb3f2f7642717713},
+			{.low = 0xed238cd383aa0110, .high = 0xfe0efb53d30dd4d7},
+			{.low = 0xf4363804324a40aa, .high = 0x9ec95d1463e8a506},
+			{.low = 0xb143c6053edcd0d5, .high = 0xc67bb4597ce2ce48},
+			{.low = 0xdd94b7868e94050a, .high = 0xf81aa16fdc1b81da},
+			{.low = 0xca7cf2b4191c8326, .high = 0x9b10a4e5e9913128},
+			{.low = 0xfd1c2f611f63a3f0, .high = 0xc1d4ce1f63f57d72},
+			{.low = 0xbc633b39673c8cec, .high = 0xf24a01a73cf2dccf},
+			{.low = 0xd5be0503e085d813, .high = 0x976e41088617ca01},
+			{.low = 0x4b2d8644d8a74e18, .high = 0xbd49d14aa79dbc82},
+			{.low = 0xddf8e7d60ed1219e, .high = 0xec9c459d51852ba2},
+			{.low = 0xcabb90e5c942b503, .high = 0x93e1ab8252f33b45},
+			{.low = 0x3d6a751f3b936243, .high = 0xb8da1662e7b00a17},
+			{.low = 0x0cc512670a783ad4, .high = 0xe7109bfba19c0c9d},
+			{.low = 0x27fb2b80668b24c5, .high = 0x906a617d450187e2},
+			{.low = 0xb1f9f660802dedf6, .high = 0xb484f9dc9641e9da},
+			{.low = 0x5e7873f8a0396973, .high = 0xe1a63853bbd26451},
+			{.low = 0xdb0b487b6423e1e8, .high = 0x8d07e33455637eb2},
+			{.low = 0x91ce1a9a3d2cda62, .high = 0xb049dc016abc5e5f},
+			{.low = 0x7641a140cc7810fb, .high = 0xdc5c5301c56b75f7},
+			{.low = 0xa9e904c87fcb0a9d, .high = 0x89b9b3e11b6329ba},
+			{.low = 0x546345fa9fbdcd44, .high = 0xac2820d9623bf429},
+			{.low = 0xa97c177947ad4095, .high = 0xd732290fbacaf133},
+			{.low = 0x49ed8eabcccc485d, .high = 0x867f59a9d4bed6c0},
+			{.low = 0x5c68f256bfff5a74, .high = 0xa81f301449ee8c70},
+			{.low = 0x73832eec6fff3111, .high = 0xd226fc195c6a2f8c},
+			{.low = 0xc831fd53c5ff7eab, .high = 0x83585d8fd9c25db7},
+			{.low = 0xba3e7ca8b77f5e55, .high = 0xa42e74f3d032f525},
+			{.low = 0x28ce1bd2e55f35eb, .high = 0xcd3a1230c43fb26f},
+			{.low = 0x7980d163cf5b81b3, .high = 0x80444b5e7aa7cf85},
+			{.low = 0xd7e105bcc332621f, .high = 0xa0555e361951c366},
+			{.low = 0x8dd9472bf3fefaa7, .high = 0xc86ab5c39fa63440},
+			{.low = 0xb14f98f6f0feb951, .high = 0xfa856334878fc150},
+			{.low = 0x6ed1bf9a569f33d3, .high = 0x9c935e00d4b9d8d2},
+			{.low = 0x0a862f80ec4700c8, .high = 0xc3b8358109e84f07},
+			{.low = 0xcd27bb612758c0fa, .high = 0xf4a642e14c6262c8},
+			{.low = 0x8038d51cb897789c, .high = 0x98e7e9cccfbd7dbd},
+			{.low = 0xe0470a63e6bd56c3, .high = 0xbf21e44003acdd2c},
+			{.low = 0x1858ccfce06cac74, .high = 0xeeea5d5004981478},
+			{.low = 0x0f37801e0c43ebc8, .high = 0x95527a5202df0ccb},
+			{.low = 0xd30560258f54e6ba, .high = 0xbaa718e68396cffd},
+			{.low = 0x47c6b82ef32a2069, .high = 0xe950df20247c83fd},
+			{.low = 0x4cdc331d57fa5441, .high = 0x91d28b7416cdd27e},
+			{.low = 0xe0133fe4adf8e952, .high = 0xb6472e511c81471d},
+			{.low = 0x58180fddd97723a6, .high = 0xe3d8f9e563a198e5},
+			{.low = 0x570f09eaa7ea7648, .high = 0x8e679c2f5e44ff8f},
+	};
+
+	const uint128_type schubfach_g[617]{
+			{.low = 0x5b01e8b09aa0d1b5, .high = 0x4f0cedc95a718dd4},
+			{.low = 0x119ca780f767b5ee, .high = 0x7e7b160ef71c1621},
+			{.low = 0x0e16ec672c52f7f2, .high = 0x652f44d8c5b011b4},
+			{.low = 0x581256b8f0425ff5, .high = 0x50f29d7a37c00e29},
+			{.low = 0x79a84560c0351991, .high = 0x40c21794f96671ba},
+			{.low = 0x75da089acd21c281, .high = 0x679cf287f570b5f7},
+			{.low = 0x44ae6d48a41b0201, .high = 0x52e3f5399126f7f9},
+			{.low = 0x36f1f106e9af34cd, .high = 0x424ff76140ebf994},
+			{.low = 0x57e981a4a918547b, .high = 0x6a198bcece465c20},
+			{.low = 0x2cbace1d541376c9, .high = 0x54e13ca571d1e34d},
+			{.low = 0x23c8a4e44342c56e, .high = 0x43e763b78e4182a4},
+			{.low = 0x060dd4a06b9e08b0, .high = 0x6ca56c58e39c043a},
+			{.low = 0x1e7176e6bc7e6d59, .high = 0x56eabd13e9499cfb},
+			{.low = 0x7ec12bebc9febde1, .high = 0x458897432107b0c8},
+			{.low = 0x7e01dfdfa9979635, .high = 0x6f40f20501a5e7a7},
+			{.low = 0x4b34b319547944f7, .high = 0x5900c19d9aeb1fb9},
+			{.low = 0x55c3c27aa9fa9d93, .high = 0x4733ce17af227fc7},
+			{.low = 0x560603f7765dc8ea, .high = 0x71ec7cf2b1d0cc72},
+			{.low = 0x7804cff92b7e3a55, .high = 0x5b2397288e40a38e},
+			{.low = 0x13370cc755fe9511, .high = 0x48e945ba0b66e93f},
+			{.low = 0x51f1ae0bbcca881b, .high = 0x74a86f90123e41fe},
+			{.low = 0x74c1580963d539af, .high = 0x5d538c7341cb67fe},
+			{.low = 0x43cde0078310faf3, .high = 0x4aa93d29016f8665},
+			{.low = 0x0616333f381b2b1e, .high = 0x77752ea8024c0a3c},
+			{.low = 0x3811c298f9af55b1, .high = 0x5f90f22001d66e96},
+			{.low = 0x600e35472e25de28, .high = 0x4c73f4e667debede},
+			{.low = 0x3349eed849d6303f, .high = 0x7a532170a6313164},
+			{.low = 0x42a18be03b11c033, .high = 0x61dc1ac084f42783},
+			{.low = 0x1bb46fe695a7ccf5, .high = 0x4e49af006a5cec69},
+			{.low = 0x2c53e63dbc3fae55, .high = 0x7d42b19a43c7e0a8},
+			{.low = 0x237651cafcffbeaa, .high = 0x64355ae1cfd31a20},
+			{.low = 0x35f8416f30cc9888, .high = 0x502aaf1b0ca8e1b3},
+			{.low = 0x5e603458f3d6e06d, .high = 0x402225af3d53e7c2},
+			{.low = 0x4a3386f4b957cd7b, .high = 0x669d0918621fd937},
+			{.low = 0x6e8f9f2a2ddfd796, .high = 0x52173a79e8197a92},
+			{.low = 0x720c7f54f17fdfab, .high = 0x41ac2ec7ece12edb},
+			{.low = 0x1ce0cbbb1bffcc45, .high = 0x69137e0cae3517c6},
+			{.low = 0x171a3c95afffd69e, .high = 0x540f980a24f74638},
+			{.low = 0x127b63aaf3331218, .high = 0x433facd4ea5f6b60},
+			{.low = 0x6a5f05de51eb5026, .high = 0x6b991487dd657899},
+			{.low = 0x5518d17ea7ef7352, .high = 0x5614106cb11dfa14},
+			{.low = 0x2a7a41321ff2c2a8, .high = 0x44dcd9f08db194dd},
+			{.low = 0x5d906850331e043f, .high = 0x6e2e2980e2b5bafb},
+			{.low = 0x647386a68f4b3699, .high = 0x5824ee00b55e2f2f},
+			{.low = 0x36c2d21ed908f87b, .high = 0x4683f19a2ab1bf59},
+			{.low = 0x579e1cfe280e5a5d, .high = 0x70d31c29dde93228},
+			{.low = 0x2c7e7d98200b7b7e, .high = 0x5a427cee4b20f4ed},
+			{.low = 0x09fecae019a2c932, .high = 0x483530bea280c3f1},
+			{.low = 0x43314499c29e0eb6, .high = 0x73884dfdd0ce064e},
+			{.low = 0x4f5a9d47cee4d891, .high = 0x5c6d0b3173d8050b},
+			{.low = 0x72aee4397250ad41, .high = 0x49f0d5c129799da2},
+			{.low = 0x377e39f583b44868, .high = 0x764e22cea8c295d1},
+			{.low = 0x12cb61913629d387, .high = 0x5ea4e8a553cede41},
+			{.low = 0x756f8140f8217605, .high = 0x4bb72084430be500},
+			{.low = 0x6f18cece59cf233c, .high = 0x792500d39e796e67},
+			{.low = 0x3f470bd847d8e8fd, .high = 0x60ea670fb1fabeb9},
+			{.low = 0x329f3cad064720ca, .high = 0x4d885272f4c89894},
+			{.low = 0x37652de1a3a50143, .high = 0x7c0d50b7ee0dc0ed},
+			{.low = 0x2c50f1814fb73436, .high = 0x633dda2cbe716724},
+			{.low = 0x3d0d8e010c92902b, .high = 0x4f64ae8a31f45283},
+			{.low = 0x7b48e334e0ea8045, .high = 0x7f077da9e986ea6b},
+			{.low = 0x49071c2a4d88669d, .high = 0x659f97bb2138bb89},
+			{.low = 0x20d27ceea46d1ee4, .high = 0x514c796280fa2fa1},
+			{.low = 0x670eca58838a7f1d, .high = 0x4109fab533fb594d},
+			{.low = 0x0b4add5a6c10cb62, .high = 0x680ff788532bc216},
+			{.low = 0x22a24aaebcda3c4e, .high = 0x533ff939dc2301ab},
+			{.low = 0x354ea22563e1c9d8, .high = 0x4299942e49b59aef},
+			{.low = 0x554a9d089fcfa95a, .high = 0x6a8f537d42bc2b18},
+			{.low = 0x776ee406e63fbaae, .high = 0x553f75fdcefcef46},
+			{.low = 0x5f8be99f1e996225, .high = 0x4432c4cb0bfd8c38},
+			{.low = 0x327975cb64289d08, .high = 0x6d1e07ab466279f4},
+			{.low = 0x28612b091ced4a6d, .high = 0x574b3955d1e86190},
+			{.low = 0x06b4226db0bdd524, .high = 0x45d5c777db204e0d},
+			{.low = 0x24536a491ac95506, .high = 0x6fbc72595e9a167b},
+			{.low = 0x1d0f883a7bd44405, .high = 0x59638eade54811fc},
+			{.low = 0x4a72d361fca9d004, .high = 0x4782d88b1dd34196},
+			{.low = 0x43eaebcffaa94cd3, .high = 0x726af411c952028a},
+			{.low = 0x4fef230cc88770a9, .high = 0x5b88c3416ddb353b},
+			{.low = 0x0cbf4f3d6d3926ee, .high = 0x493a35cdf17c2a96},
+			{.low = 0x61321862485b717c, .high = 0x7529efafe8c6aa89},
+			{.low = 0x675b46b506af8dfd, .high = 0x5dbb262653d22207},
+			{.low = 0x52af6bc405593e64, .high = 0x4afc1e850fdb4e6c},
+			{.low = 0x377f12d33bc1fd6d, .high = 0x77f9ca6e7fc54a47},
+			{.low = 0x45ff42429634cabd, .high = 0x5ffb085866376e9f},
+			{.low = 0x6b329b68782a3bcb, .high = 0x4cc8d379eb5f8bb2},
+			{.low = 0x2b842bda59dd2c77, .high = 0x7adaebf64565ac51},
+			{.low = 0x3c69bcaeae4a89f9, .high = 0x6248bcc5045156a7},
+			{.low = 0x6387ca25583ba194, .high = 0x4ea0970403744552},
+			{.low = 0x05a6103bc05f68ed, .high = 0x7dcdbe6cd253a21e},
+			{.low = 0x37b80cfc99e5ed8a, .high = 0x64a498570ea94e7e},
+			{.low = 0x2c933d96e184be08, .high = 0x5083ad1272210b98},
+			{.low = 0x7075cadf1ad09807, .high = 0x40695741f4e73c79},
+			{.low = 0x4d8944982ae759a4, .high = 0x670ef2032171fa5c},
+			{.low = 0x3e076a135585e150, .high = 0x52725b35b45b2eb0},
+			{.low = 0x64d2bb42aad1810d, .high = 0x41f515c49048f226},
+			{.low = 0x07b7920444826815, .high = 0x698822d41a0e503e},
+			{.low = 0x1fc60e69d0685344, .high = 0x546ce8a9ae71d9cb},
+			{.low = 0x196b3ebb0d20429d, .high = 0x438a53baf1f4ae3c},
+			{.low = 0x0f11fdf815006a94, .high = 0x6c1085f7e9877d2d},
+			{.low = 0x58db319344005543, .high = 0x56739e5fee05fdbd},
+			{.low = 0x60af5adc3666aa9c, .high = 0x45294b7ff19e6497},
+			{.low = 0x344bc4938a3dddc7, .high = 0x6ea878ccb5ca3a8c},
+			{.low = 0x5d096a0fa1cb17d2, .high = 0x5886c70a2b082ed6},
+			{.low = 0x173abb3fb4a27975, .high = 0x46d238d4ef39bf12},
+			{.low = 0x0b912b992103f588, .high = 0x71505aee4b8f981d},
+			{.low = 0x0940efadb4032ad3, .high = 0x5aa6af25093face4},
+			{.low = 0x07672624900288a9, .high = 0x488558ea6dcc8a50},
+			{.low = 0x723ea36db337410e, .high = 0x74088e43e2e0dd4c},
+			{.low = 0x5b654f8af5c5cda5, .high = 0x5cd3a5031be71770},
+			{.low = 0x62b772d5916b0aeb, .high = 0x4a42ea68e31f45f3},
+			{.low = 0x0458b7bc1bde77dd, .high = 0x76d1770e38320986},
+			{.low = 0x1d13c630164b9318, .high = 0x5f0df8d82cf4d46b},
+			{.low = 0x30dc9e8cdea2dc13, .high = 0x4c0b2d79bd90a9ef},
+			{.low = 0x0160fdae31049351, .high = 0x79ab7bf5fc1aa97f},
+			{.low = 0x1ab3fe24f403a90e, .high = 0x6155fcc4c9aeedff},
+			{.low = 0x6229981d9002eda5, .high = 0x4dde63d0a158be65},
+			{.low = 0x69dc2695b337e2a1, .high = 0x7c97061a9bc130a2},
+			{.low = 0x54b01ede28f9821b, .high = 0x63ac04e2163426e8},
+			{.low = 0x43c018b1ba6134e2, .high = 0x4fbcd0b4de901f20},
+			{.low = 0x1f99c11c5d68549d, .high = 0x7f9481216419cb67},
+			{.low = 0x4c7b00e37ded107e, .high = 0x6610674de9ae3c52},
+			{.low = 0x09fc00b5fe574065, .high = 0x51a6b90b21583042},
+			{.low = 0x3b3000919845cd1d, .high = 0x41522da2811359ce},
+			{.low = 0x784ccdb5c06fae95, .high = 0x68837c3734ebc2e3},
+			{.low = 0x2d0a3e2b00595877, .high = 0x539c635f5d8968b6},
+			{.low = 0x3da1cb5599e11393, .high = 0x42e382b2b13aba2b},
+			{.low = 0x629c7888f634ec1e, .high = 0x6b059deab52ac378},
+			{.low = 0x3549fa072b5d89b1, .high = 0x559e17eef755692d},
+			{.low = 0x1107fb38ef7e07c1, .high = 0x447e798bf91120f1},
+			{.low = 0x01a65ec17f300c68, .high = 0x6d9728dff4e834b5},
+			{.low = 0x4e1eb23465c009ed, .high = 0x57ac20b32a535d5d},
+			{.low = 0x24e55b5d1e333b24, .high = 0x46234d5c21dc4ab1},
+			{.low = 0x216ef894fd1ec506, .high = 0x70387bc69c93aab5},
+			{.low = 0x4df2607730e56a6c, .high = 0x59c6c96bb076222a},
+			{.low = 0x3e5b805f5a5121f0, .high = 0x47d23abc8d2b4e88},
+			{.low = 0x63c59a322a1b697f, .high = 0x72e9f79415121740},
+			{.low = 0x03047b5b54e2bacc, .high = 0x5bee5fa9aa74df67},
+			{.low = 0x0269fc4910b5623d, .high = 0x498b7fbaeec3e5ec},
+			{.low = 0x6a432d41b45569fb, .high = 0x75abff917e063cac},
+			{.low = 0x21cf5767c37787fc, .high = 0x5e2332dacb38308a},
+			{.low = 0x67d912b9692c6cca, .high = 0x4b4f5be23c2cf3a1},
+			{.low = 0x595b5128a8471476, .high = 0x787ef969f9e185cf},
+			{.low = 0x6115da86ed05a9f8, .high = 0x60659454c7e79e3f},
+			{.low = 0x4dab1538bd9e2193, .high = 0x4d1e1043d31fb1cc},
+			{.low = 0x62ab552795c9cf52, .high = 0x7b634d3951cc4fad},
+			{.low = 0x0222aa86116e3f75, .high = 0x62b5d7610e3d0c8b},
+			{.low = 0x4e822204dabe992a, .high = 0x4ef7df80d830d6d5},
+			{.low = 0x17369cd49130f510, .high = 0x7e59659af38157bc},
+			{.low = 0x5f5ee3dd40f3f740, .high = 0x65145148c2cddfc9},
+			{.low = 0x1918b64a9a5cc5cd, .high = 0x50dd0dd3cf0b196e},
+			{.low = 0x4746f83baeb09e3e, .high = 0x40b0d7dca5a27abe},
+			{.low = 0x253e59f91780fd2f, .high = 0x678159610903f797},
+			{.low = 0x50feae60df9a6426, .high = 0x52cde11a6d9cc612},
+			{.low = 0x5a65584d7faeb685, .high = 0x423e4daebe1704db},
+			{.low = 0x10a226e265e4573b, .high = 0x69fd4917968b3af9},
+			{.low = 0x0d4e8581eb1d1295, .high = 0x54caa0dfaba29594},
+			{.low = 0x243ed134bc174211, .high = 0x43d54d7fbc821143},
+			{.low = 0x06cae85460253682, .high = 0x6c887bff94034ed2},
+			{.low = 0x6bd586a9e6842b9b, .high = 0x56d396661002a574},
+			{.low = 0x09779eee52035616, .high = 0x457611eb40021df7},
+			{.low = 0x5bf297e3b66bbcef, .high = 0x6f234fdeccd02ff1},
+			{.low = 0x165bacb62b8963f3, .high = 0x58e90cb23d73598e},
+			{.low = 0x451623c4efa11cc2, .high = 0x4720d6f4fdf5e13e},
+			{.low = 0x3b569fa17f682e03, .high = 0x71ce24bb2fefceca},
+			{.low = 0x15dee61acc535803, .high = 0x5b0b5095bff30bd5},
+			{.low = 0x2b18b8157042accf, .high = 0x48d5da11665c0977},
+			{.low = 0x5e8df355806aae18, .high = 0x74895ce8a3c6758b},
+			{.low = 0x653e5c4466bbbe7a, .high = 0x5d3ab0ba1c9ec46f},
+			{.low = 0x3765169d1efc9861, .high = 0x4a955a2e7d4bd059},
+			{.low = 0x256e8a94fe60f3cf, .high = 0x77555d172edfb3c2},
+			{.low = 0x6abed543feb3f63f, .high = 0x5f777dac257fc301},
+			{.low = 0x3bcbddcffef65e99, .high = 0x4c5f97bceacc9c01},
+			{.low = 0x5fac961997f0975b, .high = 0x7a328c6177adc668},
+			{.low = 0x7fbd44e1465a12af, .high = 0x61c209e792f16b86},
+			{.low = 0x7fca9d810514dbbf, .high = 0x4e34d4b9425abc6b},
+			{.low = 0x32ddc8ce6e87c5ff, .high = 0x7d21545b9d5dfa46},
+			{.low = 0x5be4a0a525396b32, .high = 0x641aa9e2e44b2e9e},
+			{.low = 0x7cb6e6ea842def5c, .high = 0x501554b5836f587e},
+			{.low = 0x30925255368b25e3, .high = 0x4011109135f2ad32},
+			{.low = 0x4db6ea21f0dea304, .high = 0x6681b41b89844850},
+			{.low = 0x57c5881b2718826a, .high = 0x52015ce2d469d373},
+			{.low = 0x5fd139af527a01ef, .high = 0x419ab0b576bb0f8f},
+			{.low = 0x4c81f5e550c3364a, .high = 0x68f781225791b27f},
+			{.low = 0x239b2b1dda35c508, .high = 0x53f9341b79415b99},
+			{.low = 0x02e288e4ae916a6d, .high = 0x432dc3492dcde2e1},
+			{.low = 0x516a74a1174f10ae, .high = 0x6b7c6ba849496b01},
+			{.low = 0x4121f6e745d8da25, .high = 0x55fd22ed076def34},
+			{.low = 0x1a8192529e4714eb, .high = 0x44ca82573924bf5d},
+			{.low = 0x5d9c1d50fd3e87dd, .high = 0x6e10d08b8ea1322e},
+			{.low = 0x17b01773fdcb9fe4, .high = 0x580d73a2d880f4f2},
+			{.low = 0x4626792997d61984, .high = 0x4671294f139a5d8e},
+			{.low = 0x3d0a5b75bfbcf59f, .high = 0x70b50ee4ec2a2f4a},
+			{.low = 0x4a6eaf916630c47f, .high = 0x5a2a7250bcee8c3b},
+			{.low = 0x21f2260deb5a36cc, .high = 0x4821f50d63f209c9},
+			{.low = 0x69837016455d247a, .high = 0x736988156cb6760e},
+			{.low = 0x6e02c011d1175062, .high = 0x5c546cddf091f80b},
+			{.low = 0x719bccdb0dac404e, .high = 0x49dd23e4c074c66f},
+			{.low = 0x68f947c4e2ad33b0, .high = 0x762e9fd467213d7f},
+			{.low = 0x6d94396a4ef0f627, .high = 0x5e8bb3105280fdff},
+			{.low = 0x3e102deea58d91b9, .high = 0x4ba2f5a6a8673199},
+			{.low = 0x3019e3176f48e927, .high = 0x7904bc3dda3eb5c2},
+			{.low = 0x4014b5ac590720ec, .high = 0x60d09697e1cbc49b},
+			{.low = 0x4cdd5e237a6c1a57, .high = 0x4d73abacb4a303af},
+			{.low = 0x47c8969f2a46908a, .high = 0x7bec45e12104d2b2},
+			{.low = 0x6ca0787f5505406f, .high = 0x63236b1a80d0a88e},
+			{.low = 0x0a19f9ff773766bf, .high = 0x4f4f88e200a6ed3f},
+			{.low = 0x5cf65ccbf1f23dfe, .high = 0x7ee5a7d0010b1531},
+			{.low = 0x172b7d6ff4c1cb32, .high = 0x6584864000d5aa8e},
+			{.low = 0x78ef978cc3ce3c28, .high = 0x5136d1cccd77bba4},
+			{.low = 0x13f2dfa3cfd83020, .high = 0x40f8a7d70ac62fb7},
+			{.low = 0x398499061959e699, .high = 0x67f43fbe77a37f8b},
+			{.low = 0x6136e0d1ade18548, .high = 0x5329cc985fb5ffa2},
+			{.low = 0x00f8b3daf181376d, .high = 0x4287d6e04c91994f},
+			{.low = 0x1b27862b1c01f247, .high = 0x6a72f166e0e8f54b},
+			{.low = 0x2f52d1bc1667f506, .high = 0x5528c11f1a53f76f},
+			{.low = 0x0c424163451ff738, .high = 0x44209a7f48432c59},
+			{.low = 0x7a039bd208332526, .high = 0x6d00f7320d3846f4},
+			{.low = 0x7b361641a028ea85, .high = 0x5733f8f4d76038c3},
+			{.low = 0x2f5e78348020bb9e, .high = 0x45c32d90ac4cfa36},
+			{.low = 0x4bca59ed99cdf8fc, .high = 0x6f9eaf4de07b29f0},
+			{.low = 0x563b7b247b0b2d96, .high = 0x594bbf71806287f3},
+			{.low = 0x11c92f50626f57ac, .high = 0x476fcc5acd1b9ff6},
+			{.low = 0x02db7ee703e55912, .high = 0x724c7a2ae1c5ccbd},
+			{.low = 0x1be2cbec031de0dc, .high = 0x5b7061bbe7d17097},
+			{.low = 0x164f09899c17e716, .high = 0x4926b496530df3ac},
+			{.low = 0x3d4b4275c68ca4f0, .high = 0x750aba8a1e7cb913},
+			{.low = 0x4aa29b916ba3b726, .high = 0x5da22ed4e530940f},
+			{.low = 0x6ee87c74561c9285, .high = 0x4ae825771dc07672},
+			{.low = 0x3173fa53bcfa8408, .high = 0x77d9d58b62cd8a51},
+			{.low = 0x278ffb7630c869a0, .high = 0x5fe177a2b5713b74},
+			{.low = 0x1fa662c4f3d387b3, .high = 0x4cb45fb55df42f90},
+			{.low = 0x32a3d13b1fb8d91f, .high = 0x7aba32bbc986b280},
+			{.low = 0x0ee9742f4c93e0e6, .high = 0x622e8efca1388ecd},
+			{.low = 0x58bac3590a0fe71e, .high = 0x4e8ba596e760723d},
+			{.low = 0x412ad228101971c9, .high = 0x7dac3c24a5671d2f},
+			{.low = 0x00ef0e8673478e3b, .high = 0x6489c9b6eab8e426},
+			{.low = 0x1a58d86b8f6c71c9, .high = 0x506e3af8bbc71ceb},
+			{.low = 0x1513e0560c56c16e, .high = 0x40582f2d6305b0bc},
+			{.low = 0x3b530089ad579be2, .high = 0x66f37eaf04d5e793},
+			{.low = 0x15dc006e2446164f, .high = 0x525c6558d0ab1fa9},
+			{.low = 0x5e4999f1b69e783f, .high = 0x41e384470d55b2ed},
+			{.low = 0x7d428fe92430c065, .high = 0x696c06d81555eb15},
+			{.low = 0x31020cba835a3384, .high = 0x54566be0111188de},
+			{.low = 0x5a680a2ecf7b5c69, .high = 0x4378564cda746d7e},
+			{.low = 0x770cdd17b25efa42, .high = 0x6bf3bd47c3ed7bfd},
+			{.low = 0x1270b0dfc1e59502, .high = 0x565c976c9cbdfccb},
+			{.low = 0x5b8d5a4c9b1e10ce, .high = 0x4516df8a16fe63d5},
+			{.low = 0x127bc3adc4fce7b0, .high = 0x6e8aff4357fd6c89},
+			{.low = 0x0ec96957d0ca52f3, .high = 0x586f329c466456d4},
+			{.low = 0x3f07877973d50f29, .high = 0x46bf5bb038504576},
+			{.low = 0x31a5a58f1fbb4b75, .high = 0x71322c4d26e6d58a},
+			{.low = 0x5aeaead8e62f6f91, .high = 0x5a8e89d75252446e},
+			{.low = 0x2f22557a51bf8c74, .high = 0x487207df750e9d25},
+			{.low = 0x1836ef2a1c65ad86, .high = 0x73e9a63254e42ea2},
+			{.low = 0x2cf8bf54e3848ad2, .high = 0x5cbaeb5b771cf21b},
+			{.low = 0x23fa32aa4f9d3bdb, .high = 0x4a2f22af927d8e7c},
+			{.low = 0x5329eaaa18fb92f8, .high = 0x76b1d118ea627d93},
+			{.low = 0x0f54bbbb472fa8c6, .high = 0x5ef4a74721e86476},
+			{.low = 0x25dd62fc38f2ed6c, .high = 0x4bf6ec38e7ed1d2b},
+			{.low = 0x22fbd1938e517bdf, .high = 0x798b138e3fe1c845},
+			{.low = 0x4f2fdadc71dac97f, .high = 0x613c0fa4ffe7d36a},
+			{.low = 0x58f3157d27e23acc, .high = 0x4dc9a61d998642bb},
+			{.low = 0x74b82261d969f7ad, .high = 0x7c75d695c2706ac5},
+			{.low = 0x10934eb4adee5fbe, .high = 0x63917877cec0556b},
+			{.low = 0x4075d8908b251965, .high = 0x4fa793930bcd1122},
+			{.low = 0x00bc8db411d4f56e, .high = 0x7f7285b812e1b504},
+			{.low = 0x66fd3e29a7dd9125, .high = 0x65f537c675815d9c},
+			{.low = 0x6bfdcb54864ada84, .high = 0x5190f96b91344ae3},
+			{.low = 0x6ffe3c439ea2486a, .high = 0x4140c78940f6a24f},
+			{.low = 0x7ffd2d38fdd073dc, .high = 0x6867a5a867f103b2},
+			{.low = 0x6664242d97d9f64a, .high = 0x53861e2053273628},
+			{.low = 0x51e9b68adfe191d5, .high = 0x42d1b1b375b8f820},
+			{.low = 0x1ca924116635b621, .high = 0x6ae91c5255f4c034},
+			{.low = 0x63ba83411e915e81, .high = 0x558749db77f70029},
+			{.low = 0x6962029a7edab201, .high = 0x446c3b15f9926687},
+			{.low = 0x0f03375d97c45001, .high = 0x6d79f82328ea3da6},
+			{.low = 0x259c2c4adfd04001, .high = 0x5794c6828721caeb},
+			{.low = 0x5149bd08b30d0001, .high = 0x46109eced2816f22},
+			{.low = 0x3542c80deb480001, .high = 0x701a97b150cf1837},
+			{.low = 0x7768a00b22a00001, .high = 0x59aedfc10d7279c5},
+			{.low = 0x79208008e8800001, .high = 0x47bf19673df52e37},
+			{.low = 0x5b67334174000001, .high = 0x72cb5bd86321e38c},
+			{.low = 0x7c528f6790000001, .high = 0x5bd5e313828182d6},
+			{.low = 0x16a872b940000001, .high = 0x4977e8dc68679bdf},
+			{.low = 0x5773eac200000001, .high = 0x758ca7c70d7292fe},
+			{.low = 0x45f6556800000001, .high = 0x5e0a1fd271287598},
+			{.low = 0x04c5112000000001, .high = 0x4b3b4ca85a86c47a},
+			{.low = 0x07a1b50000000001, .high = 0x785ee10d5da46d90},
+			{.low = 0x52e7c40000000001, .high = 0x604be73de4838ad9},
+			{.low = 0x0f1fd00000000001, .high = 0x4d0985cb1d3608ae},
+			{.low = 0x31cc800000000001, .high = 0x7b426fab61f00de3},
+			{.low = 0x5b0a000000000001, .high = 0x629b8c891b267182},
+			{.low = 0x7c08000000000001, .high = 0x4ee2d6d415b85ace},
+			{.low = 0x1340000000000001, .high = 0x7e37be2022c0914b},
+			{.low = 0x2900000000000001, .high = 0x64f964e68233a76f},
+			{.low = 0x5400000000000001, .high = 0x50c783eb9b5c85f2},
+			{.low = 0x1000000000000001, .high = 0x409f9cbc7c4a04c2},
+			{.low = 0x0000000000000001, .high = 0x6765c793fa10079d},
+			{.low = 0x0000000000000001, .high = 0x52b7d2dcc80cd2e4},
+			{.low = 0x0000000000000001, .high = 0x422ca8b0a00a4250},
+			{.low = 0x0000000000000001, .high = 0x69e10de76676d080},
+			{.low = 0x0000000000000001, .high = 0x54b40b1f852bda00},
+			{.low = 0x0000000000000001, .high = 0x43c33c1937564800},
+			{.low = 0x0000000000000001, .high = 0x6c6b935b8bbd4000},
+			{.low = 0x0000000000000001, .high = 0x56bc75e2d6310000},
+			{.low = 0x0000000000000001, .high = 0x4563918244f40000},
+			{.low = 0x0000000000000001, .high = 0x6f05b59d3b200000},
+			{.low = 0x0000000000000001, .high = 0x58d15e1762800000},
+			{.low = 0x0000000000000001, .high = 0x470de4df82000000},
+			{.low = 0x0000000000000001, .high = 0x71afd498d0000000},
+			{.low = 0x0000000000000001, .high = 0x5af3107a40000000},
+			{.low = 0x0000000000000001, .high = 0x48c2739500000000},
+			{.low = 0x0000000000000001, .high = 0x746a528800000000},
+			{.low = 0x0000000000000001, .high = 0x5d21dba000000000},
+			{.low = 0x0000000000000001, .high = 0x4a817c8000000000},
+			{.low = 0x0000000000000001, .high = 0x7735940000000000},
+			{.low = 0x0000000000000001, .high = 0x5f5e100000000000},
+			{.low = 0x0000000000000001, .high = 0x4c4b400000000000},
+			{.low = 0x0000000000000001, .high = 0x7a12000000000000},
+			{.low = 0x0000000000000001, .high = 0x61a8000000000000},
+			{.low = 0x0000000000000001, .high = 0x4e20000000000000},
+			{.low = 0x0000000000000001, .high = 0x7d00000000000000},
+			{.low = 0x0000000000000001, .high = 0x6400000000000000},
+			{.low = 0x0000000000000001, .high = 0x5000000000000000},
+			{.low = 0x0000000000000001, .high = 0x4000000000000000},
+			{.low = 0x3333333333333334, .high = 0x6666666666666666},
+			{.low = 0x0f5c28f5c28f5c29, .high = 0x51eb851eb851eb85},
+			{.low = 0x5916872b020c49bb, .high = 0x4189374bc6a7ef9d},
+			{.low = 0x74f0d844d013a92b, .high = 0x68db8bac710cb295},
+			{.low = 0x43f3e0370cdc8755, .high = 0x53e2d6238da3c211},
+			{.low = 0x698fe69270b06c44, .high = 0x431bde82d7b634da},
+			{.low = 0x0f4ca41d811a46d4, .high = 0x6b5fca6af2bd215e},
+			{.low = 0x3f70834acdae9f10, .high = 0x55e63b88c230e77e},
+			{.low = 0x4c5a02a23e254c0d, .high = 0x44b82fa09b5a52cb},
+			{.low = 0x2d5cd10396a21347, .high = 0x6df37f675ef6eadf},
+			{.low = 0x3de3da69454e75d3, .high = 0x57f5ff85e592557f},
+			{.low = 0x7e4fe1edd10b9175, .high = 0x465e6604b7a84465},
+			{.low = 0x4a19697c81ac1bef, .high = 0x709709a125da0709},
+			{.low = 0x54e1213067bce326, .high = 0x5a126e1a84ae6c07},
+			{.low = 0x43e74dc052fd8285, .high = 0x480ebe7b9d58566c},
+			{.low = 0x530baf9a1e626a6d, .high = 0x734aca5f6226f0ad},
+			{.low = 0x426fbfae7eb521f1, .high = 0x5c3bd5191b525a24},
+			{.low = 0x4ebfcc8b9890e7f4, .high = 0x49c97747490eae83},
+			{.low = 0x4acc7a78f41b0cba, .high = 0x760f253edb4ab0d2},
+			{.low = 0x223d2ec729af3d62, .high = 0x5e72843249088d75},
+			{.low = 0x34fdbf05baf29781, .high = 0x4b8ed0283a6d3df7},
+			{.low = 0x54c931a2c4b758cf, .high = 0x78e480405d7b9658},
+			{.low = 0x5d6dc14f03c5e0a5, .high = 0x60b6cd004ac94513},
+			{.low = 0x31249aa59c9e4d51, .high = 0x4d5f0a66a23a9da9},
+			{.low = 0x4ea0f76f60fd4882, .high = 0x7bcb43d769f762a8},
+			{.low = 0x254d92bf80caa068, .high = 0x63090312bb2c4eed},
+			{.low = 0x1dd7a89933d54d20, .high = 0x4f3a68dbc8f03f24},
+			{.low = 0x62f2a75b86221500, .high = 0x7ec3daf941806506},
+			{.low = 0x025bb91604e810cd, .high = 0x65697bfa9acd1d9f},
+			{.low = 0x684960de6a5340a4, .high = 0x51212ffbaf0a7e18},
+			{.low = 0x203ab3e521dc33b6, .high = 0x40e7599625a1fe7a},
+			{.low = 0x19f7863b696052bd, .high = 0x67d88f56a29cca5d},
+			{.low = 0x7b2c6b62bab37564, .high = 0x5313a5dee87d6eb0},
+			{.low = 0x2f56bc4efbc2c450, .high = 0x42761e4bed31255a},
+			{.low = 0x655793b192d13a1a, .high = 0x6a5696dfe1e83bc3},
+			{.low = 0x377942f475742e7b, .high = 0x5512124cb4b9c969},
+			{.low = 0x5f9435905df68b96, .high = 0x440e750a2a2e3aba},
+			{.low = 0x65b9ef4d63241289, .high = 0x6ce3ee76a9e3912a},
+			{.low = 0x6afb25d782834207, .high = 0x571cbec554b60dbb},
+			{.low = 0x08c8eb12cecf6806, .high = 0x45b0989ddd5e7163},
+			{.low = 0x5adb11b7b14bd9a3, .high = 0x6f80f42fc8971bd1},
+			{.low = 0x157c0e2c8dd647b5, .high = 0x5933f68ca078e30e},
+			{.low = 0x5dfcd823a4ab6c91, .high = 0x475cc53d4d2d8271},
+			{.low = 0x632e269f6ddf141b, .high = 0x722e086215159d82},
+			{.low = 0x4f581ee5f17f4349, .high = 0x5b5806b4ddaae468},
+			{.low = 0x72ace584c1329c3b, .high = 0x49133890b1558386},
+			{.low = 0x6aae3c079b842d2a, .high = 0x74eb8db44eef38d7},
+			{.low = 0x5558300616035755, .high = 0x5d893e29d8bf60ac},
+			{.low = 0x7779c004de6912ab, .high = 0x4ad431bb13cc4d56},
+			{.low = 0x258f99a163db5111, .high = 0x77b9e92b52e07bbe},
+			{.low = 0x37a614811caf740d, .high = 0x5fc7edbc424d2fcb},
+			{.low = 0x7951aa00e3bf900b, .high = 0x4c9ff163683dbfd5},
+			{.low = 0x754f7667d2cc19ab, .high = 0x7a998238a6c932ef},
+			{.low = 0x2aa5f8530f09ae22, .high = 0x6214682d523a8f26},
+			{.low = 0x55519375a5a1581b, .high = 0x4e76b9bddb620c1e},
+			{.low = 0x3bb5b8bc3c3559c5, .high = 0x7d8ac2c95f034697},
+			{.low = 0x7c9160969691149e, .high = 0x646f023ab2690545},
+			{.low = 0x16dab3ababa743b2, .high = 0x5058ce955b87376b},
+			{.low = 0x78aef622efb902f5, .high = 0x40470baaaf9f5f88},
+			{.low = 0x0de4bd04b2c19e54, .high = 0x66d812aab29898db},
+			{.low = 0x57ea30d08f014b76, .high = 0x524675555bad4715},
+			{.low = 0x4654f3da0c01092c, .high = 0x41d1f7777c8a9f44},
+			{.low = 0x23bb1fc346680eac, .high = 0x694ff258c7443207},
+			{.low = 0x4fc8e635d1ecd88a, .high = 0x543ff513d29cf4d2},
+			{.low = 0x263a51c4a7f0ad3b, .high = 0x43665da9754a5d75},
+			{.low = 0x56c3b607731aaec4, .high = 0x6bd6fc425543c8bb},
+			{.low = 0x789c919f8f488bd0, .high = 0x5645969b77696d62},
+			{.low = 0x46e3a7b2d906d640, .high = 0x4504787c5f878ab5},
+			{.low = 0x3e390c515b3e239a, .high = 0x6e6d8d93cc0c1122},
+			{.low = 0x4b60d6a77c31b615, .high = 0x5857a4763cd6741b},
+			{.low = 0x55e7121f968e2b44, .high = 0x46ac8391ca4529af},
+			{.low = 0x0971b698f0e3786d, .high = 0x711405b6106ea919},
+			{.low = 0x078e2bad8d82c6bd, .high = 0x5a766af80d255414},
+			{.low = 0x6c71bc8ad79bd231, .high = 0x485ebbf9a41ddcdc},
+			{.low = 0x2d82c7448c2c8382, .high = 0x73cac65c39c96161},
+			{.low = 0x3e023903a356cf9b, .high = 0x5ca23849c7d44de7},
+			{.low = 0x7e682d9c82abd949, .high = 0x4a1b603b06437185},
+			{.low = 0x4a4048fa6aac8edb, .high = 0x76923391a39f1c09},
+			{.low = 0x55003a61eef07249, .high = 0x5edb5c7482e5b007},
+			{.low = 0x773361e7f259f507, .high = 0x4be2b05d35848cd2},
+			{.low = 0x3eb89ca6508fee71, .high = 0x796ab3c855a0e151},
+			{.low = 0x7efa16eb73a6585b, .high = 0x6122296d114d810d},
+			{.low = 0x3261abef8fb846af, .high = 0x4db4edf0daa4673e},
+			{.low = 0x1d691318e5f3a44b, .high = 0x7c54afe7c43a3eca},
+			{.low = 0x64540f471e5c836f, .high = 0x6376f31fd02e98a1},
+			{.low = 0x0376729f4b7d35f3, .high = 0x4f925c1973587a1b},
+			{.low = 0x38bd84321261efeb, .high = 0x7f50935bebc0c35e},
+			{.low = 0x13cad0280eb4bfef, .high = 0x65da0f7cbc9a35e5},
+			{.low = 0x5ca240200bc3ccbf, .high = 0x517b3f96fd482b1d},
+			{.low = 0x63b50019a3030a33, .high = 0x412f66126439bc17},
+			{.low = 0x1f88002904d1a9ea, .high = 0x684bd683d38f9359},
+			{.low = 0x32d3335403daee55, .high = 0x536fdecfdc72dc47},
+			{.low = 0x5bdc291003158b77, .high = 0x42bfe57316c249d2},
+			{.low = 0x12f9db4cd1bc1258, .high = 0x6acca251be03a951},
+			{.low = 0x7594af70a7c9a847, .high = 0x557081dafe695440},
+			{.low = 0x4476f2c0863aed06, .high = 0x445a017bfebaa9cd},
+			{.low = 0x3a57eacda3917b3c, .high = 0x6d5ccf2ccac442e2},
+			{.low = 0x7b7988a482dac8fd, .high = 0x577d728a3bd03581},
+			{.low = 0x15fad3b6cf156d97, .high = 0x45fdf53b630cf79b},
+			{.low = 0x565e1f8ae4ef15be, .high = 0x6ffcbb923814bf5e},
+			{.low = 0x11e4e608b725aaff, .high = 0x5996fc74f9aa32b2},
+			{.low = 0x27ea51a0928488cc, .high = 0x47abfd2a6154f55b},
+			{.low = 0x7310829a84074146, .high = 0x72acc843ceee555e},
+			{.low = 0x42739baed005cdd2, .high = 0x5bbd6d030bf1dde5},
+			{.low = 0x4ec2e2f24004a4a8, .high = 0x49645735a327e4b7},
+			{.low = 0x4ad16b1d333aa10c, .high = 0x756d5855d1d96df2},
+			{.low = 0x2241227dc2954da3, .high = 0x5df11377db1457f5},
+			{.low = 0x4e9a81fe35443e1c, .high = 0x4b2742c648dd132a},
+			{.low = 0x175d9cc9eed39694, .high = 0x783ed13d4161b844},
+			{.low = 0x7917b0a18bdc7876, .high = 0x603240fdcde7c69c},
+			{.low = 0x1412f3b46fe39392, .high = 0x4cf500cb0b1fd217},
+			{.low = 0x535185ed7fd285b6, .high = 0x7b219ade7832e9be},
+			{.low = 0x42a79e57997537c5, .high = 0x628148b1f9c25498},
+			{.low = 0x3552e512e12a9304, .high = 0x4ecdd3c1949b76e0},
+			{.low = 0x6eeb081e3510eb39, .high = 0x7e161f9c20f8be33},
+			{.low = 0x3f226ce4f740bc2e, .high = 0x64de7fb01a609829},
+			{.low = 0x3281f0b72c33c9be, .high = 0x50b1ffc0151a1354},
+			{.low = 0x42018d5f568fd498, .high = 0x408e66334414dc43},
+			{.low = 0x1ccf48988a7fba8d, .high = 0x674a3d1ed354939f},
+			{.low = 0x30a5d3ad3b99620b, .high = 0x52a1ca7f0f76dc7f},
+			{.low = 0x73b7dc8a96144e6f, .high = 0x421b0865a5f8b065},
+			{.low = 0x52bfc7442353b0b1, .high = 0x69c4da3c3cc11a3c},
+			{.low = 0x756639034f7626f4, .high = 0x549d7b6363cdae96},
+			{.low = 0x4451c735d92b525d, .high = 0x43b12f82b63e2545},
+			{.low = 0x3a1c71efc1deea2e, .high = 0x6c4eb26abd303ba2},
+			{.low = 0x61b05b2634b254f2, .high = 0x56a55b889759c94e},
+			{.low = 0x1af37c1e908eaa5b, .high = 0x45511606df7b0772},
+			{.low = 0x2b1f2cfdb41776f8, .high = 0x6ee8233e325e7250},
+			{.low = 0x6f4c23fe29ac5f2d, .high = 0x58b9b5cb5b7ec1d9},
+			{.low = 0x72a34ffe87bd18f1, .high = 0x46faf7d5e2cbce47},
+			{.low = 0x04387ffda5fb5b1b, .high = 0x71918c896adfb073},
+			{.low = 0x0360666484c915af, .high = 0x5adad6d4557fc05c},
+			{.low = 0x02b3851d3707448c, .high = 0x48af1243779966b0},
+			{.low = 0x1dec082ebe720746, .high = 0x744b506bf28f0ab3},
+			{.low = 0x64bcd358985b3905, .high = 0x5d090d2328726ef5},
+			{.low = 0x6a30a913ad15c738, .high = 0x4a6da41c205b8bf7},
+			{.low = 0x5d1aa81f7b560b8c, .high = 0x7715d36033c5acbf},
+			{.low = 0x7daeece5fc44d609, .high = 0x5f44a919c3048a32},
+			{.low = 0x7e258a51969d7808, .high = 0x4c36edae359d3b5b},
+			{.low = 0x16a276e8f0fbf33f, .high = 0x79f17c49ef61f893},
+			{.low = 0x121b9253f3fcc299, .high = 0x618dfd07f2b4c6dc},
+			{.low = 0x41afa84329970214, .high = 0x4e0b30d328909f16},
+			{.low = 0x4f7f739ea8f19ced, .high = 0x7cdeb4850db431bd},
+			{.low = 0x3f99294bba5ae3f1, .high = 0x63e55d373e29c164},
+			{.low = 0x7fadbaa2fb7be98d, .high = 0x4feab0f8fe87cde9},
+			{.low = 0x7f7c5dd1925fdc15, .high = 0x7fdde7f4ca72e30f},
+			{.low = 0x4c637e4141e649ab, .high = 0x664b1ff7085be8d9},
+			{.low = 0x704f983434b83aef, .high = 0x51d5b32c06afed7a},
+			{.low = 0x26a6135cf6f9c8bf, .high = 0x4177c2899ef32462},
+			{.low = 0x3dd685618b294132, .high = 0x68bf9da8fe51d3d0},
+			{.low = 0x4b12044e08edcdc2, .high = 0x53cc7e20cb74a973},
+			{.low = 0x6f419d0b3a57d7ce, .high = 0x4309fe80a2c3bac2},
+			{.low = 0x320294dec3bfbfb0, .high = 0x6b4330cdd1392ad1},
+			{.low = 0x419baa4bcfcc995a, .high = 0x55cf5a3e40fa88a7},
+			{.low = 0x1ae2eea30ca3ade1, .high = 0x44a5e1cb672ed3b9},
+			{.low = 0x77d17dd1add2afcf, .high = 0x6dd636123eb152c1},
+			{.low = 0x797464a7be42263f, .high = 0x57de91a832277567},
+			{.low = 0x4790508631ce84ff, .high = 0x464ba7b9c1b92ab9},
+			{.low = 0x0c1a1a704fb0d4cc, .high = 0x70790c5c6928445c},
+			{.low = 0x567b4859d95a43d6, .high = 0x59fa7049edb9d049},
+			{.low = 0x11fc39e17aae9cab, .high = 0x47fb8d07f161736e},
+			{.low = 0x032d2968c44a9445, .high = 0x732c14d98235857d},
+			{.low = 0x4f575453d03ba9d1, .high = 0x5c2343e134f79dfd},
+			{.low = 0x72ac4376402fbb0e, .high = 0x49b5cfe75d92e4ca},
+			{.low = 0x0446d256cd192b49, .high = 0x75efb30bc8eb07ab},
+			{.low = 0x1d0575123dadbc3a, .high = 0x5e595c096d88d2ef},
+			{.low = 0x4a6ac40e97be302f, .high = 0x4b7ab0078ad3dbf2},
+			{.low = 0x771139b0f2c9e6b1, .high = 0x78c44cd8de1fc650},
+			{.low = 0x78da948d8f07ebc1, .high = 0x609d0a4718196b73},
+			{.low = 0x60aedd3e0c065634, .high = 0x4d4a6e9f467abc5c},
+			{.low = 0x344afb9679a3bd20, .high = 0x7baa4a9870c46094},
+			{.low = 0x103bfc78614fca80, .high = 0x62eea2138d69e6dd},
+			{.low = 0x26966393810ca200, .high = 0x4f254e760abb1f17},
+			{.low = 0x2423d2859b476999, .high = 0x7ea21723445e9825},
+			{.low = 0x69b642047c392148, .high = 0x654e78e9037ee01d},
+			{.low = 0x6e2b680396941aa0, .high = 0x510b93ed9c658017},
+			{.low = 0x71bc53361210154d, .high = 0x40d60ff149eaccdf},
+			{.low = 0x1c6085235019bbae, .high = 0x67bce64edcaae166},
+			{.low = 0x7d1a041c40149625, .high = 0x52fd850be3bbe784},
+			{.low = 0x4a7b367d0010781d, .high = 0x42646a6fe9631f9d},
+			{.low = 0x5d91f0c8001a59c8, .high = 0x6a3a43e642383295},
+			{.low = 0x17a7f3d3334847d4, .high = 0x54fb698501c68ede},
+			{.low = 0x79532975c2a03976, .high = 0x43fc546a67d20be4},
+			{.low = 0x0eeb75893766c256, .high = 0x6cc6ed770c83463b},
+			{.low = 0x25892ad42c523512, .high = 0x57058ac5a39c382f},
+			{.low = 0x37a0ef102374f742, .high = 0x459e089e1c7cf9bf},
+			{.low = 0x59017e8038bb2536, .high = 0x6f6340fcfa618f98},
+			{.low = 0x7a67986693c8ea91, .high = 0x591c33fd951ad946},
+			{.low = 0x151fad1edca0bba8, .high = 0x4749c33144157a9f},
+			{.low = 0x0832ae97c76792a5, .high = 0x720f9eb539bbf765},
+			{.low = 0x068ef21305ec7551, .high = 0x5b3fb22a94965f84},
+			{.low = 0x1ed8c1a8d189f774, .high = 0x48ffc1bbaa11e603},
+			{.low = 0x4af4690e1c0ff253, .high = 0x74cc692c434fd66b},
+			{.low = 0x225d20d816732843, .high = 0x5d705423690cab89},
+			{.low = 0x35174d79ab8f5369, .high = 0x4ac0434f873d5607},
+			{.low = 0x21bee25c45b21f0e, .high = 0x779a054c0b955672},
+			{.low = 0x3498b5169e2818d8, .high = 0x5fae6aa33c77785b},
+			{.low = 0x5d46f7454b534713, .high = 0x4c8b888296c5f9e2},
+			{.low = 0x7ba4bed545520b52, .high = 0x7a78da6a8ad65c9d},
+			{.low = 0x2fb6ff110441a2a8, .high = 0x61fa48553bdeb07e},
+			{.low = 0x72f8cc0d9d014eed, .high = 0x4e61d37763188d31},
+			{.low = 0x1e5ae015c80217e1, .high = 0x7d6952589e8daeb6},
+			{.low = 0x1848b344a001acb4, .high = 0x645441e07ed7bef8},
+			{.low = 0x603a2903b3348a2a, .high = 0x504367e6cbdfcbf9},
+			{.low = 0x002e873628f6d4ee, .high = 0x4035ecb8a3196ffb},
+			{.low = 0x19e40b89db2487e3, .high = 0x66bcadf43828b32b},
+			{.low = 0x14b66fa17c1d3983, .high = 0x52308b29c686f5bc},
+			{.low = 0x1091f2e7967dc79c, .high = 0x41c06f549ed25e30},
+			{.low = 0x341cb7d8f0c93f5f, .high = 0x6933e554315096b3},
+			{.low = 0x767d5fe0c0a0ff80, .high = 0x542984435aa6def5},
+			{.low = 0x2b977fe70080cc66, .high = 0x435469cf7bb8b25e},
+			{.low = 0x5f58cca4cd9ae0a3, .high = 0x6bba42e592c11d63},
+			{.low = 0x4c470a1d7148b3b6, .high = 0x562e9beadbcdb11c},
+			{.low = 0x3d05a1b1276d5c92, .high = 0x44f216557ca48db0},
+			{.low = 0x7b3c35e83f1560e9, .high = 0x6e5023bbfaa0e2b3},
+			{.low = 0x2f635e5365aab3ed, .high = 0x58401c96621a4ef6},
+			{.low = 0x591c4b75eaeef658, .high = 0x4699b0784e7b725e},
+			{.low = 0x74fa125644b18a26, .high = 0x70f5e726e3f8b6fd},
+			{.low = 0x43fb41de9d5ad4eb, .high = 0x5a5e5285832d5f31},
+			{.low = 0x4ffc34b2177bdd89, .high = 0x484b75379c244c27},
+			{.low = 0x4cc6bab68bf96274, .high = 0x73abeebf603a1372},
+			{.low = 0x0a38955ed6611b90, .high = 0x5c898bcc4cfb42c2},
+			{.low = 0x21c6dde5784dafa7, .high = 0x4a07a309d72f689b},
+			{.low = 0x693e2fd58d49190b, .high = 0x76729e762518a75e},
+			{.low = 0x5431bfde0aa0e0d5, .high = 0x5ec2185e8413b918},
+			{.low = 0x29c1664b3bb3e711, .high = 0x4bce79e536762dad},
+			{.low = 0x0f9bd6dec5eca4e8, .high = 0x794a5ca1f0bd15e2},
+			{.low = 0x2616457f04bd50ba, .high = 0x61084a1b26fdab1b},
+			{.low = 0x1e783798d09773c8, .high = 0x4da03b48ebfe227c},
+			{.low = 0x30c058f480f252d9, .high = 0x7c33920e46636a60},
+			{.low = 0x0d66ad9067284247, .high = 0x635c74d8384f884d},
+			{.low = 0x711ef14052869b6c, .high = 0x4f7d2a469372d370},
+			{.low = 0x34fe4ecd50d75f14, .high = 0x7f2eaa0a85848581},
+			{.low = 0x2a650bd773df7f43, .high = 0x65beee6ed136d134},
+			{.low = 0x551da312c319329c, .high = 0x51658b8bda9240f6},
+			{.low = 0x5db14f4235adc217, .high = 0x411e093caedb672b},
+			{.low = 0x7c4ee536bc49368a, .high = 0x68300ec77e2bd845},
+			{.low = 0x7d0bea92303a9208, .high = 0x5359a56c64efe037},
+			{.low = 0x173cbba8269541a0, .high = 0x42ae1df050bfe693},
+			{.low = 0x3ec792a6a422029a, .high = 0x6ab02fe6e79970eb},
+			{.low = 0x3239421ee9b4cee1, .high = 0x5559bfebec7ac0bc},
+			{.low = 0x5b6101b25490a581, .high = 0x4447ccbcbd2f0096},
+			{.low = 0x2bce691d541aa268, .high = 0x6d3fadfac84b3424},
+			{.low = 0x563eba7ddce21b87, .high = 0x576624c8a03c29b6},
+			{.low = 0x78322ecb171b4939, .high = 0x45eb50a08030215e},
+			{.low = 0x59e9e47824f87527, .high = 0x6fdee76733803564},
+			{.low = 0x6187e9f9b72d2a86, .high = 0x597f1f85c2ccf783},
+			{.low = 0x346cbb2e2c242205, .high = 0x4798e6049bd72c69},
+			{.low = 0x20adf849e039d007, .high = 0x728e3cd42c8b7a42},
+			{.low = 0x33be603b19c7d99f, .high = 0x5ba4fd768a092e9b},
+			{.low = 0x42feb3627b0647b3, .high = 0x4950cac53b3a8baf},
+			{.low = 0x5197856a5e7072b8, .high = 0x754e113b91f745e5},
+			{.low = 0x27ac6abb7ec05bc6, .high = 0x5dd80dc941929e51},
+			{.low = 0x52f05562cbcd1638, .high = 0x4b133e3a9adbb1da},
+			{.low = 0x1e4d556adfae89f3, .high = 0x781ec9f75e2c4fc4},
+			{.low = 0x7ea444557fbed4c3, .high = 0x6018a192b1bd0c9c},
+			{.low = 0x4bb69d1132ff109c, .high = 0x4ce0814227ca707d},
+			{.low = 0x5f8a94e851981a93, .high = 0x7b00ced03faa4d95},
+			{.low = 0x32d543ed0e134875, .high = 0x62670bd9cc883e11},
+			{.low = 0x5bddcff0d80f6d2b, .high = 0x4eb8d647d6d364da},
+			{.low = 0x12fc7fe7c018aeab, .high = 0x7df48a0c8aebd491},
+			{.low = 0x28c9ffec99ad5889, .high = 0x64c3a1a3a25643a7},
+			{.low = 0x0707fff07af113a1, .high = 0x509c814fb511cfb9},
+			{.low = 0x1f39998d2f2742e7, .high = 0x407d343fc40e3fc7},
+			{.low = 0x7ec28f484b7204a4, .high = 0x672eb9ffa016cc71},
+			{.low = 0x189ba5d36f8e6a1d, .high = 0x528bc7ffb345705b},
+			{.low = 0x7a161e42bfa521b1, .high = 0x42096ccc8f6ac048},
+			{.low = 0x435696d132a1cf81, .high = 0x69a8ae1418aacd41},
+			{.low = 0x1c454574288172ce, .high = 0x5486f1a9ad557101},
+			{.low = 0x169dd129ba0128a5, .high = 0x439f27baf1112734},
+			{.low = 0x242fb50f9001daa1, .high = 0x6c31d92b1b4ea520},
+			{.low = 0x368c90d940017bb4, .high = 0x568e4755af721db3},
+			{.low = 0x120a0d7a999ac95d, .high = 0x453e9f77bf8e7e29},
+			{.low = 0x50101590f5c47561, .high = 0x6eca98bf98e3fd0e},
+			{.low = 0x26734473f7d05de8, .high = 0x58a213cc7a4ffda5},
+			{.low = 0x6b8f69f65fd9e4b9, .high = 0x46e80fd6c83ffe1d},
+			{.low = 0x45b24323cc8fd45c, .high = 0x71734c8ad9fffcfc},
+			{.low = 0x6af502830a0ca9e3, .high = 0x5ac2a3a247fffd96},
+			{.low = 0x08c402026e7087e9, .high = 0x489bb61b6ccccadf},
+			{.low = 0x746cd003e3e73fdb, .high = 0x742c569247ae1164},
+			{.low = 0x76bd73364fec3315, .high = 0x5cf04541d2f1a783},
+			{.low = 0x5efdf5c50cbcf5ab, .high = 0x4a59d101758e1f9c},
+			{.low = 0x4b2fefa1adfb22ab, .high = 0x76f61b3588e365c7},
+			{.low = 0x08f3261af195b555, .high = 0x5f2b48f7a0b5eb06},
+			{.low = 0x20c284e25ade2aab, .high = 0x4c22a0c61a2b226b},
+			{.low = 0x1ad0d49d5e304444, .high = 0x79d1013cf6ab6a45},
+			{.low = 0x48a7107de4f369d0, .high = 0x617400fd9222bb6a},
+			{.low = 0x53b8d9fe50c2bb0d, .high = 0x4df6673141b562bb},
+			{.low = 0x52c15cca1ad12b48, .high = 0x7cbd71e869223792},
+			{.low = 0x75677d6e7bda8906, .high = 0x63cac186ba81c60e},
+			{.low = 0x5dec645863153a6c, .high = 0x4fd5679efb9b04d8},
+			{.low = 0x497a3a2704eec3df, .high = 0x7fbbd8fe5f5e6e27},
+	};
+}
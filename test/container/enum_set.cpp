@@ -0,0 +1,181 @@
+// container::enum_set
+#include <prometheus/container/enum_set.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+using namespace prometheus;
+
+namespace
+{
+	enum class Permission : std::uint8_t
+	{
+		READ = 0b0000'0001,
+		WRITE = 0b0000'0010,
+		EXECUTE = 0b0000'0100,
+		DELETE = 0b0001'0000,
+
+		PROMETHEUS_MAGIC_ENUM_FLAG [[maybe_unused]] = 0b1111'1111,
+	};
+
+	enum class Color : std::int8_t
+	{
+		RED = -3,
+		GREEN = 0,
+		BLUE = 4,
+	};
+
+	// 0 ~ 99
+	enum class Wide : std::uint8_t
+	{
+		FIRST = 0,
+		MIDDLE = 50,
+		LAST = 99,
+	};
+
+	using PermissionSet = container::EnumSet<Permission>;
+	using ColorSet = container::EnumSet<Color>;
+	using WideSet = container::EnumSet<Wide>;
+
+	// READ ~ DELETE => 5 bits
+	static_assert(PermissionSet::bit_count == 5);
+	static_assert(sizeof(PermissionSet) == 1);
+	// -3 ~ 4 => 8 bits
+	static_assert(ColorSet::bit_count == 8);
+	static_assert(sizeof(ColorSet) == 1);
+	// 0 ~ 99 => 2 x 64 bits
+	static_assert(WideSet::bit_count == 100);
+	static_assert(WideSet::word_count == 2);
+
+	static_assert(PermissionSet::all().size() == 4);
+	static_assert(ColorSet::all().size() == 3);
+	static_assert(WideSet::all().size() == 3);
+
+	static_assert(PermissionSet{Permission::READ, Permission::WRITE}.contains(Permission::READ));
+	static_assert(not PermissionSet{Permission::READ, Permission::WRITE}.contains(Permission::EXECUTE));
+	static_assert(ColorSet{Color::RED, Color::BLUE}.contains(Color::RED));
+	static_assert(not ColorSet{Color::RED, Color::BLUE}.contains(static_cast<Color>(42)));
+	static_assert(ColorSet{Color::RED, static_cast<Color>(42)} == ColorSet{Color::RED});
+	static_assert(WideSet{}.insert(Wide::LAST) and not WideSet{}.insert(static_cast<Wide>(100)));
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"container.enum_set"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+
+		"flag"_test = [] noexcept -> void
+		{
+			PermissionSet set{};
+			expect(set.empty()) << fatal;
+			expect(set.size() == 0_ull) << fatal;
+
+			set.insert(Permission::READ);
+			set.insert(static_cast<Permission>(std::to_underlying(Permission::WRITE) | std::to_underlying(Permission::DELETE)));
+			expect(set.size() == 3_ull) << fatal;
+			expect(set.contains(Permission::READ)) << fatal;
+			expect(set.contains(Permission::WRITE)) << fatal;
+			expect(set.contains(Permission::DELETE)) << fatal;
+			expect(not set.contains(Permission::EXECUTE)) << fatal;
+			// all bits of a combination
+			expect(set.contains(static_cast<Permission>(std::to_underlying(Permission::READ) | std::to_underlying(Permission::DELETE)))) << fatal;
+			expect(not set.contains(static_cast<Permission>(std::to_underlying(Permission::READ) | std::to_underlying(Permission::EXECUTE)))) << fatal;
+			// not a named bit
+			expect(not set.contains(static_cast<Permission>(0b1000'0000))) << fatal;
+
+			const std::vector<Permission> members{set.begin(), set.end()};
+			expect(members == std::vector{Permission::READ, Permission::WRITE, Permission::DELETE}) << fatal;
+
+			set.erase(Permission::WRITE);
+			expect(set == PermissionSet{Permission::READ, Permission::DELETE}) << fatal;
+			expect(~set == PermissionSet{Permission::WRITE, Permission::EXECUTE}) << fatal;
+
+			// out of range => ignored
+			expect(not set.insert(static_cast<Permission>(0b1000'0001))) << fatal;
+			expect(set == PermissionSet{Permission::READ, Permission::DELETE}) << fatal;
+			set.erase(static_cast<Permission>(0b1000'0001));
+			expect(set == PermissionSet{Permission::READ, Permission::DELETE}) << fatal;
+
+			set.clear();
+			expect(set.empty()) << fatal;
+			expect(set.begin() == set.end()) << fatal;
+		};
+
+		"enumeration"_test = [] noexcept -> void
+		{
+			WideSet set{Wide::FIRST, Wide::LAST};
+			expect(set.size() == 2_ull) << fatal;
+			expect(set.contains(Wide::FIRST)) << fatal;
+			expect(not set.contains(Wide::MIDDLE)) << fatal;
+			expect(set.contains(Wide::LAST)) << fatal;
+
+			// first word is empty
+			set.erase(Wide::FIRST);
+			const std::vector<Wide> members{set.begin(), set.end()};
+			expect(members == std::vector{Wide::LAST}) << fatal;
+
+			const ColorSet colors{Color::BLUE, Color::RED};
+			const std::vector<Color> color_members{colors.begin(), colors.end()};
+			expect(color_members == std::vector{Color::RED, Color::BLUE}) << fatal;
+			expect(~colors == ColorSet{Color::GREEN}) << fatal;
+		};
+
+		"operator"_test = [] noexcept -> void
+		{
+			const WideSet a{Wide::FIRST, Wide::MIDDLE};
+			const WideSet b{Wide::MIDDLE, Wide::LAST};
+
+			expect((a | b) == WideSet::all()) << fatal;
+			expect((a & b) == WideSet{Wide::MIDDLE}) << fatal;
+			expect((a ^ b) == WideSet{Wide::FIRST, Wide::LAST}) << fatal;
+			expect((a - b) == WideSet{Wide::FIRST}) << fatal;
+		};
+
+		"bulk"_test = [] noexcept -> void
+		{
+			constexpr std::size_t count = 1000;
+
+			std::vector<PermissionSet> sets(count);
+			std::vector<PermissionSet> grants(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (i % 2 == 0)
+				{
+					sets[i].insert(Permission::READ);
+				}
+				if (i % 3 == 0)
+				{
+					grants[i].insert(Permission::WRITE);
+				}
+			}
+
+			PermissionSet::unite(sets, grants);
+			expect(PermissionSet::count_superset(sets, {Permission::READ}) == value(count / 2)) << fatal;
+			expect(PermissionSet::count_superset(sets, {Permission::READ, Permission::WRITE}) == value(count / 6 + 1)) << fatal;
+			expect(PermissionSet::count_superset(sets, {}) == value(count)) << fatal;
+
+			PermissionSet::intersect(sets, PermissionSet{Permission::WRITE});
+			expect(std::ranges::all_of(sets, [](const PermissionSet& set) noexcept -> bool { return not set.contains(Permission::READ); })) << fatal;
+			expect(PermissionSet::count_superset(sets, {Permission::WRITE}) == value(count / 3 + 1)) << fatal;
+
+			PermissionSet::unite(sets, PermissionSet{Permission::EXECUTE});
+			PermissionSet::intersect(sets, grants);
+			expect(PermissionSet::count_superset(sets, {Permission::EXECUTE}) == 0_ull) << fatal;
+			expect(PermissionSet::count_superset(sets, {Permission::WRITE}) == value(count / 3 + 1)) << fatal;
+
+			// different sizes: only the common prefix is processed
+			{
+				std::vector<PermissionSet> shorter(2, PermissionSet{Permission::READ});
+				std::vector<PermissionSet> longer(4, PermissionSet{Permission::WRITE});
+
+				PermissionSet::unite(longer, shorter);
+				expect(PermissionSet::count_superset(longer, {Permission::READ, Permission::WRITE}) == 2_ull) << fatal;
+				expect(PermissionSet::count_superset(longer, {Permission::WRITE}) == 4_ull) << fatal;
+
+				PermissionSet::intersect(shorter, longer);
+				expect(PermissionSet::count_superset(shorter, {Permission::READ}) == 2_ull) << fatal;
+			}
+		};
+	};
+}
@@ -0,0 +1,491 @@
+// container::flat_hash_map
+#include <prometheus/container/container.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <memory_resource>
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+using namespace prometheus;
+
+namespace
+{
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"container.flat_hash_map"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+		using namespace container;
+
+		"insert_find_erase"_test = [] noexcept -> void
+		{
+			FlatHashMap<int, int> map{};
+			expect(map.empty()) << fatal;
+			expect(map.find(42) == map.end()) << fatal;
+			expect(not map.contains(42)) << fatal;
+			expect(map.erase(42) == 0_ull) << fatal;
+
+			for (int i = 0; i < 10'000; ++i)
+			{
+				const auto [it, inserted] = map.try_emplace(i, i * 2);
+				expect(inserted) << fatal;
+				expect(it->first == value(i)) << fatal;
+				expect(it->second == value(i * 2)) << fatal;
+			}
+			expect(map.size() == 10'000_ull) << fatal;
+			expect(map.load_factor() <= 7.f / 8) << fatal;
+
+			for (int i = 0; i < 10'000; ++i)
+			{
+				const auto [it, inserted] = map.try_emplace(i, 0);
+				expect(not inserted) << fatal;
+				expect(it->second == value(i * 2)) << fatal;
+			}
+
+			for (int i = 0; i < 10'000; i += 2)
+			{
+				expect(map.erase(i) == 1_ull) << fatal;
+			}
+			expect(map.size() == 5'000_ull) << fatal;
+
+			for (int i = 0; i < 10'000; ++i)
+			{
+				expect(map.contains(i) == (i % 2 == 1)) << fatal;
+			}
+			expect(not map.contains(-1)) << fatal;
+			expect(not map.contains(10'000)) << fatal;
+
+			map.clear();
+			expect(map.empty()) << fatal;
+			expect(map.begin() == map.end()) << fatal;
+			expect(not map.contains(1)) << fatal;
+		};
+
+		"tombstone"_test = [] noexcept -> void
+		{
+			FlatHashMap<int, int> map{};
+			map.reserve(1000);
+			const auto capacity = map.capacity();
+
+			// insert and erase keys forever, the table should not grow
+			for (int i = 0; i < 100'000; ++i)
+			{
+				map[i] = i;
+				if (i >= 500)
+				{
+					expect(map.erase(i - 500) == 1_ull) << fatal;
+				}
+			}
+
+			expect(map.size() == 500_ull) << fatal;
+			expect(map.capacity() == value(capacity)) << fatal;
+
+			for (int i = 100'000 - 500; i < 100'000; ++i)
+			{
+				expect(map.find(i)->second == value(i)) << fatal;
+			}
+		};
+
+		"randomized"_test = [] noexcept -> void
+		{
+			FlatHashMap<std::uint64_t, std::uint64_t> map{};
+			std::unordered_map<std::uint64_t, std::uint64_t> expected{};
+
+			std::uint64_t state = 42;
+			for (int i = 0; i < 200'000; ++i)
+			{
+				state = state * 6364136223846793005 + 1442695040888963407;
+				const auto key = (state >> 33) % 4096;
+
+				// the copy must keep the tombstones
+				if (i % 1000 == 0)
+				{
+					auto copy = map;
+					map = std::move(copy);
+				}
+
+				switch ((state >> 20) % 3)
+				{
+					case 0:
+					{
+						map.insert_or_assign(key, state);
+						expected.insert_or_assign(key, state);
+						break;
+					}
+					case 1:
+					{
+						expect(map.erase(key) == value(expected.erase(key))) << fatal;
+						break;
+					}
+					default:
+					{
+						const auto it = map.find(key);
+						if (const auto e = expected.find(key);
+							e == expected.end())
+						{
+							expect(it == map.end()) << fatal;
+						}
+						else
+						{
+							expect(it != map.end()) << fatal;
+							expect(it->second == value(e->second)) << fatal;
+						}
+						break;
+					}
+				}
+			}
+
+			expect(map.size() == value(expected.size())) << fatal;
+			expect(static_cast<std::size_t>(std::ranges::distance(map)) == value(expected.size())) << fatal;
+			for (const auto& [key, v]: map)
+			{
+				expect(expected.at(key) == value(v)) << fatal;
+			}
+		};
+
+		"iterator"_test = [] noexcept -> void
+		{
+			FlatHashMap<int, int> map{};
+			for (int i = 0; i < 100; ++i)
+			{
+				map.emplace(i, i);
+			}
+
+			for (auto& [key, v]: map)
+			{
+				v += 1;
+			}
+
+			// erase while iterating
+			for (auto it = map.begin(); it != map.end();)
+			{
+				if (it->first % 3 == 0)
+				{
+					it = map.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			std::vector<int> keys{};
+			for (FlatHashMap<int, int>::const_iterator it = map.cbegin(); it != map.cend(); ++it)
+			{
+				expect(it->second == value(it->first + 1)) << fatal;
+				keys.push_back(it->first);
+			}
+			std::ranges::sort(keys);
+
+			std::vector<int> expected_keys{};
+			for (int i = 0; i < 100; ++i)
+			{
+				if (i % 3 != 0)
+				{
+					expected_keys.push_back(i);
+				}
+			}
+			expect(keys == expected_keys) << fatal;
+		};
+
+		"transparent"_test = [] noexcept -> void
+		{
+			FlatHashMap<std::string, int> map{};
+
+			map["hello"] = 1;
+			map[std::string_view{"world"}] = 2;
+			map.try_emplace(std::string{"a long string which is not in the small buffer"}, 3);
+
+			expect(map.size() == 3_ull) << fatal;
+			expect(map.find(std::string_view{"hello"})->second == 1_i) << fatal;
+			expect(map.find("world")->second == 2_i) << fatal;
+			expect(map.contains(std::string_view{"a long string which is not in the small buffer"})) << fatal;
+			expect(not map.contains(std::string_view{"hello world"})) << fatal;
+
+			expect(map.erase(std::string_view{"hello"}) == 1_ull) << fatal;
+			expect(not map.contains("hello")) << fatal;
+		};
+
+		"copy_move"_test = [] noexcept -> void
+		{
+			FlatHashMap<std::string, std::string> map{};
+			for (int i = 0; i < 1000; ++i)
+			{
+				map.try_emplace(std::to_string(i), std::string(static_cast<std::size_t>(i % 50), 'x'));
+			}
+			map.erase("42");
+
+			auto copy = map;
+			expect(copy.size() == value(map.size())) << fatal;
+			for (const auto& [key, v]: map)
+			{
+				expect(copy.find(key)->second == value(v)) << fatal;
+			}
+
+			const auto moved = std::move(copy);
+			expect(moved.size() == value(map.size())) << fatal;
+			expect(moved.find("999")->second.size() == 49_ull) << fatal;
+			expect(not moved.contains("42")) << fatal;
+
+			FlatHashMap<std::string, std::string> assigned{};
+			assigned["foo"] = "bar";
+			assigned = moved;
+			expect(assigned.size() == value(map.size())) << fatal;
+			expect(not assigned.contains("foo")) << fatal;
+		};
+
+		"copy_tombstone"_test = [] noexcept -> void
+		{
+			// every key is in the same probe sequence
+			struct constant_hash
+			{
+				[[nodiscard]] constexpr auto operator()(const int) const noexcept -> std::size_t
+				{
+					return 0;
+				}
+			};
+
+			FlatHashMap<int, int, constant_hash> map{};
+			for (int i = 0; i < 20; ++i)
+			{
+				map[i] = i;
+			}
+			// the first group is full, the erased slot becomes a tombstone
+			expect(map.erase(0) == 1_ull) << fatal;
+
+			const auto check = [](const FlatHashMap<int, int, constant_hash>& m) noexcept -> void
+			{
+				expect(m.size() == 19_ull) << fatal;
+				expect(not m.contains(0)) << fatal;
+				for (int i = 1; i < 20; ++i)
+				{
+					expect(m.find(i) != m.end()) << fatal;
+					expect(m.find(i)->second == value(i)) << fatal;
+				}
+			};
+
+			const auto copy = map;
+			check(copy);
+
+			FlatHashMap<int, int, constant_hash> assigned{};
+			assigned[42] = 42;
+			assigned = map;
+			check(assigned);
+
+			// the copy can still be modified
+			auto modified = map;
+			modified[0] = 0;
+			expect(modified.erase(19) == 1_ull) << fatal;
+			expect(modified.size() == 19_ull) << fatal;
+			for (int i = 0; i < 19; ++i)
+			{
+				expect(modified.find(i)->second == value(i)) << fatal;
+			}
+		};
+
+		"convertible_key"_test = [] noexcept -> void
+		{
+			// not transparent, the key is converted to `key_type`
+			FlatHashMap<std::uint64_t, int> map{};
+
+			map[1] = 1;
+			map.try_emplace(2, 2);
+			map.insert_or_assign(3, 3);
+
+			expect(map.size() == 3_ull) << fatal;
+			expect(map.find(1) != map.end()) << fatal;
+			expect(map.find(1)->second == 1_i) << fatal;
+			expect(map.contains(2u)) << fatal;
+			expect(map.count(3) == 1_ull) << fatal;
+			expect(not map.contains(4)) << fatal;
+
+			expect(map.erase(1) == 1_ull) << fatal;
+			expect(not map.contains(1)) << fatal;
+
+			FlatHashSet<std::uint64_t> set{};
+			expect(set.insert(1).second) << fatal;
+			expect(set.contains(1)) << fatal;
+		};
+
+		"rehash_transfer"_test = [] noexcept -> void
+		{
+			struct mapped_type
+			{
+				inline static std::size_t copies = 0;
+
+				std::string value;
+
+				explicit mapped_type(std::string v) noexcept
+					: value{std::move(v)} {}
+
+				mapped_type(const mapped_type& other)
+					: value{other.value}
+				{
+					copies += 1;
+				}
+
+				mapped_type(mapped_type&&) noexcept = default;
+				auto operator=(const mapped_type&) -> mapped_type& = delete;
+				auto operator=(mapped_type&&) -> mapped_type& = delete;
+				~mapped_type() noexcept = default;
+			};
+
+			FlatHashMap<int, mapped_type> map{};
+			for (int i = 0; i < 1000; ++i)
+			{
+				map.try_emplace(i, std::to_string(i));
+			}
+
+			// the mapped values are moved (not copied) by every rehash
+			expect(mapped_type::copies == 0_ull) << fatal;
+			expect(map.size() == 1000_ull) << fatal;
+			for (int i = 0; i < 1000; ++i)
+			{
+				expect(map.find(i)->second.value == value(std::to_string(i))) << fatal;
+			}
+		};
+
+		"rehash_exception"_test = [] noexcept -> void
+		{
+			struct key_type
+			{
+				inline static std::size_t alive = 0;
+				inline static std::size_t copies_left = 0;
+
+				int value;
+
+				explicit key_type(const int v) noexcept
+					: value{v}
+				{
+					alive += 1;
+				}
+
+				// the move may throw, the rehash copies the values
+				key_type(const key_type& other)
+					: value{other.value}
+				{
+					if (copies_left == 0)
+					{
+						throw std::bad_alloc{};
+					}
+					copies_left -= 1;
+					alive += 1;
+				}
+
+				auto operator=(const key_type&) -> key_type& = delete;
+
+				~key_type() noexcept
+				{
+					alive -= 1;
+				}
+
+				[[nodiscard]] constexpr auto operator==(const key_type& other) const noexcept -> bool
+				{
+					return value == other.value;
+				}
+			};
+
+			struct key_hash
+			{
+				[[nodiscard]] constexpr auto operator()(const key_type& key) const noexcept -> std::size_t
+				{
+					return static_cast<std::size_t>(key.value);
+				}
+			};
+
+			{
+				FlatHashMap<key_type, int, key_hash> map{};
+
+				constexpr int count = 14;
+				key_type::copies_left = 1000;
+				for (int i = 0; i < count; ++i)
+				{
+					map.insert({key_type{i}, i});
+				}
+				expect(key_type::alive == value(static_cast<std::size_t>(count))) << fatal;
+
+				// the next insertion rehashes (one copy is made before), the 5th copy of the rehash throws
+				const auto capacity = map.capacity();
+				key_type::copies_left = 5;
+				bool thrown = false;
+				try
+				{
+					map.insert({key_type{count}, count});
+				}
+				catch (const std::bad_alloc&)
+				{
+					thrown = true;
+				}
+				expect(thrown) << fatal;
+
+				// the table is unchanged
+				expect(key_type::alive == value(static_cast<std::size_t>(count))) << fatal;
+				expect(map.capacity() == value(capacity)) << fatal;
+				expect(map.size() == value(static_cast<std::size_t>(count))) << fatal;
+				for (int i = 0; i < count; ++i)
+				{
+					expect(map.find(key_type{i})->second == value(i)) << fatal;
+				}
+
+				key_type::copies_left = 100;
+				map.insert({key_type{count}, count});
+				expect(map.size() == value(static_cast<std::size_t>(count + 1))) << fatal;
+			}
+			expect(key_type::alive == 0_ull) << fatal;
+		};
+
+		"erase_iterator"_test = [] noexcept -> void
+		{
+			// transparent, the iterator must not be taken as a key
+			FlatHashMap<std::string, int> map{};
+			map["hello"] = 1;
+			map["world"] = 2;
+			map["foo"] = 3;
+
+			map.erase(map.begin());
+			expect(map.size() == 2_ull) << fatal;
+			map.erase(map.cbegin());
+			expect(map.size() == 1_ull) << fatal;
+			const auto it = map.begin();
+			map.erase(it);
+			expect(map.empty()) << fatal;
+
+			FlatHashSet<std::string> set{};
+			set.insert("hello");
+			set.erase(set.begin());
+			expect(set.empty()) << fatal;
+		};
+
+		"set"_test = [] noexcept -> void
+		{
+			FlatHashSet<std::string> set{};
+
+			expect(set.insert("hello").second) << fatal;
+			expect(set.insert(std::string_view{"world"}).second) << fatal;
+			expect(not set.insert(std::string{"hello"}).second) << fatal;
+			expect(set.emplace(3, 'x').second) << fatal;
+
+			expect(set.size() == 3_ull) << fatal;
+			expect(set.contains("xxx")) << fatal;
+			expect(*set.find(std::string_view{"world"}) == value(std::string_view{"world"})) << fatal;
+		};
+
+		"pmr"_test = [] noexcept -> void
+		{
+			std::pmr::monotonic_buffer_resource resource{};
+
+			pmr::FlatHashMap<int, int> map{&resource};
+			for (int i = 0; i < 1000; ++i)
+			{
+				map[i] = i;
+			}
+			expect(map.size() == 1000_ull) << fatal;
+			expect(map.find(999)->second == 999_i) << fatal;
+		};
+	};
+}
@@ -0,0 +1,83 @@
+// functional::enumeration
+#include <prometheus/functional/enumeration.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <cstdint>
+#include <format>
+#include <string>
+
+using namespace prometheus;
+
+namespace
+{
+	enum class Permission : std::uint8_t
+	{
+		NONE = 0b0000,
+		READ = 0b0001,
+		WRITE = 0b0010,
+		EXECUTE = 0b0100,
+
+		PROMETHEUS_MAGIC_ENUM_FLAG [[maybe_unused]] = 0b0111,
+	};
+
+	enum class Color : std::uint8_t
+	{
+		RED,
+		GREEN,
+		BLUE,
+	};
+}
+
+// the full name (e.g. `(anonymous namespace)::Color::RED`) depends on the compiler
+template<>
+struct meta::user_defined::enum_name_policy<Permission>
+{
+	constexpr static auto value = meta::EnumNamePolicy::WITH_SCOPED_NAME;
+};
+
+template<>
+struct meta::user_defined::enum_name_policy<Color>
+{
+	constexpr static auto value = meta::EnumNamePolicy::WITH_SCOPED_NAME;
+};
+
+namespace
+{
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"functional.enumeration"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+		using functional::EnumWrapper;
+
+		"format.flag"_test = [] noexcept -> void
+		{
+			// single flag
+			expect(std::format("{}", Permission::READ) == value(std::string{"Permission::READ"})) << fatal;
+			expect(std::format("{}", Permission::EXECUTE) == value(std::string{"Permission::EXECUTE"})) << fatal;
+
+			// combination of flags
+			expect(std::format("{}", static_cast<Permission>(0b0011)) == value(std::string{"Permission::READ|Permission::WRITE"})) << fatal;
+			expect(std::format("[{}]", static_cast<Permission>(0b0111)) == value(std::string{"[Permission::READ|Permission::WRITE|Permission::EXECUTE]"})) << fatal;
+
+			// unnamed value (bit)
+			expect(std::format("{}", static_cast<Permission>(0b1000)) == value(std::string{"?"})) << fatal;
+			expect(std::format("{}", static_cast<Permission>(0b1001)) == value(std::string{"Permission::READ|?"})) << fatal;
+
+			// no flag
+			expect(std::format("{}", Permission::NONE) == value(std::string{})) << fatal;
+		};
+
+		"format.wrapper"_test = [] noexcept -> void
+		{
+			// flag
+			EnumWrapper<Permission> permission{Permission::READ};
+			expect(std::format("{}", permission) == value(std::string{"Permission::READ"})) << fatal;
+			permission |= Permission::EXECUTE;
+			expect(std::format("{}", permission) == value(std::string{"Permission::READ|Permission::EXECUTE"})) << fatal;
+
+			// not flag
+			expect(std::format("{}", EnumWrapper<Color>{Color::GREEN}) == value(std::string{"Color::GREEN"})) << fatal;
+			expect(std::format("{}", EnumWrapper<Color>{std::uint8_t{42}}) == value(std::string{"?"})) << fatal;
+		};
+	};
+}
@@ -0,0 +1,309 @@
+// functional::hash
+#include <prometheus/functional/hash.hpp>
+// platform::cpu
+#include <prometheus/platform/cpu.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_set>
+#include <new>
+#include <cstring>
+#include <span>
+
+using namespace prometheus;
+
+namespace
+{
+	[[nodiscard]] auto make_string(const std::size_t size) -> std::string
+	{
+		std::string result{};
+		result.reserve(size);
+
+		std::uint64_t state = 42;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			state = state * 6364136223846793005 + 1442695040888963407;
+			result.push_back(static_cast<char>(state >> 56));
+		}
+
+		return result;
+	}
+
+	// long enough to go through the accumulators
+	constexpr std::string_view long_string =
+			"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+			"Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. "
+			"Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur. "
+			"Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit anim id est laborum. "
+			"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+			"Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.";
+	static_assert(long_string.size() > functional::hash_detail::block_size);
+
+	struct packed_type
+	{
+		std::uint32_t a;
+		std::uint32_t b;
+		std::uint64_t c;
+	};
+
+	struct padded_type
+	{
+		std::uint8_t a;
+		// 3 bytes padding
+		std::uint32_t b;
+		std::uint32_t c;
+		// 4 bytes padding
+		std::uint64_t d;
+		std::uint16_t e;
+		std::uint16_t f;
+		// 4 bytes padding
+	};
+
+	struct mixed_type
+	{
+		std::uint32_t id;
+		std::uint32_t version;
+		double weight;
+		std::string name;
+		packed_type packed;
+	};
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"functional.hash"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+		using namespace functional;
+
+		"constant_evaluated"_test = [] noexcept -> void
+		{
+			constexpr auto empty = hash_64("");
+			constexpr auto short_string = hash_64("hello world");
+			constexpr auto medium_string = hash_64(long_string.substr(0, 200));
+			constexpr auto long_string_64 = hash_64(long_string);
+			constexpr auto long_string_128 = hash_128(long_string, 42);
+
+			expect(hash_64(std::string{}) == value(empty)) << fatal;
+			expect(hash_64(std::string{"hello world"}) == value(short_string)) << fatal;
+			expect(hash_64(std::string{long_string.substr(0, 200)}) == value(medium_string)) << fatal;
+			expect(hash_64(std::string{long_string}) == value(long_string_64)) << fatal;
+			expect(hash_128(std::string{long_string}, 42) == long_string_128) << fatal;
+		};
+
+		"kernel"_test = [] noexcept -> void
+		{
+			using platform::InstructionSet;
+
+			using kernel_type = auto (*)(hash_detail::accumulator_type&, const char*, std::size_t, std::size_t) noexcept -> void;
+
+			const auto string = make_string(2048);
+
+			const auto check = [&string](const kernel_type kernel) noexcept -> void
+			{
+				for (std::size_t stripes = 1; stripes <= string.size() / hash_detail::stripe_size; ++stripes)
+				{
+					for (std::size_t stripe_in_block = 0; stripe_in_block < hash_detail::stripes_per_block; ++stripe_in_block)
+					{
+						auto scalar = hash_detail::accumulator_initial;
+						auto vectorized = hash_detail::accumulator_initial;
+
+						hash_detail::accumulate_scalar(scalar, string.data(), stripes, stripe_in_block);
+						kernel(vectorized, string.data(), stripes, stripe_in_block);
+
+						expect(scalar == vectorized) << fatal;
+					}
+				}
+			};
+
+			// the kernel selected at runtime
+			check(hash_detail::accumulate_vectorized);
+
+			// every kernel supported by the CPU
+			if (platform::is_instruction_set_supported(InstructionSet::SSE42))
+			{
+				check(hash_detail::accumulate_sse);
+			}
+			if (platform::is_instruction_set_supported(InstructionSet::AVX2))
+			{
+				check(hash_detail::accumulate_avx2);
+			}
+		};
+
+		"distinct"_test = [] noexcept -> void
+		{
+			const auto string = make_string(1024);
+
+			std::unordered_set<hash_result_type> hashes{};
+			std::unordered_set<hash_result_type> seeded_hashes{};
+			std::unordered_set<hash_result_type> high_hashes{};
+			for (std::size_t size = 0; size <= string.size(); ++size)
+			{
+				const auto s = std::string_view{string}.substr(0, size);
+				const auto [low, high] = hash_128(s);
+
+				expect(low == value(hash_64(s))) << fatal;
+				expect(low != value(high)) << fatal;
+
+				hashes.insert(low);
+				seeded_hashes.insert(hash_64(s, 1337));
+				high_hashes.insert(high);
+			}
+
+			expect(hashes.size() == value(string.size() + 1)) << fatal;
+			expect(seeded_hashes.size() == value(string.size() + 1)) << fatal;
+			expect(high_hashes.size() == value(string.size() + 1)) << fatal;
+
+			for (const auto h: seeded_hashes)
+			{
+				expect(not hashes.contains(h)) << fatal;
+			}
+		};
+
+		"single_bit"_test = [] noexcept -> void
+		{
+			for (const std::size_t size: {1, 3, 4, 8, 15, 16, 17, 48, 49, 100, 256, 257, 511, 512, 513, 1000})
+			{
+				auto string = make_string(size);
+				const auto h = hash_64(string);
+
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					string[i] = static_cast<char>(string[i] ^ 1);
+					expect(hash_64(string) != value(h)) << fatal;
+					string[i] = static_cast<char>(string[i] ^ 1);
+				}
+			}
+		};
+
+		"hasher"_test = [] noexcept -> void
+		{
+			constexpr auto constant_evaluated = []() noexcept -> hash_128_result_type
+			{
+				Hasher hasher{42};
+				for (std::size_t i = 0; i < long_string.size(); i += 100)
+				{
+					hasher.update(long_string.substr(i, 100));
+				}
+				return hasher.finalize_128();
+			}();
+			expect(constant_evaluated == hash_128(long_string, 42)) << fatal;
+
+			const auto string = make_string(2048);
+
+			for (const std::size_t chunk: {1, 7, 63, 64, 65, 255, 256, 257, 1000})
+			{
+				for (std::size_t size = 0; size <= string.size(); size += (size < 600 ? 1 : 37))
+				{
+					const auto s = std::string_view{string}.substr(0, size);
+
+					Hasher hasher{1337};
+					for (std::size_t i = 0; i < size; i += chunk)
+					{
+						hasher.update(s.substr(i, chunk));
+					}
+
+					expect(hasher.size() == value(size)) << fatal;
+					expect(hasher.finalize() == value(hash_64(s, 1337))) << fatal;
+					expect(hasher.finalize_128() == hash_128(s, 1337)) << fatal;
+				}
+			}
+
+			// finalize does not change the state
+			{
+				Hasher hasher{};
+				hasher.update(std::string_view{string}.substr(0, 1000));
+				expect(hasher.finalize() == value(hash_64(std::string_view{string}.substr(0, 1000)))) << fatal;
+				hasher.update(std::as_bytes(std::span{string}.subspan(1000)));
+				expect(hasher.finalize() == value(hash_64(string))) << fatal;
+
+				hasher.reset();
+				hasher.update("hello world");
+				expect(hasher.finalize() == value(hash_64("hello world"))) << fatal;
+			}
+		};
+
+		"hash_combine"_test = [] noexcept -> void
+		{
+			expect(hash_combine_2(1, 2) != value(hash_combine_2(2, 1))) << fatal;
+			expect(hash_combine_2(0, 0) != value(hash_combine_2(0, 1))) << fatal;
+
+			// a hash equal to its secret makes the 128-bit product 0, the result must still depend on the other hash
+			expect(hash_combine_2(1, 0x8bb8'4b93'962e'acc9) != value(hash_combine_2(2, 0x8bb8'4b93'962e'acc9))) << fatal;
+			expect(hash_combine_2(0x2d35'8dcc'aa6c'78a5, 1) != value(hash_combine_2(0x2d35'8dcc'aa6c'78a5, 2))) << fatal;
+			expect(hash_combine(1, 2, 0x8bb8'4b93'962e'acc9ull) != value(hash_combine(3, 4, 0x8bb8'4b93'962e'acc9ull))) << fatal;
+
+			const std::string a{"hello"};
+			const std::string b{"world"};
+
+			expect(hash_combine(a, b) == value(hash_combine_2(hash_64(a), hash_64(b)))) << fatal;
+			expect(hash_combine(a, b, 42) == value(hash_combine_2(hash_combine_2(hash_64(a), hash_64(b)), std::hash<int>{}(42)))) << fatal;
+			expect(hash_combine(a, b) != value(hash_combine(b, a))) << fatal;
+
+			// low bits of sequential keys
+			std::unordered_set<hash_result_type> buckets{};
+			for (std::uint64_t i = 0; i < 256; ++i)
+			{
+				buckets.insert(hash_combine_2(i, i) & 0xff);
+			}
+			expect(buckets.size() > 128_ull) << fatal;
+		};
+
+		"hash_of"_test = [] noexcept -> void
+		{
+			// one memory block
+			{
+				constexpr packed_type packed{.a = 1, .b = 2, .c = 3};
+				constexpr auto h = hash_of(packed);
+
+				expect(hash_of(packed) == value(h)) << fatal;
+				expect(h == value(hash_64({reinterpret_cast<const char*>(&packed), sizeof(packed)}))) << fatal;
+				expect(hash_of(packed, 42) != value(h)) << fatal;
+				expect(hash_of(packed_type{.a = 2, .b = 1, .c = 3}) != value(h)) << fatal;
+			}
+
+			// the padding bytes are ignored
+			{
+				constexpr padded_type padded{.a = 1, .b = 2, .c = 3, .d = 4, .e = 5, .f = 6};
+				constexpr auto h = hash_of(padded);
+
+				alignas(padded_type) unsigned char storage_1[sizeof(padded_type)];
+				alignas(padded_type) unsigned char storage_2[sizeof(padded_type)];
+				std::memset(storage_1, 0x00, sizeof(storage_1));
+				std::memset(storage_2, 0xff, sizeof(storage_2));
+
+				const auto* p1 = ::new(storage_1) padded_type{padded};
+				const auto* p2 = ::new(storage_2) padded_type{padded};
+
+				expect(hash_of(*p1) == value(h)) << fatal;
+				expect(hash_of(*p2) == value(h)) << fatal;
+				expect(hash_of(padded_type{.a = 1, .b = 2, .c = 3, .d = 4, .e = 5, .f = 7}) != value(h)) << fatal;
+			}
+
+			// nested
+			{
+				const mixed_type m1{.id = 1, .version = 2, .weight = 0.0, .name = "hello", .packed = {.a = 1, .b = 2, .c = 3}};
+				const mixed_type m2{.id = 1, .version = 2, .weight = -0.0, .name = "hello", .packed = {.a = 1, .b = 2, .c = 3}};
+				const mixed_type m3{.id = 1, .version = 2, .weight = 0.0, .name = "world", .packed = {.a = 1, .b = 2, .c = 3}};
+				const mixed_type m4{.id = 1, .version = 2, .weight = 0.0, .name = "hello", .packed = {.a = 1, .b = 2, .c = 4}};
+
+				expect(hash_of(m1) == value(hash_of(m2))) << fatal;
+				expect(hash_of(m1) != value(hash_of(m3))) << fatal;
+				expect(hash_of(m1) != value(hash_of(m4))) << fatal;
+			}
+		};
+
+		"string"_test = [] noexcept -> void
+		{
+			constexpr auto h = hash<std::string>;
+
+			const std::string string{"hello world"};
+			const std::vector<char> vector{string.begin(), string.end()};
+
+			expect(h(string) == value(hash_64("hello world"))) << fatal;
+			expect(h(std::string_view{string}) == value(hash_64("hello world"))) << fatal;
+			expect(h("hello world") == value(hash_64("hello world"))) << fatal;
+			expect(h(vector) == value(hash_64("hello world"))) << fatal;
+		};
+	};
+}
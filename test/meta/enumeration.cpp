@@ -39,6 +39,32 @@ namespace
 		E4 = 4,
 	};
 
+	// sparse
+	enum class SparseEnum : std::uint8_t
+	{
+		E1 = 3,
+		E2 = 50,
+		E3 = 100,
+		E4 = 250,
+	};
+
+	// signed
+	enum class SignedEnum : std::int8_t
+	{
+		E1 = -100,
+		E2 = -1,
+		E3 = 0,
+		E4 = 100,
+	};
+
+	// explicit range (see below)
+	enum class WideEnum : std::uint16_t
+	{
+		E1 = 0,
+		E2 = 1000,
+		E3 = 1023,
+	};
+
 	enum FreeFlag0 : std::uint8_t
 	{
 		FF0_F0 = 0b0000,
@@ -90,6 +116,13 @@ namespace
 	};
 }
 
+template<>
+struct meta::user_defined::enum_range<WideEnum>
+{
+	constexpr static auto min = 0;
+	constexpr static auto max = 1023;
+};
+
 template<>
 struct meta::user_defined::enum_is_flag<FreeFlag0> : std::true_type {};
 
@@ -113,6 +146,12 @@ namespace
 	static_assert(meta::min_value_of<ScopedEnum1>() == ScopedEnum1::E1);
 	static_assert(meta::max_value_of<ScopedEnum1>() == ScopedEnum1::E4);
 
+	static_assert(meta::min_value_of<SignedEnum>() == SignedEnum::E1);
+	static_assert(meta::max_value_of<SignedEnum>() == SignedEnum::E4);
+
+	static_assert(meta::min_value_of<WideEnum>() == WideEnum::E1);
+	static_assert(meta::max_value_of<WideEnum>() == WideEnum::E3);
+
 	static_assert(meta::min_value_of<FreeFlag0>() == FF0_F0);
 	static_assert(meta::max_value_of<FreeFlag0>() == FF0_F6);
 
@@ -192,6 +231,25 @@ namespace
 	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(ScopedFlag1::F3 | ScopedFlag1::F4) == "ScopedFlag1::F6");
 	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(static_cast<ScopedFlag1>(std::to_underlying(ScopedFlag1::F6) + 1)) == meta::enum_name_not_found);
 
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SparseEnum::E1) == "SparseEnum::E1");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SparseEnum::E2) == "SparseEnum::E2");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SparseEnum::E3) == "SparseEnum::E3");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SparseEnum::E4) == "SparseEnum::E4");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(static_cast<SparseEnum>(0)) == meta::enum_name_not_found);
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(static_cast<SparseEnum>(51)) == meta::enum_name_not_found);
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(static_cast<SparseEnum>(255)) == meta::enum_name_not_found);
+
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SignedEnum::E1) == "SignedEnum::E1");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SignedEnum::E2) == "SignedEnum::E2");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SignedEnum::E3) == "SignedEnum::E3");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(SignedEnum::E4) == "SignedEnum::E4");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(static_cast<SignedEnum>(-128)) == meta::enum_name_not_found);
+
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(WideEnum::E1) == "WideEnum::E1");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(WideEnum::E2) == "WideEnum::E2");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(WideEnum::E3) == "WideEnum::E3");
+	static_assert(meta::name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(static_cast<WideEnum>(1024)) == meta::enum_name_not_found);
+
 	// ==========================================================================
 	// full_name_of
 
@@ -213,6 +271,32 @@ namespace
 	static_assert(test_full_name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(ScopedFlag1::F5, "ScopedFlag1::F1/ScopedFlag1::F2", "/"));
 	static_assert(test_full_name_of<meta::EnumNamePolicy::WITH_SCOPED_NAME>(ScopedFlag1::F6, "ScopedFlag1::F3/ScopedFlag1::F4", "/"));
 
+	// ==========================================================================
+	// full_name_size / full_name_to
+
+	template<meta::EnumNamePolicy Policy, std::size_t BufferSize, typename EnumType>
+	[[nodiscard]] constexpr auto test_full_name_to(const EnumType e, const std::string_view expected, const std::string_view split) noexcept -> bool
+	{
+		std::array<char, BufferSize> buffer{};
+
+		const auto size = meta::full_name_to<Policy>(std::span{buffer}, e, split);
+		if (size != expected.size() or size != meta::full_name_size<Policy>(e, split))
+		{
+			return false;
+		}
+
+		const auto written = std::ranges::min(size, BufferSize);
+		return std::string_view{buffer.data(), written} == expected.substr(0, written);
+	}
+
+	static_assert(test_full_name_to<meta::EnumNamePolicy::VALUE_ONLY, 32>(FF0_F5, "FF0_F1-FF0_F2", "-"));
+	static_assert(test_full_name_to<meta::EnumNamePolicy::VALUE_ONLY, 13>(FF0_F6, "FF0_F3-FF0_F4", "-"));
+	// truncated
+	static_assert(test_full_name_to<meta::EnumNamePolicy::VALUE_ONLY, 8>(FF0_F6, "FF0_F3-FF0_F4", "-"));
+	static_assert(test_full_name_to<meta::EnumNamePolicy::VALUE_ONLY, 0>(FF0_F6, "FF0_F3-FF0_F4", "-"));
+	static_assert(test_full_name_to<meta::EnumNamePolicy::WITH_SCOPED_NAME, 64>(ScopedFlag1::F5, "ScopedFlag1::F1/ScopedFlag1::F2", "/"));
+	static_assert(test_full_name_to<meta::EnumNamePolicy::VALUE_ONLY, 8>(static_cast<ScopedFlag0>(0), "", "-"));
+
 	// ==========================================================================
 	// value_of
 
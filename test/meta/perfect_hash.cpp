@@ -0,0 +1,79 @@
+// meta::perfect_hash
+#include <prometheus/meta/perfect_hash.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+
+using namespace prometheus;
+
+namespace
+{
+	constexpr auto methods = meta::make_perfect_hash<"GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH">();
+
+	static_assert(methods.size() == 9);
+	static_assert(methods.index_of("GET") == 0);
+	static_assert(methods.index_of("POST") == 2);
+	static_assert(methods.index_of("PATCH") == 8);
+	static_assert(methods.index_of("get") == methods.npos);
+	static_assert(methods.index_of("") == methods.npos);
+	static_assert(not methods.contains("GET "));
+
+	constexpr std::array<std::string_view, 0> no_keys{};
+	constexpr auto empty = meta::make_perfect_hash(no_keys);
+
+	static_assert(empty.index_of("") == empty.npos);
+	static_assert(empty.index_of("GET") == empty.npos);
+
+	constexpr std::array<std::string_view, 1> one_key{""};
+	constexpr auto one = meta::make_perfect_hash(one_key);
+
+	static_assert(one.index_of("") == 0);
+	static_assert(one.index_of("GET") == one.npos);
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"meta.perfect_hash"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+
+		"keywords"_test = [] noexcept -> void
+		{
+			std::vector<std::string> strings{};
+			for (int i = 0; i < 500; ++i)
+			{
+				strings.push_back("keyword_" + std::to_string(i));
+			}
+
+			std::array<std::string_view, 500> keys{};
+			std::ranges::copy(strings, keys.begin());
+
+			const auto table = meta::make_perfect_hash(keys);
+
+			for (std::size_t i = 0; i < keys.size(); ++i)
+			{
+				expect(table.index_of(keys[i]) == value(i)) << fatal;
+				expect(table.index_of(std::string{keys[i]}) == value(i)) << fatal;
+			}
+
+			for (int i = 500; i < 5000; ++i)
+			{
+				expect(not table.contains("keyword_" + std::to_string(i))) << fatal;
+			}
+			expect(not table.contains("")) << fatal;
+			expect(not table.contains("keyword_")) << fatal;
+		};
+
+		"runtime"_test = [] noexcept -> void
+		{
+			const std::string get{"GET"};
+			const std::string patch{"PATCH"};
+			const std::string unknown{"UNKNOWN"};
+
+			expect(methods.index_of(get) == 0_ull) << fatal;
+			expect(methods.index_of(patch) == 8_ull) << fatal;
+			expect(methods.index_of(unknown) == value(methods.npos)) << fatal;
+		};
+	};
+}
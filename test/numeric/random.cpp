@@ -0,0 +1,299 @@
+// numeric::random
+#include <prometheus/numeric/random.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <thread>
+
+using namespace prometheus;
+
+namespace
+{
+	template<typename T>
+	using normal_distribution = std::normal_distribution<T>;
+
+	template<typename Random, typename T>
+	[[nodiscard]] auto fill_in_range(Random& random, const T from, const T to) noexcept -> bool
+	{
+		std::vector<T> values(10'000);
+		random.template fill<T>(values, from, to);
+
+		return std::ranges::all_of(
+			values,
+			[from, to](const T value) noexcept -> bool
+			{
+				return value >= from and value <= to;
+			}
+		);
+	}
+
+	// the first values of substream `index` of `seed`
+	template<typename Engine>
+	[[nodiscard]] auto substream(const std::uint64_t seed, const std::size_t index) noexcept -> std::vector<typename Engine::result_type>
+	{
+		Engine engine{static_cast<typename numeric::Random<numeric::RandomStateCategory::PRIVATE, Engine>::seed_type>(seed)};
+		for (std::size_t i = 0; i < index; ++i)
+		{
+			engine.long_jump();
+		}
+
+		std::vector<typename Engine::result_type> values(100);
+		for (auto& v: values)
+		{
+			v = engine();
+		}
+		return values;
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"numeric.random"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+
+		"fill.integer"_test = [] noexcept -> void
+		{
+			numeric::Random<> random{};
+			random.seed(42);
+
+			expect(fill_in_range<numeric::Random<>, short>(random, -100, 100)) << fatal;
+			expect(fill_in_range<numeric::Random<>, std::uint16_t>(random, 1, 3)) << fatal;
+			expect(fill_in_range<numeric::Random<>, int>(random, -1'000'000, 1'000'000)) << fatal;
+			expect(fill_in_range<numeric::Random<>, std::uint64_t>(random, 0, (std::uint64_t{1} << 63) + 1)) << fatal;
+			expect(fill_in_range<numeric::Random<>, std::int64_t>(random, std::numeric_limits<std::int64_t>::min(), -1)) << fatal;
+
+			// every value
+			std::array<int, 1000> values{};
+			random.fill<int>(values, 5, -5);
+			for (int i = -5; i <= 5; ++i)
+			{
+				expect(std::ranges::find(values, i) != values.end()) << fatal;
+			}
+
+			// same seed => same values
+			numeric::Random<> a{};
+			a.seed(1337);
+			numeric::Random<> b{};
+			b.seed(1337);
+			std::array<std::uint32_t, 1000> values_a{};
+			std::array<std::uint32_t, 1000> values_b{};
+			a.fill<std::uint32_t>(values_a, 0, 99);
+			b.fill<std::uint32_t>(values_b, 0, 99);
+			expect(values_a == values_b) << fatal;
+
+			// [from, from]
+			random.fill<int>(values, 7, 7);
+			expect(std::ranges::all_of(values, [](const int value) noexcept -> bool { return value == 7; })) << fatal;
+		};
+
+		"fill.full_range"_test = [] noexcept -> void
+		{
+			// all values of the engine's result_type, no bound
+			numeric::random_engine_xrsr_128_star_star engine{42};
+			numeric::Random<> random{};
+			random.seed(42);
+
+			std::array<std::uint64_t, 1000> values{};
+			random.fill<std::uint64_t>(values, 0, std::numeric_limits<std::uint64_t>::max());
+			for (const auto v: values)
+			{
+				expect(v == value(engine())) << fatal;
+			}
+		};
+
+		"fill.floating_point"_test = [] noexcept -> void
+		{
+			numeric::Random<> random{};
+			random.seed(42);
+
+			std::vector<double> doubles(10'000);
+			random.fill<double>(doubles, 0, 1);
+			expect(std::ranges::all_of(doubles, [](const double value) noexcept -> bool { return value >= 0 and value < 1; })) << fatal;
+			expect(std::ranges::any_of(doubles, [](const double value) noexcept -> bool { return value < .01; })) << fatal;
+			expect(std::ranges::any_of(doubles, [](const double value) noexcept -> bool { return value > .99; })) << fatal;
+
+			std::vector<float> floats(10'000);
+			random.fill<float>(floats, 3, -2);
+			expect(std::ranges::all_of(floats, [](const float value) noexcept -> bool { return value >= -2 and value <= 3; })) << fatal;
+			expect(std::ranges::any_of(floats, [](const float value) noexcept -> bool { return value < -1.9f; })) << fatal;
+			expect(std::ranges::any_of(floats, [](const float value) noexcept -> bool { return value > 2.9f; })) << fatal;
+
+			// 32-bit words
+			numeric::Random<numeric::RandomStateCategory::PRIVATE, numeric::random_engine_xsr_128_plus_plus> random_32{};
+			random_32.seed(42);
+			random_32.fill<float>(floats, 0, 1);
+			expect(std::ranges::all_of(floats, [](const float value) noexcept -> bool { return value >= 0 and value < 1; })) << fatal;
+			random_32.fill<double>(doubles, 0, 1);
+			expect(std::ranges::all_of(doubles, [](const double value) noexcept -> bool { return value >= 0 and value <= 1; })) << fatal;
+		};
+
+		"fill.distribution"_test = [] noexcept -> void
+		{
+			numeric::Random<numeric::RandomStateCategory::PRIVATE, numeric::random_engine_xrsr_128_star_star, numeric::default_int_distribution, normal_distribution> random{};
+			random.seed(42);
+			numeric::random_engine_xrsr_128_star_star engine{42};
+			normal_distribution<double> distribution{0, 1};
+
+			std::array<double, 100> values{};
+			random.fill<double>(values, 0, 1);
+			for (const auto v: values)
+			{
+				expect(v == value(distribution(engine))) << fatal;
+			}
+		};
+
+		"generate_n"_test = [] noexcept -> void
+		{
+			numeric::Random<> random{};
+			random.seed(42);
+
+			std::vector<int> values{};
+			random.generate_n<int>(std::back_inserter(values), 1000, -10, 10);
+			expect(values.size() == 1000_ull) << fatal;
+			expect(std::ranges::all_of(values, [](const int value) noexcept -> bool { return value >= -10 and value <= 10; })) << fatal;
+
+			std::array<int, 1000> array{};
+			const auto end = random.generate_n<int>(array.begin(), 500, 1, 10);
+			expect(end == array.begin() + 500) << fatal;
+			expect(std::ranges::all_of(array.begin(), end, [](const int value) noexcept -> bool { return value >= 1 and value <= 10; })) << fatal;
+			expect(std::ranges::all_of(end, array.end(), [](const int value) noexcept -> bool { return value == 0; })) << fatal;
+
+			// container
+			const auto container = random.get<std::vector<int>, int>(0, 9, 1000);
+			expect(container.size() == 1000_ull) << fatal;
+			expect(std::ranges::all_of(container, [](const int value) noexcept -> bool { return value >= 0 and value <= 9; })) << fatal;
+		};
+
+		"shared"_test = [] noexcept -> void
+		{
+			using random_type = numeric::Random<numeric::RandomStateCategory::SHARED_THREAD_ONLY>;
+
+			std::array<unsigned short, 1000> values{};
+			random_type::fill<unsigned short>(values, 10, 20);
+			expect(std::ranges::all_of(values, [](const unsigned short value) noexcept -> bool { return value >= 10 and value <= 20; })) << fatal;
+
+			std::vector<double> doubles{};
+			random_type::generate_n<double>(std::back_inserter(doubles), 1000, -1, 1);
+			expect(std::ranges::all_of(doubles, [](const double value) noexcept -> bool { return value >= -1 and value <= 1; })) << fatal;
+		};
+
+		"thread_stream"_test = [] noexcept -> void
+		{
+			using engine_type = numeric::random_engine_xsr_256_plus_plus;
+			using random_type = numeric::Random<numeric::RandomStateCategory::SHARED_THREAD_STREAM, engine_type>;
+			using result_type = engine_type::result_type;
+
+			const auto draw = []() noexcept -> std::vector<result_type>
+			{
+				std::vector<result_type> values(100);
+				random_type::fill<result_type>(values, 0, std::numeric_limits<result_type>::max());
+				return values;
+			};
+
+			// substream 0, 1, 2
+			random_type::seed(42);
+			expect(draw() == substream<engine_type>(42, 0)) << fatal;
+			std::vector<result_type> values{};
+			std::jthread{[&values, draw] noexcept -> void { values = draw(); }}.join();
+			expect(values == substream<engine_type>(42, 1)) << fatal;
+			std::jthread{[&values, draw] noexcept -> void { values = draw(); }}.join();
+			expect(values == substream<engine_type>(42, 2)) << fatal;
+
+			// seed again => substream 0
+			random_type::seed(42);
+			expect(draw() == substream<engine_type>(42, 0)) << fatal;
+
+			// concurrently, each thread has its own substream
+			random_type::seed(1337);
+			constexpr std::size_t thread_count = 8;
+			std::vector<std::vector<result_type>> thread_values(thread_count);
+			{
+				std::vector<std::jthread> threads{};
+				for (auto& v: thread_values)
+				{
+					threads.emplace_back([&v, draw] noexcept -> void { v = draw(); });
+				}
+			}
+			for (std::size_t index = 0; index < thread_count; ++index)
+			{
+				expect(std::ranges::count(thread_values, substream<engine_type>(1337, index)) == value(std::ptrdiff_t{1})) << fatal;
+			}
+
+			// counter-based
+			{
+				using philox_type = numeric::random_engine_philox_4x32;
+				using philox_random_type = numeric::Random<numeric::RandomStateCategory::SHARED_THREAD_STREAM, philox_type>;
+
+				const auto draw_philox = []() noexcept -> std::vector<philox_type::result_type>
+				{
+					std::vector<philox_type::result_type> v(100);
+					philox_random_type::fill<philox_type::result_type>(v, 0, std::numeric_limits<philox_type::result_type>::max());
+					return v;
+				};
+
+				constexpr std::uint64_t wide_seed = 0x1234'5678'0000'002a;
+				philox_random_type::seed(wide_seed);
+				expect(draw_philox() == substream<philox_type>(wide_seed, 0)) << fatal;
+				std::vector<philox_type::result_type> v{};
+				std::jthread{[&v, draw_philox] noexcept -> void { v = draw_philox(); }}.join();
+				expect(v == substream<philox_type>(wide_seed, 1)) << fatal;
+			}
+		};
+
+		"lanes"_test = [] noexcept -> void
+		{
+			using engine_type = numeric::random_engine_x8<numeric::random_engine_xsr_256_plus_plus>;
+
+			// fill => engine_type::generate
+			numeric::Random<numeric::RandomStateCategory::PRIVATE, engine_type> random{engine_type{42}};
+			engine_type engine{42};
+
+			std::vector<std::uint64_t> values(1001);
+			random.fill<std::uint64_t>(values, 0, std::numeric_limits<std::uint64_t>::max());
+			for (const auto v: values)
+			{
+				expect(v == value(engine())) << fatal;
+			}
+
+			random.fill<std::uint64_t>(values, 0, 99);
+			expect(std::ranges::all_of(values, [](const std::uint64_t v) noexcept -> bool { return v <= 99; })) << fatal;
+		};
+
+		"counter_based"_test = [] noexcept -> void
+		{
+			using engine_type = numeric::random_engine_philox_4x32;
+			using result_type = engine_type::result_type;
+
+			// fill => engine_type::generate
+			numeric::Random<numeric::RandomStateCategory::PRIVATE, engine_type> random{};
+			random.seed(42);
+			const engine_type engine{42};
+
+			std::vector<result_type> values(1001);
+			random.fill<result_type>(values, 0, std::numeric_limits<result_type>::max());
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				expect(values[i] == value(engine.at(i))) << fatal;
+			}
+
+			std::vector<double> doubles(1001);
+			random.fill<double>(doubles, -1, 1);
+			expect(std::ranges::all_of(doubles, [](const double v) noexcept -> bool { return v >= -1 and v <= 1; })) << fatal;
+
+			// the whole 64-bit seed is the key
+			constexpr std::uint64_t wide_seed = 0x1234'5678'0000'002a;
+			random.seed(wide_seed);
+			random.fill<result_type>(values, 0, std::numeric_limits<result_type>::max());
+			const engine_type wide_engine{wide_seed};
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				expect(values[i] == value(wide_engine.at(i))) << fatal;
+			}
+			expect(values[0] != value(engine.at(0))) << fatal;
+		};
+	};
+}
@@ -0,0 +1,214 @@
+// numeric::random_engine
+#include <prometheus/numeric/random_engine.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace prometheus;
+
+namespace
+{
+	template<typename Engine>
+	[[nodiscard]] auto discard_matches_next(const std::uint64_t count) noexcept -> bool
+	{
+		Engine stepped{42};
+		Engine discarded{42};
+
+		for (std::uint64_t i = 0; i < count; ++i)
+		{
+			stepped.next();
+		}
+		discarded.discard(count);
+
+		return stepped.peek() == discarded.peek() and stepped.next() == discarded.next();
+	}
+
+	template<typename Engine>
+	[[nodiscard]] auto discard_matches_jump() noexcept -> bool
+	{
+		Engine jumped{42};
+		Engine discarded{42};
+
+		jumped.jump();
+		// 2 ^ 64 / 2 + 2 ^ 64 / 2
+		discarded.discard(std::uint64_t{1} << 63);
+		discarded.discard(std::uint64_t{1} << 63);
+
+		return jumped.next() == discarded.next();
+	}
+
+	template<typename Engine>
+	[[nodiscard]] auto long_jump_count_matches_long_jumps(const std::uint64_t count) noexcept -> bool
+	{
+		Engine stepped{42};
+		Engine jumped{42};
+
+		for (std::uint64_t i = 0; i < count; ++i)
+		{
+			stepped.long_jump();
+		}
+		jumped.long_jump(count);
+
+		return stepped.next() == jumped.next() and stepped.next() == jumped.next();
+	}
+
+	// lane `i` => the engine jumped `i` times
+	template<typename Engine, std::size_t Lanes>
+	[[nodiscard]] auto lanes_match_jumped_engines(const std::size_t steps) noexcept -> bool
+	{
+		numeric::RandomEngineLanes<Engine, Lanes> lanes{42};
+
+		std::vector<typename Engine::result_type> expected(steps * Lanes);
+
+		for (std::size_t lane = 0; lane < Lanes; ++lane)
+		{
+			Engine copy{42};
+			for (std::size_t jump = 0; jump < lane; ++jump)
+			{
+				copy.jump();
+			}
+
+			for (std::size_t step = 0; step < steps; ++step)
+			{
+				expected[step * Lanes + lane] = copy.next();
+			}
+		}
+
+		// generate (vectorized) and next (buffered) mixed, with partial steps
+		std::vector<typename Engine::result_type> actual(steps * Lanes);
+		actual[0] = lanes.next();
+		lanes.generate({actual.data() + 1, Lanes + 1});
+		lanes.generate({actual.data() + Lanes + 2, actual.size() - Lanes - 3});
+		actual.back() = lanes();
+
+		return actual == expected;
+	}
+
+	// Random123 known answers (kat_vectors, philox4x32 10 rounds)
+	static_assert(
+		numeric::random_engine_detail::philox::block({0, 0, 0, 0}, {0, 0}) ==
+		numeric::RandomEnginePhilox::block_type{0x6627'e8d5, 0xe169'c58d, 0xbc57'ac4c, 0x9b00'dbd8}
+	);
+	static_assert(
+		numeric::random_engine_detail::philox::block({0xffff'ffff, 0xffff'ffff, 0xffff'ffff, 0xffff'ffff}, {0xffff'ffff, 0xffff'ffff}) ==
+		numeric::RandomEnginePhilox::block_type{0x408f'276d, 0x41c8'3b0e, 0xa20b'c7c6, 0x6d54'51fd}
+	);
+	static_assert(
+		numeric::random_engine_detail::philox::block({0x243f'6a88, 0x85a3'08d3, 0x1319'8a2e, 0x0370'7344}, {0xa409'3822, 0x299f'31d0}) ==
+		numeric::RandomEnginePhilox::block_type{0xd16c'fe09, 0x94fd'cceb, 0x5001'e420, 0x2412'6ea1}
+	);
+
+	// seed 0 => key {0, 0}, value 0 ~ 3 => counter {0, 0, 0, 0}
+	static_assert(numeric::RandomEnginePhilox{0}.at(2) == 0xbc57'ac4c);
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"numeric.random_engine"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+
+		"discard"_test = [] noexcept -> void
+		{
+			for (const std::uint64_t count: {0ull, 1ull, 7ull, 1000ull, 300'007ull})
+			{
+				expect(discard_matches_next<numeric::random_engine_xsr_128_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_128_plus_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_128_star_star>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xrsr_128_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xrsr_128_plus_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xrsr_128_star_star>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_256_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_256_plus_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_256_star_star>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_512_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_512_plus_plus>(count) == value(true)) << fatal;
+				expect(discard_matches_next<numeric::random_engine_xsr_512_star_star>(count) == value(true)) << fatal;
+			}
+		};
+
+		"discard jump"_test = [] noexcept -> void
+		{
+			// jump() of the 128-bit generators is 2 ^ 64 steps
+			expect(discard_matches_jump<numeric::random_engine_xsr_128_plus>() == value(true)) << fatal;
+			expect(discard_matches_jump<numeric::random_engine_xrsr_128_plus>() == value(true)) << fatal;
+			expect(discard_matches_jump<numeric::random_engine_xrsr_128_plus_plus>() == value(true)) << fatal;
+			expect(discard_matches_jump<numeric::random_engine_xrsr_128_star_star>() == value(true)) << fatal;
+		};
+
+		"long_jump count"_test = [] noexcept -> void
+		{
+			for (const std::uint64_t count: {0, 1, 2, 3, 7, 16, 37})
+			{
+				expect(long_jump_count_matches_long_jumps<numeric::random_engine_xsr_128_plus>(count) == value(true)) << fatal;
+				expect(long_jump_count_matches_long_jumps<numeric::random_engine_xrsr_128_star_star>(count) == value(true)) << fatal;
+				expect(long_jump_count_matches_long_jumps<numeric::random_engine_xsr_256_plus_plus>(count) == value(true)) << fatal;
+				expect(long_jump_count_matches_long_jumps<numeric::random_engine_xsr_512_star_star>(count) == value(true)) << fatal;
+				expect(long_jump_count_matches_long_jumps<numeric::random_engine_philox_4x32>(count) == value(true)) << fatal;
+			}
+		};
+
+		"lanes"_test = [] noexcept -> void
+		{
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_128_plus_plus, 4>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_128_star_star, 16>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xrsr_128_plus, 8>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xrsr_128_plus_plus, 16>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xrsr_128_star_star, 4>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_256_plus, 4>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_256_plus_plus, 8>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_256_star_star, 16>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_512_plus_plus, 8>(100) == value(true)) << fatal;
+			expect(lanes_match_jumped_engines<numeric::random_engine_xsr_512_star_star, 16>(100) == value(true)) << fatal;
+		};
+
+		"philox"_test = [] noexcept -> void
+		{
+			using engine_type = numeric::random_engine_philox_4x32;
+			using result_type = engine_type::result_type;
+
+			constexpr std::size_t count = 1000;
+
+			engine_type engine{0x1234'5678'9abc'def0};
+
+			std::vector<result_type> expected(count);
+			for (auto& v: expected)
+			{
+				v = engine.next();
+			}
+			expect(engine.position() == value(std::uint64_t{count})) << fatal;
+
+			// random access
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				expect(engine.at(i) == value(expected[i])) << fatal;
+			}
+
+			// range (vectorized), unaligned first / size
+			for (const std::size_t first: {0uz, 1uz, 3uz, 4uz, 37uz})
+			{
+				std::vector<result_type> actual(count - first - 5);
+				engine.at(first, actual);
+				expect(std::ranges::equal(actual, std::span{expected}.subspan(first, actual.size()))) << fatal;
+			}
+
+			// generate and next mixed, discard
+			engine.seed(0x1234'5678'9abc'def0);
+			std::vector<result_type> actual(count);
+			actual[0] = engine.next();
+			engine.generate({actual.data() + 1, 6});
+			engine.discard(100);
+			engine.generate({actual.data() + 107, actual.size() - 108});
+			actual.back() = engine();
+			expect(std::ranges::equal(std::span{actual}.first(7), std::span{expected}.first(7))) << fatal;
+			expect(std::ranges::equal(std::span{actual}.subspan(107), std::span{expected}.subspan(107))) << fatal;
+
+			// jump => another stream at the same position
+			engine_type jumped{0x1234'5678'9abc'def0};
+			jumped.jump();
+			expect(jumped.position() == 0_ull) << fatal;
+			expect(jumped.at(0) != value(expected[0])) << fatal;
+			jumped.discard(5);
+			expect(jumped.next() == value(jumped.at(5))) << fatal;
+		};
+	};
+}
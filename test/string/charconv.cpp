@@ -0,0 +1,543 @@
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstring>
+#include <charconv>
+
+// string::charconv
+#include <prometheus/string/string.hpp>
+// platform::cpu
+#include <prometheus/platform/cpu.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+using namespace prometheus;
+
+namespace
+{
+	// character by character, as the kernels must behave
+	namespace reference
+	{
+		template<typename Predicate>
+		[[nodiscard]] auto all_of(const std::string_view s, Predicate predicate) noexcept -> bool
+		{
+			return std::ranges::all_of(s, predicate);
+		}
+
+		[[nodiscard]] auto to_upper(const std::string_view s) noexcept -> std::string
+		{
+			std::string result{};
+			for (const auto c: s)
+			{
+				result.push_back(string::to_upper(c));
+			}
+			return result;
+		}
+
+		[[nodiscard]] auto to_lower(const std::string_view s) noexcept -> std::string
+		{
+			std::string result{};
+			for (const auto c: s)
+			{
+				result.push_back(string::to_lower(c));
+			}
+			return result;
+		}
+
+		[[nodiscard]] auto to_title(const std::string_view s) noexcept -> std::string
+		{
+			std::string result{};
+			bool first = true;
+			for (const auto c: s)
+			{
+				if (first)
+				{
+					result.push_back(string::to_upper(c));
+					first = false;
+				}
+				else if (c == ' ')
+				{
+					result.push_back(c);
+					first = true;
+				}
+				else
+				{
+					result.push_back(string::to_lower(c));
+				}
+			}
+			return result;
+		}
+	}
+
+	// Lengths that cover every kernel width and tail, the characters are picked from `alphabet`.
+	[[nodiscard]] auto make_strings(const std::string_view alphabet) -> std::vector<std::string>
+	{
+		std::mt19937 random{42};
+		std::uniform_int_distribution<std::size_t> distribution{0, alphabet.size() - 1};
+
+		std::vector<std::string> strings{};
+		for (std::size_t length = 0; length <= 200; ++length)
+		{
+			std::string s{};
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				s.push_back(alphabet[distribution(random)]);
+			}
+			strings.push_back(std::move(s));
+		}
+
+		return strings;
+	}
+
+	template<std::floating_point T>
+	[[nodiscard]] auto to_chars(const T value) -> std::string
+	{
+		char buffer[64];
+		return {buffer, string::to_chars(buffer, buffer + sizeof(buffer), value).ptr};
+	}
+
+	// the boundaries of each range, and some non-ASCII characters
+	constexpr std::string_view mixed{"@AZ[`az{/09: \x7f\x80\xc3\xff"};
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"string.charconv"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+
+		"is_xxx"_test = [] noexcept -> void
+		{
+			const auto check = [](const std::string_view alphabet) noexcept -> void
+			{
+				for (const auto& s: make_strings(alphabet))
+				{
+					expect(string::is_upper(s) == reference::all_of(s, [](const char c) noexcept { return string::is_upper(c); })) << fatal;
+					expect(string::is_lower(s) == reference::all_of(s, [](const char c) noexcept { return string::is_lower(c); })) << fatal;
+					expect(string::is_alpha(s) == reference::all_of(s, [](const char c) noexcept { return string::is_alpha(c); })) << fatal;
+					expect(string::is_digit(s) == reference::all_of(s, [](const char c) noexcept { return string::is_digit(c); })) << fatal;
+					expect(string::is_alpha_digit(s) == reference::all_of(s, [](const char c) noexcept { return string::is_alpha_digit(c); })) << fatal;
+				}
+			};
+
+			check("ABCXYZ");
+			check("abcxyz");
+			check("ABCxyz");
+			check("0123456789");
+			check("abcXYZ0189");
+			check(mixed);
+
+			expect(not string::is_upper(std::string_view{std::string(100, 'A') + '@'})) << fatal;
+			expect(not string::is_digit(std::string_view{std::string(100, '0') + '/'})) << fatal;
+			expect(not string::is_alpha(std::string_view{std::string(100, 'z') + '{'})) << fatal;
+			expect(not string::is_alpha_digit(std::string_view{std::string(100, '9') + ':'})) << fatal;
+		};
+
+		"kernel"_test = [] noexcept -> void
+		{
+			using string::charconv_detail::CharacterCategory;
+			using string::charconv_detail::Kernel;
+			using platform::InstructionSet;
+
+			const auto check = [](const Kernel kernel) noexcept -> void
+			{
+				for (const auto alphabet: {std::string_view{"ABCXYZ"}, std::string_view{"abcxyz"}, std::string_view{"0123456789"}, std::string_view{"abcXYZ0189"}, mixed})
+				{
+					for (const auto& s: make_strings(alphabet))
+					{
+						using string::charconv_detail::is_all_of;
+
+						expect(is_all_of(kernel, CharacterCategory::UPPER, s) == reference::all_of(s, [](const char c) noexcept { return string::is_upper(c); })) << fatal;
+						expect(is_all_of(kernel, CharacterCategory::LOWER, s) == reference::all_of(s, [](const char c) noexcept { return string::is_lower(c); })) << fatal;
+						expect(is_all_of(kernel, CharacterCategory::ALPHA, s) == reference::all_of(s, [](const char c) noexcept { return string::is_alpha(c); })) << fatal;
+						expect(is_all_of(kernel, CharacterCategory::DIGIT, s) == reference::all_of(s, [](const char c) noexcept { return string::is_digit(c); })) << fatal;
+						expect(is_all_of(kernel, CharacterCategory::ALPHA_DIGIT, s) == reference::all_of(s, [](const char c) noexcept { return string::is_alpha_digit(c); })) << fatal;
+
+						std::string out(s.size(), '\0');
+
+						string::charconv_detail::to_upper(kernel, s, out.data());
+						expect(out == reference::to_upper(s)) << fatal;
+
+						string::charconv_detail::to_lower(kernel, s, out.data());
+						expect(out == reference::to_lower(s)) << fatal;
+
+						// in place
+						out = s;
+						string::charconv_detail::to_upper(kernel, out, out.data());
+						expect(out == reference::to_upper(s)) << fatal;
+					}
+				}
+			};
+
+			check(Kernel::SCALAR);
+			check(Kernel::SWAR);
+
+			// every kernel supported by the CPU
+			if (platform::is_instruction_set_supported(InstructionSet::SSE42))
+			{
+				check(Kernel::SSE42);
+			}
+			if (platform::is_instruction_set_supported(InstructionSet::AVX2))
+			{
+				check(Kernel::AVX2);
+			}
+			if (platform::is_instruction_set_supported(InstructionSet::AVX512F | InstructionSet::AVX512BW))
+			{
+				check(Kernel::AVX512BW);
+			}
+		};
+
+		"to_xxx"_test = [] noexcept -> void
+		{
+			const auto check = [](const std::string_view alphabet) noexcept -> void
+			{
+				for (const auto& s: make_strings(alphabet))
+				{
+					const std::string_view view{s};
+
+					expect(string::to_upper(view) == reference::to_upper(s)) << fatal;
+					expect(string::to_lower(view) == reference::to_lower(s)) << fatal;
+					expect(string::to_title(view) == reference::to_title(s)) << fatal;
+
+					// in place
+					auto upper = s;
+					string::to_upper(upper);
+					expect(upper == reference::to_upper(s)) << fatal;
+
+					auto lower = s;
+					string::to_lower(lower);
+					expect(lower == reference::to_lower(s)) << fatal;
+
+					auto title = s;
+					string::to_title(title);
+					expect(title == reference::to_title(s)) << fatal;
+				}
+			};
+
+			check("aBcXyZ");
+			check("ab Cd  eF   ");
+			check(mixed);
+
+			expect(string::to_title(std::string_view{"hello WORLD foo"}) == std::string_view{"Hello World Foo"}) << fatal;
+
+			// a character array is a string view (not converted in place)
+			{
+				char buffer[] = "hello WORLD";
+				expect(string::to_upper(buffer) == std::string_view{"HELLO WORLD"}) << fatal;
+				expect(string::to_lower(buffer) == std::string_view{"hello world"}) << fatal;
+				expect(string::to_title(buffer) == std::string_view{"Hello World"}) << fatal;
+				expect(std::string_view{buffer} == std::string_view{"hello WORLD"}) << fatal;
+
+				string::to_upper_in_place(buffer);
+				expect(std::string_view{buffer} == std::string_view{"HELLO WORLD"}) << fatal;
+			}
+			// a space at the beginning of a word does not start a new word
+			expect(string::to_title(std::string_view{"a  bC"}) == std::string_view{"A  bc"}) << fatal;
+		};
+
+		"to_xxx_into"_test = [] noexcept -> void
+		{
+			const auto check = [](const std::string_view alphabet) noexcept -> void
+			{
+				// longer than the conversion buffer => the words cross the chunks
+				for (const auto& s: make_strings(alphabet))
+				{
+					const auto twice = s + s;
+					const std::string_view view{twice};
+
+					// append
+					{
+						std::string out{"prefix"};
+						string::to_upper(view, out);
+						expect(out == "prefix" + reference::to_upper(twice)) << fatal;
+
+						out.clear();
+						string::to_lower(view, out);
+						expect(out == reference::to_lower(twice)) << fatal;
+
+						out = "prefix";
+						string::to_title(view, out);
+						expect(out == "prefix" + reference::to_title(twice)) << fatal;
+					}
+
+					// span
+					{
+						std::vector<char> buffer(twice.size() + 1, '!');
+
+						const auto upper = string::to_upper(view, std::span{buffer});
+						expect(upper.data() == buffer.data()) << fatal;
+						expect(std::string_view{upper.data(), upper.size()} == reference::to_upper(twice)) << fatal;
+						expect(buffer.back() == value('!')) << fatal;
+
+						const auto title = string::to_title(view, std::span{buffer});
+						expect(std::string_view{title.data(), title.size()} == reference::to_title(twice)) << fatal;
+					}
+
+					// output iterator (not contiguous)
+					{
+						std::vector<char> out{};
+
+						string::to_title(view, std::back_inserter(out));
+						expect(std::string_view{out.data(), out.size()} == reference::to_title(twice)) << fatal;
+
+						out.clear();
+						string::to_lower(view, std::back_inserter(out));
+						expect(std::string_view{out.data(), out.size()} == reference::to_lower(twice)) << fatal;
+					}
+
+					// output iterator (contiguous)
+					{
+						std::string out(twice.size(), '\0');
+
+						const auto end = string::to_upper(view, out.begin());
+						expect(end == out.end()) << fatal;
+						expect(out == reference::to_upper(twice)) << fatal;
+					}
+
+					// in place
+					{
+						auto in_place = twice;
+
+						string::to_title_in_place(in_place);
+						expect(in_place == reference::to_title(twice)) << fatal;
+
+						string::to_lower_in_place(std::span{in_place}.subspan(in_place.size() / 2));
+						expect(in_place.substr(0, in_place.size() / 2) == reference::to_title(twice).substr(0, in_place.size() / 2)) << fatal;
+						expect(in_place.substr(in_place.size() / 2) == reference::to_lower(twice.substr(twice.size() / 2))) << fatal;
+					}
+				}
+			};
+
+			check("ab Cd  eF   ");
+			check(mixed);
+		};
+
+		"from_string_batch"_test = [] noexcept -> void
+		{
+			const auto check = []<typename T>(const std::vector<std::string>& fields) noexcept -> void
+			{
+				std::string string{};
+				for (const auto& field: fields)
+				{
+					string.append(field);
+					string.push_back(',');
+				}
+				string.pop_back();
+
+				std::vector<T> values(fields.size() + 1, T{42});
+				std::vector<std::uint64_t> errors((values.size() + 63) / 64, ~std::uint64_t{0});
+
+				const auto count = string::from_string<T>(string, ',', std::span{values}, std::span{errors});
+				expect(count == value(fields.size())) << fatal;
+				// not parsed
+				expect(values[fields.size()] == value(T{42})) << fatal;
+
+				for (std::size_t i = 0; i < fields.size(); ++i)
+				{
+					const auto expected = string::from_string<T>(fields[i]);
+					const auto error = ((errors[i / 64] >> (i % 64)) & 1) == 1;
+
+					expect(error == not expected.has_value()) << fatal;
+					expect(values[i] == value(expected.value_or(T{}))) << fatal;
+				}
+			};
+
+			// 1~25 digits, with a random sign and some invalid characters
+			std::mt19937 random{42};
+			std::vector<std::string> fields{};
+			for (std::size_t i = 0; i < 1000; ++i)
+			{
+				std::string field{};
+
+				if (random() % 3 == 0)
+				{
+					field.push_back('-');
+				}
+				if (random() % 5 == 0)
+				{
+					field.append(random() % 20, '0');
+				}
+
+				const auto length = 1 + random() % 25;
+				for (std::size_t j = 0; j < length; ++j)
+				{
+					field.push_back(static_cast<char>('0' + random() % 10));
+				}
+
+				if (random() % 50 == 0)
+				{
+					field.insert(random() % field.size(), 1, "x +.\xff"[random() % 5]);
+				}
+
+				fields.push_back(std::move(field));
+			}
+
+			check.operator()<std::int8_t>(fields);
+			check.operator()<std::uint8_t>(fields);
+			check.operator()<std::int16_t>(fields);
+			check.operator()<std::uint32_t>(fields);
+			check.operator()<std::int64_t>(fields);
+			check.operator()<std::uint64_t>(fields);
+
+			const std::vector<std::string> edges{
+					"",
+					"-",
+					"0",
+					"-0",
+					"00000000000000000000000000001",
+					"18446744073709551615",
+					"18446744073709551616",
+					"99999999999999999999",
+					"9223372036854775807",
+					"9223372036854775808",
+					"-9223372036854775808",
+					"-9223372036854775809",
+					"12345678",
+					"123456789",
+					"1 ",
+					" 1",
+					"+1",
+			};
+
+			check.operator()<std::int64_t>(edges);
+			check.operator()<std::uint64_t>(edges);
+			check.operator()<std::int32_t>(edges);
+
+			// more fields than values
+			{
+				std::int32_t values[2];
+				std::uint64_t errors[1];
+
+				expect(string::from_string<std::int32_t>("1,2,3", ',', std::span{values}, std::span{errors}) == 2_ull) << fatal;
+				expect(values[0] == 1_i) << fatal;
+				expect(values[1] == 2_i) << fatal;
+				expect(errors[0] == 0_ull) << fatal;
+			}
+
+			// no field
+			{
+				std::int32_t values[2];
+				std::uint64_t errors[1];
+
+				expect(string::from_string<std::int32_t>("", ',', std::span{values}, std::span{errors}) == 0_ull) << fatal;
+			}
+		};
+
+		"to_chars_floating_point"_test = [] noexcept -> void
+		{
+			const auto check = []<typename T>(const T v) noexcept -> void
+			{
+				char buffer[64];
+				const auto [last, error_code] = string::to_chars(buffer, buffer + sizeof(buffer), v);
+				expect(error_code == std::errc{}) << fatal;
+
+				char expected_buffer[64];
+				const auto expected = std::to_chars(expected_buffer, expected_buffer + sizeof(expected_buffer), v);
+				expect(std::string_view{buffer, last} == std::string_view{expected_buffer, expected.ptr}) << fatal;
+
+				// round trip
+				if (not std::isnan(v))
+				{
+					const auto result = string::from_string<T>({buffer, last});
+					expect(result.has_value()) << fatal;
+					expect(std::memcmp(&*result, &v, sizeof(T)) == 0_i) << fatal;
+				}
+			};
+
+			std::mt19937_64 random{42};
+			for (std::size_t i = 0; i < 100'000; ++i)
+			{
+				check(std::bit_cast<double>(random()));
+				check(std::bit_cast<float>(static_cast<std::uint32_t>(random())));
+			}
+
+			// subnormal
+			for (std::uint32_t i = 1; i < 1000; ++i)
+			{
+				check(std::bit_cast<double>(std::uint64_t{i}));
+				check(std::bit_cast<float>(i));
+			}
+
+			// integers, powers of 2 and 10
+			for (int i = -1100; i <= 1100; ++i)
+			{
+				check(std::ldexp(1.0, i));
+				check(std::ldexp(1.0f, i));
+				check(static_cast<double>(i) * 12345);
+			}
+			for (int i = -330; i <= 310; ++i)
+			{
+				check(std::pow(10.0, i));
+				check(static_cast<float>(std::pow(10.0, i)));
+			}
+
+			check(0.0);
+			check(-0.0);
+			check(std::numeric_limits<double>::infinity());
+			check(-std::numeric_limits<double>::infinity());
+			check(std::numeric_limits<double>::quiet_NaN());
+			check(std::numeric_limits<double>::max());
+			check(std::numeric_limits<double>::min());
+			check(std::numeric_limits<float>::max());
+			check(std::numeric_limits<float>::min());
+			check(123456789012345680000.0);
+			check(1e23);
+
+			expect(to_chars(0.1) == std::string_view{"0.1"}) << fatal;
+			expect(to_chars(1e23) == std::string_view{"1e+23"}) << fatal;
+			expect(to_chars(-std::numeric_limits<double>::denorm_min()) == std::string_view{"-5e-324"}) << fatal;
+
+			// too small
+			{
+				char buffer[6];
+
+				const auto [last, error_code] = string::to_chars(buffer, buffer + 5, 1.2345);
+				expect(last == buffer + 5) << fatal;
+				expect(error_code == std::errc::value_too_large) << fatal;
+				// -1e+10
+				expect(string::to_chars(buffer, buffer + 5, -1e10).ec == std::errc::value_too_large) << fatal;
+				expect(string::to_chars(buffer, buffer + 6, -1e10).ec == std::errc{}) << fatal;
+			}
+		};
+
+		"from_string_floating_point"_test = [] noexcept -> void
+		{
+			expect(string::from_string<double>("0.1") == value(0.1)) << fatal;
+			expect(string::from_string<double>("-1.5e-3") == value(-1.5e-3)) << fatal;
+			expect(string::from_string<double>(".5") == value(.5)) << fatal;
+			expect(string::from_string<double>("5.") == value(5.)) << fatal;
+			expect(string::from_string<double>("1E5") == value(1e5)) << fatal;
+			expect(string::from_string<double>("9007199254740993") == value(9007199254740992.0)) << fatal;
+			expect(string::from_string<double>("2.2250738585072011e-308") == value(2.2250738585072011e-308)) << fatal;
+			expect(string::from_string<double>("4.9406564584124654e-324") == value(std::numeric_limits<double>::denorm_min())) << fatal;
+			expect(string::from_string<double>("1.7976931348623157e308") == value(std::numeric_limits<double>::max())) << fatal;
+			expect(string::from_string<float>("3.4028235e38") == value(std::numeric_limits<float>::max())) << fatal;
+			expect(string::from_string<float>("1e-45") == value(std::numeric_limits<float>::denorm_min())) << fatal;
+			// more than 19 significant digits
+			expect(string::from_string<double>("0.1000000000000000000000000000001") == value(0.1)) << fatal;
+			expect(string::from_string<double>("123456789012345678901234567890") == value(123456789012345678901234567890.0)) << fatal;
+			expect(string::from_string<double>("000000000000000000000000000000000000001") == value(1.0)) << fatal;
+
+			expect(std::signbit(*string::from_string<double>("-0"))) << fatal;
+			expect(string::from_string<double>("inf") == value(std::numeric_limits<double>::infinity())) << fatal;
+			expect(string::from_string<double>("-Infinity") == value(-std::numeric_limits<double>::infinity())) << fatal;
+			expect(std::isnan(*string::from_string<double>("nan"))) << fatal;
+			expect(std::isnan(*string::from_string<float>("NaN(123_abc)"))) << fatal;
+
+			// out of range
+			expect(not string::from_string<double>("1e309").has_value()) << fatal;
+			expect(not string::from_string<double>("1e-400").has_value()) << fatal;
+			expect(not string::from_string<float>("1e39").has_value()) << fatal;
+			expect(string::from_string<double>("0e999") == value(0.0)) << fatal;
+
+			// invalid
+			expect(not string::from_string<double>("").has_value()) << fatal;
+			expect(not string::from_string<double>("-").has_value()) << fatal;
+			expect(not string::from_string<double>(".").has_value()) << fatal;
+			expect(not string::from_string<double>("+1").has_value()) << fatal;
+			expect(not string::from_string<double>(" 1").has_value()) << fatal;
+			expect(not string::from_string<double>("1e").has_value()) << fatal;
+			expect(not string::from_string<double>("1e+").has_value()) << fatal;
+			expect(not string::from_string<double>("0x1p3").has_value()) << fatal;
+			expect(not string::from_string<double>("infinit").has_value()) << fatal;
+			expect(not string::from_string<double>("nan(").has_value()) << fatal;
+		};
+	};
+}
@@ -0,0 +1,133 @@
+#include <vector>
+#include <thread>
+
+// string::concurrent_string_pool
+#include <prometheus/string/string.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include "make_string.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	constexpr std::size_t thread_count = 8;
+	constexpr std::size_t string_count_per_thread = 5000;
+
+	using string_test::make_string;
+
+	// Every thread adds the same strings, returns the views added by each thread.
+	template<typename Pool>
+	[[nodiscard]] auto add_from_threads(Pool& pool) -> std::vector<std::vector<typename Pool::view_type>>
+	{
+		using char_type = Pool::value_type;
+
+		std::vector<std::vector<typename Pool::view_type>> views(thread_count);
+		{
+			std::vector<std::jthread> threads{};
+			for (std::size_t t = 0; t < thread_count; ++t)
+			{
+				threads.emplace_back(
+					[&pool, &v = views[t]] -> void
+					{
+						v.reserve(string_count_per_thread);
+						for (std::size_t i = 0; i < string_count_per_thread; ++i)
+						{
+							v.push_back(pool.add(make_string<char_type>(i)));
+						}
+					}
+				);
+			}
+		}
+
+		return views;
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"string.concurrent_string_pool"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+		using namespace string;
+
+		const auto test_pool = []<typename CharType, bool IsNullTerminate>() noexcept -> void
+		{
+			"concurrent"_test = [] noexcept -> void
+			{
+				using pool_type = ConcurrentStringPool<CharType, IsNullTerminate>;
+
+				// small blocks => many blocks are published
+				pool_type p{64};
+				const auto views = add_from_threads(p);
+
+				for (const auto& v: views)
+				{
+					for (std::size_t i = 0; i < v.size(); ++i)
+					{
+						expect(v[i] == make_string<CharType>(i)) << fatal;
+					}
+				}
+
+				// every thread has its own blocks
+				expect(views[0][0].data() != views[1][0].data()) << fatal;
+				expect(p.size() >= value(thread_count)) << fatal;
+			};
+
+			"huge_string"_test = [] noexcept -> void
+			{
+				using pool_type = ConcurrentStringPool<CharType, IsNullTerminate>;
+
+				pool_type p{16};
+
+				const auto s1 = make_string<CharType>(1);
+				const std::basic_string<CharType> s2(100, static_cast<CharType>('x'));
+
+				const auto v1 = p.add(s1);
+				const auto v2 = p.add(s2);
+				const auto v3 = p.add(s1);
+				expect(p.size() == 2_ull) << fatal;
+
+				expect(v1 == s1) << fatal;
+				expect(v2 == s2) << fatal;
+				// the current block is kept
+				expect(v3.data() == v1.data() + s1.size() + IsNullTerminate) << fatal;
+			};
+
+			"deduplicate"_test = [] noexcept -> void
+			{
+				using pool_type = ConcurrentStringPool<CharType, IsNullTerminate, std::char_traits<CharType>, true>;
+
+				pool_type p{64};
+				const auto views = add_from_threads(p);
+
+				// 13 * 7 distinct strings
+				for (std::size_t i = 0; i < string_count_per_thread; ++i)
+				{
+					const auto data = views[0][i % 91].data();
+					for (const auto& v: views)
+					{
+						expect(v[i] == make_string<CharType>(i)) << fatal;
+						expect(v[i].data() == data) << fatal;
+					}
+				}
+
+				expect(p.contains(make_string<CharType>(42))) << fatal;
+				expect(not p.contains(std::basic_string<CharType>(8, static_cast<CharType>('a')))) << fatal;
+			};
+		};
+
+		"pool"_test = [test_pool] noexcept -> void
+		{
+			test_pool.operator()<char, false>();
+			test_pool.operator()<char8_t, false>();
+			test_pool.operator()<char16_t, false>();
+			test_pool.operator()<char32_t, false>();
+			test_pool.operator()<wchar_t, false>();
+
+			test_pool.operator()<char, true>();
+			test_pool.operator()<char8_t, true>();
+			test_pool.operator()<char16_t, true>();
+			test_pool.operator()<char32_t, true>();
+			test_pool.operator()<wchar_t, true>();
+		};
+	};
+}
@@ -0,0 +1,101 @@
+#include <vector>
+
+// string::interned_string_pool
+#include <prometheus/string/string.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include "make_string.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	using string_test::make_string;
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"string.interned_string_pool"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+		using namespace string;
+
+		const auto test_pool = []<typename CharType, bool IsNullTerminate>() noexcept -> void
+		{
+			using pool_type = InternedStringPool<CharType, IsNullTerminate>;
+
+			"duplicate"_test = [] noexcept -> void
+			{
+				pool_type p{};
+				expect(p.empty()) << fatal;
+
+				const auto s1 = make_string<CharType>(1);
+				const auto s2 = make_string<CharType>(2);
+
+				const auto id1 = p.intern(s1);
+				const auto id2 = p.intern(s2);
+				expect(value(id1) != id2) << fatal;
+				expect(p.size() == 2_ull) << fatal;
+
+				// same string => same id and same view
+				expect(value(p.intern(std::basic_string<CharType>{s1})) == id1) << fatal;
+				expect(p.add(s1).data() == p.view_of(id1).data()) << fatal;
+				expect(p.add(s2).data() == p[id2].data()) << fatal;
+				expect(p.size() == 2_ull) << fatal;
+
+				expect(value(p.find(s1)) == id1) << fatal;
+				expect(value(p.find(s2)) == id2) << fatal;
+				expect(value(p.find(make_string<CharType>(3))) == pool_type::invalid_id) << fatal;
+				expect(not p.contains(make_string<CharType>(3))) << fatal;
+			};
+
+			"rehash"_test = [] noexcept -> void
+			{
+				// small blocks => many blocks
+				pool_type p{16};
+
+				std::vector<std::basic_string<CharType>> strings{};
+				std::vector<typename pool_type::id_type> ids{};
+
+				for (std::size_t i = 0; i < 13 * 7 * 10; ++i)
+				{
+					strings.push_back(make_string<CharType>(i));
+					ids.push_back(p.intern(strings.back()));
+				}
+
+				// 13 * 7 distinct strings
+				expect(p.size() == 91_ull) << fatal;
+				expect(p.views().size() == 91_ull) << fatal;
+
+				for (std::size_t i = 0; i < strings.size(); ++i)
+				{
+					expect(p.view_of(ids[i]) == strings[i]) << fatal;
+					expect(value(ids[i]) == ids[i % 91]) << fatal;
+				}
+			};
+
+			"move"_test = [] noexcept -> void
+			{
+				pool_type p1{};
+				const auto view = p1.add(make_string<CharType>(42));
+
+				pool_type p2{std::move(p1)};
+				expect(p2.add(make_string<CharType>(42)).data() == view.data()) << fatal;
+				expect(p2.size() == 1_ull) << fatal;
+			};
+		};
+
+		"pool"_test = [test_pool] noexcept -> void
+		{
+			test_pool.operator()<char, false>();
+			test_pool.operator()<char8_t, false>();
+			test_pool.operator()<char16_t, false>();
+			test_pool.operator()<char32_t, false>();
+			test_pool.operator()<wchar_t, false>();
+
+			test_pool.operator()<char, true>();
+			test_pool.operator()<char8_t, true>();
+			test_pool.operator()<char16_t, true>();
+			test_pool.operator()<char32_t, true>();
+			test_pool.operator()<wchar_t, true>();
+		};
+	};
+}
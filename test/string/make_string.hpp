@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+#include <algorithm>
+#include <iterator>
+
+namespace string_test
+{
+	// 1 + index % 7 copies of the (index % 13)th letter, e.g. `a`, `bb`, `ccc`...
+	template<typename CharType>
+	[[nodiscard]] constexpr auto make_string(const std::size_t index) noexcept -> std::basic_string<CharType>
+	{
+		std::basic_string<CharType> result{};
+
+		std::ranges::fill_n(std::back_inserter(result), 1 + index % 7, static_cast<CharType>('a' + index % 13));
+		return result;
+	}
+}
@@ -0,0 +1,139 @@
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <limits>
+
+// string::mapped_string_pool
+#include <prometheus/string/string.hpp>
+// ut
+#include <prometheus/ut/unit_test.hpp>
+
+#include "make_string.hpp"
+
+using namespace prometheus;
+
+namespace
+{
+	using string_test::make_string;
+
+	[[nodiscard]] auto temporary_file() -> std::filesystem::path
+	{
+		return std::filesystem::temp_directory_path() / "prometheus.test.mapped_string_pool.bin";
+	}
+
+	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"string.mapped_string_pool"> _ = [] noexcept -> void
+	{
+		using namespace ut;
+		using namespace string;
+
+		const auto test_pool = []<typename CharType, bool IsNullTerminate>() noexcept -> void
+		{
+			"serialize"_test = [] noexcept -> void
+			{
+				// small blocks => many blocks
+				InternedStringPool<CharType, IsNullTerminate> p{16};
+
+				std::vector<typename InternedStringPool<CharType, IsNullTerminate>::id_type> ids{};
+				for (std::size_t i = 0; i < 13 * 7 * 2; ++i)
+				{
+					ids.push_back(p.intern(make_string<CharType>(i)));
+				}
+				expect(p.pool().size() > 1_ull) << fatal;
+
+				const auto path = temporary_file();
+				{
+					std::ofstream file{path, std::ios::binary | std::ios::trunc};
+					p.serialize(file);
+				}
+
+				{
+					const auto mapped = MappedStringPool<CharType, IsNullTerminate>::open(path);
+					expect(mapped.has_value()) << fatal;
+					expect(mapped->size() == value(p.size())) << fatal;
+
+					for (std::size_t i = 0; i < ids.size(); ++i)
+					{
+						const auto view = mapped->view_of(ids[i]);
+						expect(view == make_string<CharType>(i)) << fatal;
+
+						if constexpr (IsNullTerminate)
+						{
+							expect(view.data()[view.size()] == value(CharType{0})) << fatal;
+						}
+					}
+
+					// mismatched character type
+					if constexpr (sizeof(CharType) != sizeof(char))
+					{
+						expect(not MappedStringPool<char, IsNullTerminate>::open(path).has_value()) << fatal;
+					}
+					expect(not MappedStringPool<CharType, not IsNullTerminate>::open(path).has_value()) << fatal;
+				}
+
+				// truncated
+				std::filesystem::resize_file(path, std::filesystem::file_size(path) - sizeof(CharType));
+				expect(not MappedStringPool<CharType, IsNullTerminate>::open(path).has_value()) << fatal;
+
+				// a string out of range (`offset + length + IsNullTerminate` wraps)
+				{
+					std::ofstream file{path, std::ios::binary | std::ios::trunc};
+					p.serialize(file);
+				}
+				expect(MappedStringPool<CharType, IsNullTerminate>::open(path).has_value()) << fatal;
+				{
+					std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+					const string_pool_detail::serialized_string string{.offset = 1, .length = std::numeric_limits<std::uint64_t>::max()};
+					file.seekp(sizeof(string_pool_detail::serialized_header));
+					file.write(reinterpret_cast<const char*>(&string), sizeof(string));
+				}
+				expect(not MappedStringPool<CharType, IsNullTerminate>::open(path).has_value()) << fatal;
+
+				std::filesystem::remove(path);
+				expect(not MappedStringPool<CharType, IsNullTerminate>::open(path).has_value()) << fatal;
+			};
+
+			"compact"_test = [] noexcept -> void
+			{
+				InternedStringPool<CharType, IsNullTerminate> p{16};
+
+				for (std::size_t i = 0; i < 13 * 7; ++i)
+				{
+					std::ignore = p.intern(make_string<CharType>(i));
+				}
+				expect(p.pool().size() > 1_ull) << fatal;
+
+				p.compact();
+				expect(p.pool().size() == 1_ull) << fatal;
+				expect(p.pool().fragmentation() == value(0.0)) << fatal;
+
+				for (std::size_t i = 0; i < 13 * 7; ++i)
+				{
+					const auto string = make_string<CharType>(i);
+
+					expect(p.view_of(static_cast<std::uint32_t>(i)) == string) << fatal;
+					expect(value(p.find(string)) == i) << fatal;
+				}
+
+				// the pool is still usable
+				const auto s = std::basic_string<CharType>(8, static_cast<CharType>('a'));
+				expect(value(p.intern(s)) == 13 * 7) << fatal;
+				expect(p.pool().size() == 2_ull) << fatal;
+			};
+		};
+
+		"pool"_test = [test_pool] noexcept -> void
+		{
+			test_pool.operator()<char, false>();
+			test_pool.operator()<char8_t, false>();
+			test_pool.operator()<char16_t, false>();
+			test_pool.operator()<char32_t, false>();
+			test_pool.operator()<wchar_t, false>();
+
+			test_pool.operator()<char, true>();
+			test_pool.operator()<char8_t, true>();
+			test_pool.operator()<char16_t, true>();
+			test_pool.operator()<char32_t, true>();
+			test_pool.operator()<wchar_t, true>();
+		};
+	};
+}
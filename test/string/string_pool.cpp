@@ -1,5 +1,7 @@
 #include <utility>
 #include <coroutine>
+#include <ranges>
+#include <memory_resource>
 
 // string::string_pool
 #include <prometheus/string/string.hpp>
@@ -38,6 +40,31 @@ namespace
 		return result;
 	}
 
+	class CountingResource final : public std::pmr::memory_resource
+	{
+	public:
+		std::size_t allocated = 0;
+		std::size_t deallocated = 0;
+
+	private:
+		auto do_allocate(const std::size_t bytes, const std::size_t alignment) -> void* override
+		{
+			allocated += bytes;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		auto do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) -> void override
+		{
+			deallocated += bytes;
+			std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+
+		[[nodiscard]] auto do_is_equal(const memory_resource& other) const noexcept -> bool override
+		{
+			return this == &other;
+		}
+	};
+
 	PROMETHEUS_COMPILER_NO_DESTROY ut::suite<"string.string_pool"> _ = [] noexcept -> void
 	{
 		using namespace ut;
@@ -150,6 +177,188 @@ namespace
 				expect(p3.size() == 0_ull) << fatal; // NOLINT(bugprone-use-after-move)
 				expect(p.size() == 5_ull) << fatal;
 			};
+
+			"reuse"_test = [] noexcept -> void
+			{
+				using pool_type = StringPool<CharType, IsNullTerminate>;
+
+				pool_type p{100};
+
+				const auto s1 = make_random_string<CharType>(60);
+				const auto s2 = make_random_string<CharType>(60);
+				const auto s3 = make_random_string<CharType>(35);
+				const auto s4 = make_random_string<CharType>(35);
+				const auto s5 = make_random_string<CharType>(35);
+
+				const auto v1 = p.add(s1);
+				const auto v2 = p.add(s2);
+				// (60 + IsNullTerminate) / 100
+				// (60 + IsNullTerminate) / 100
+				expect(p.size() == 2_ull) << fatal;
+
+				const auto v3 = p.add(s3);
+				// (60 + IsNullTerminate) / 100
+				// (60 + IsNullTerminate) + (35 + IsNullTerminate) / 100
+				expect(p.size() == 2_ull) << fatal;
+				expect(v3.data() == v2.data() + 60 + IsNullTerminate) << fatal;
+
+				const auto v4 = p.add(s4);
+				// (60 + IsNullTerminate) + (35 + IsNullTerminate) / 100 <== the previous block
+				// (60 + IsNullTerminate) + (35 + IsNullTerminate) / 100
+				expect(p.size() == 2_ull) << fatal;
+				expect(v4.data() == v1.data() + 60 + IsNullTerminate) << fatal;
+
+				const auto v5 = p.add(s5);
+				expect(p.size() == 3_ull) << fatal;
+
+				expect(v1 == s1) << fatal;
+				expect(v2 == s2) << fatal;
+				expect(v3 == s3) << fatal;
+				expect(v4 == s4) << fatal;
+				expect(v5 == s5) << fatal;
+			};
+
+			"add_range"_test = [] noexcept -> void
+			{
+				using pool_type = StringPool<CharType, IsNullTerminate>;
+				using view_type = pool_type::view_type;
+
+				constexpr std::size_t count = 50;
+				constexpr std::size_t length = 10;
+
+				pool_type p{100};
+				expect(p.memory_usage() == 0_ull) << fatal;
+
+				std::vector<std::basic_string<CharType>> strings{};
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					strings.push_back(make_random_string<CharType>(length));
+				}
+
+				std::vector<view_type> views{};
+				p.add_range(strings, std::back_inserter(views));
+				// all strings in one block
+				expect(p.size() == 1_ull) << fatal;
+				expect(p.memory_usage() == value(count * (length + IsNullTerminate) * sizeof(CharType))) << fatal;
+				expect(p.fragmentation() == value(0.0)) << fatal;
+
+				expect(views.size() == value(count)) << fatal;
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					expect(views[i] == strings[i]) << fatal;
+					expect(views[i].data() == views[0].data() + i * (length + IsNullTerminate)) << fatal;
+				}
+
+				// the reserved space is used by the next strings
+				p.reserve((length + IsNullTerminate) * sizeof(CharType));
+				expect(p.size() == 2_ull) << fatal;
+				std::ignore = p.add(strings[0]);
+				expect(p.size() == 2_ull) << fatal;
+			};
+
+			"add_range_prvalue"_test = [] noexcept -> void
+			{
+				using pool_type = StringPool<CharType, IsNullTerminate>;
+				using view_type = pool_type::view_type;
+
+				constexpr std::size_t count = 50;
+				constexpr std::size_t length = 32;
+
+				pool_type p{};
+
+				std::vector<std::basic_string<CharType>> strings{};
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					strings.push_back(make_random_string<CharType>(length));
+				}
+
+				// the range yields `std::basic_string` prvalues (long enough to be heap allocated)
+				const auto copies = strings | std::views::transform([](const auto& string) { return std::basic_string<CharType>{string}; });
+
+				std::vector<view_type> views{};
+				p.add_range(copies, std::back_inserter(views));
+				expect(p.memory_usage() == value(count * (length + IsNullTerminate) * sizeof(CharType))) << fatal;
+
+				expect(views.size() == value(count)) << fatal;
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					expect(views[i] == strings[i]) << fatal;
+				}
+			};
+
+			"fragmentation"_test = [] noexcept -> void
+			{
+				using pool_type = StringPool<CharType, IsNullTerminate>;
+
+				pool_type p{100};
+				expect(p.fragmentation() == value(0.0)) << fatal;
+
+				std::ignore = p.add(make_random_string<CharType>(60));
+				// the current block
+				expect(p.fragmentation() == value(0.0)) << fatal;
+
+				std::ignore = p.add(make_random_string<CharType>(60));
+				expect(p.memory_usage() == value(200 * sizeof(CharType))) << fatal;
+				expect(p.fragmentation() == value(static_cast<double>(40 - IsNullTerminate) / 200)) << fatal;
+			};
+
+			"pmr"_test = [] noexcept -> void
+			{
+				using pool_type = pmr::StringPool<CharType, IsNullTerminate>;
+
+				constexpr auto length = 1000;
+				constexpr auto block_bytes = pool_type::default_block_initial_size * sizeof(CharType);
+
+				CountingResource resource{};
+				CountingResource other_resource{};
+				{
+					pool_type p1{&resource};
+					pool_type p2{&resource};
+					pool_type p3{&other_resource};
+
+					const auto s1 = make_random_string<CharType>(length);
+					const auto v1 = p1.add(s1);
+					std::ignore = p2.add(make_random_string<CharType>(length));
+					std::ignore = p3.add(make_random_string<CharType>(length));
+					expect(resource.allocated == value(2 * block_bytes)) << fatal;
+					expect(other_resource.allocated == value(block_bytes)) << fatal;
+
+					// same resource => the blocks are moved
+					p1.join(std::move(p2));
+					expect(p1.size() == 2_ull) << fatal;
+					expect(resource.allocated == value(2 * block_bytes)) << fatal;
+					expect(p1.add(s1).data() != v1.data()) << fatal;
+
+					// different resource => the blocks are copied into our resource
+					p1.join(std::move(p3));
+					expect(p1.size() == 3_ull) << fatal;
+					expect(resource.allocated == value(3 * block_bytes)) << fatal;
+					expect(other_resource.deallocated == value(block_bytes)) << fatal;
+					expect(v1 == s1) << fatal;
+
+					// same resource => the blocks are taken over
+					pool_type p4{&resource};
+					std::ignore = p4.add(make_random_string<CharType>(length));
+					const auto allocated = resource.allocated;
+					p4 = std::move(p1);
+					expect(p4.size() == 3_ull) << fatal;
+					expect(p1.size() == 0_ull) << fatal;
+					expect(resource.allocated == value(allocated)) << fatal;
+					expect(v1 == s1) << fatal;
+
+					// different resource => the blocks are copied into our resource
+					pool_type p5{&other_resource};
+					const auto other_allocated = other_resource.allocated;
+					p5 = std::move(p4);
+					expect(p5.size() == 3_ull) << fatal;
+					expect(other_resource.allocated == value(other_allocated + 3 * block_bytes)) << fatal;
+				}
+				expect(resource.deallocated == value(resource.allocated)) << fatal;
+				expect(other_resource.deallocated == value(other_resource.allocated)) << fatal;
+
+				static_assert(std::is_nothrow_move_assignable_v<StringPool<CharType, IsNullTerminate>>);
+				static_assert(not std::is_nothrow_move_assignable_v<pool_type>);
+			};
 		};
 
 		const auto test_block_size = []<typename CharType, bool IsNullTerminate>() noexcept -> void